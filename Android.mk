@@ -111,6 +111,7 @@ LOCAL_SRC_FILES := \
         src/armnnUtils/Logging.cpp \
         src/armnnUtils/ParserHelper.cpp \
         src/armnnUtils/Permute.cpp \
+        src/armnnUtils/QuantizedConverter.cpp \
         src/armnnUtils/TensorUtils.cpp \
         src/armnnUtils/VerificationHelpers.cpp \
         src/armnn/layers/AbsLayer.cpp \
@@ -122,7 +123,9 @@ LOCAL_SRC_FILES := \
         src/armnn/layers/ConcatLayer.cpp \
         src/armnn/layers/ConstantLayer.cpp \
         src/armnn/layers/Convolution2dLayer.cpp \
+        src/armnn/layers/ConvertBf16ToFp32Layer.cpp \
         src/armnn/layers/ConvertFp16ToFp32Layer.cpp \
+        src/armnn/layers/ConvertFp32ToBf16Layer.cpp \
         src/armnn/layers/ConvertFp32ToFp16Layer.cpp \
         src/armnn/layers/DebugLayer.cpp \
         src/armnn/layers/DepthToSpaceLayer.cpp \
@@ -524,11 +524,18 @@ struct OptimizerOptions
     OptimizerOptions()
         : m_ReduceFp32ToFp16(false)
         , m_Debug(false)
+        , m_ReduceFp32ToBf16(false)
+        , m_DisableLayerFusion(false)
     {}
 
-    OptimizerOptions(bool reduceFp32ToFp16, bool debug)
+    OptimizerOptions(bool reduceFp32ToFp16,
+                     bool debug,
+                     bool reduceFp32ToBf16 = false,
+                     bool disableLayerFusion = false)
         : m_ReduceFp32ToFp16(reduceFp32ToFp16)
         , m_Debug(debug)
+        , m_ReduceFp32ToBf16(reduceFp32ToBf16)
+        , m_DisableLayerFusion(disableLayerFusion)
     {}
 
     // Reduce Fp32 data to Fp16 for faster processing
@@ -536,6 +543,14 @@ struct OptimizerOptions
 
     // Add debug data for easier troubleshooting
     bool m_Debug;
+
+    // Reduce the inputs and weights of Convolution2d and FullyConnected layers from Fp32 to Bf16, keeping Fp32
+    // accumulation and outputs. Cannot be combined with m_ReduceFp32ToFp16
+    bool m_ReduceFp32ToBf16;
+
+    // Don't fuse batch normalizations and activations into the layers producing their inputs, so that the outputs
+    // of all the layers stay observable (see IRuntime::RegisterTensorObserver)
+    bool m_DisableLayerFusion;
 };
 
 /// Create an optimized version of the network
@@ -7,6 +7,7 @@
 
 #include "INetwork.hpp"
 #include "IProfiler.hpp"
+#include "Optional.hpp"
 #include "Tensor.hpp"
 #include "Types.hpp"
 #include "TypesUtils.hpp"
@@ -44,6 +45,7 @@ public:
             : m_GpuAccTunedParameters(nullptr)
             , m_EnableGpuProfiling(false)
             , m_DynamicBackendsPath("")
+            , m_CpuRefNumThreads(EmptyOptional())
         {}
 
         /// If set, uses the GpuAcc tuned parameters from the given object when executing GPU workloads.
@@ -57,6 +59,11 @@ public:
         // Only a single path is allowed for the override
         std::string m_DynamicBackendsPath;
 
+        // Number of threads the CpuRef backend splits the work of a single workload across.
+        // 0 uses one thread per hardware thread. The thread pool is shared by all runtimes, so it is only resized
+        // by runtimes that set this value: the others run with whatever it was last set to (one thread initially).
+        Optional<unsigned int> m_CpuRefNumThreads;
+
         struct ExternalProfilingOptions
         {
             ExternalProfilingOptions()
@@ -130,6 +137,12 @@ public:
     /// @param func callback function to pass to the debug layer.
     virtual void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func) = 0;
 
+    /// Registers a function observing the outputs of every layer of a network as it executes, with no need for
+    /// debug layers. Replaces any observer registered before.
+    /// @param networkId The id of the network to observe.
+    /// @param func function to call after each layer has executed, for each of its output tensors.
+    virtual void RegisterTensorObserver(NetworkId networkId, const TensorObserverFunction& func) = 0;
+
 protected:
     ~IRuntime() {}
 };
@@ -7,6 +7,7 @@
 #include "TensorFwd.hpp"
 
 #include "Exceptions.hpp"
+#include "Optional.hpp"
 #include "Types.hpp"
 
 #include <array>
@@ -60,6 +61,13 @@ public:
     TensorInfo(unsigned int numDimensions, const unsigned int* dimensionSizes, DataType dataType,
         float quantizationScale = 0.0f, int32_t quantizationOffset = 0);
 
+    /// Per-axis quantization: the slice at index i along dimension quantizationDim is quantized with
+    /// quantizationScales[i], and a zero offset.
+    TensorInfo(const TensorShape& shape, DataType dataType,
+        const std::vector<float>& quantizationScales, unsigned int quantizationDim);
+    TensorInfo(unsigned int numDimensions, const unsigned int* dimensionSizes, DataType dataType,
+        const std::vector<float>& quantizationScales, unsigned int quantizationDim);
+
     TensorInfo(const TensorInfo& other);
 
     TensorInfo& operator=(const TensorInfo& other);
@@ -82,7 +90,17 @@ public:
     void SetQuantizationScale(float scale)          { m_Quantization.m_Scale = scale; }
     void SetQuantizationOffset(int32_t offset)      { m_Quantization.m_Offset = offset; }
     bool IsQuantized() const                        { return m_DataType == DataType::QuantisedAsymm8 ||
-                                                             m_DataType == DataType::QuantisedSymm16; }
+                                                             m_DataType == DataType::QuantisedSymm16 ||
+                                                             m_DataType == DataType::QuantisedSymm8PerAxis; }
+
+    /// Per-axis quantization parameters. GetQuantizationScale and GetQuantizationOffset do not apply to tensors
+    /// that have them.
+    bool HasPerAxisQuantization() const             { return m_Quantization.m_QuantizationDim.has_value(); }
+    const std::vector<float>& GetQuantizationScales() const { return m_Quantization.m_Scales; }
+    void SetQuantizationScales(const std::vector<float>& scales) { m_Quantization.m_Scales = scales; }
+    Optional<unsigned int> GetQuantizationDim() const { return m_Quantization.m_QuantizationDim; }
+    void SetQuantizationDim(const Optional<unsigned int>& quantizationDim)
+                                                    { m_Quantization.m_QuantizationDim = quantizationDim; }
 
     /// Check that the types are the same and, if quantize, that the quantization parameters are the same.
     bool IsTypeSpaceMatch(const TensorInfo& other) const;
@@ -92,13 +110,20 @@ public:
 private:
     TensorShape m_Shape;
     DataType m_DataType;
-    /// Scale and offset values are used for quantization.
+    /// Scale and offset values are used for quantization. Per-axis quantized tensors use the scales and the
+    /// dimension instead.
     struct Quantization
     {
         Quantization() : m_Scale(0.f), m_Offset(0) {}
-        bool operator==(const Quantization& o) const {return ((m_Scale == o.m_Scale) && (m_Offset == o.m_Offset));}
+        bool operator==(const Quantization& o) const
+        {
+            return ((m_Scale == o.m_Scale) && (m_Offset == o.m_Offset) &&
+                    (m_Scales == o.m_Scales) && (m_QuantizationDim == o.m_QuantizationDim));
+        }
         float m_Scale;
         int32_t m_Offset;
+        std::vector<float> m_Scales;
+        Optional<unsigned int> m_QuantizationDim;
     } m_Quantization;
 };
 
@@ -31,7 +31,11 @@ enum class DataType
     QuantisedAsymm8 = 2,
     Signed32 = 3,
     Boolean = 4,
-    QuantisedSymm16 = 5
+    QuantisedSymm16 = 5,
+    /// Symmetric 8-bit integers with one quantization scale per slice along one dimension of the tensor.
+    QuantisedSymm8PerAxis = 6,
+    /// Brain floating point: float32 with the mantissa truncated to 7 bits, keeping the float32 range.
+    BFloat16 = 7
 };
 
 enum class DataLayout
@@ -208,4 +212,10 @@ class ITensorHandle;
 /// @param tensorHandle - TensorHandle for the input tensor to the Debug layer
 using DebugCallbackFunction = std::function<void(LayerGuid guid, unsigned int slotIndex, ITensorHandle* tensorHandle)>;
 
+/// Define the type of function a loaded network calls after each of its layers has executed, once per output slot
+/// @param guid - guid of the layer that has executed
+/// @param slotIndex - index of the output slot
+/// @param tensorHandle - TensorHandle for the output tensor of the slot
+using TensorObserverFunction = std::function<void(LayerGuid guid, unsigned int slotIndex, ITensorHandle* tensorHandle)>;
+
 } // namespace armnn
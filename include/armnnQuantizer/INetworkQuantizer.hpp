@@ -12,6 +12,20 @@
 namespace armnn
 {
 
+/// How the range a tensor is quantized to is selected from the values it takes during the calibration inferences
+enum class CalibrationMethod
+{
+    /// The smallest and largest values
+    MinMax = 0,
+    /// The values at the (100 - percentile)th and percentile-th percentiles
+    Percentile = 1,
+    /// The range minimizing the Kullback-Leibler divergence between the distributions of the values and of their
+    /// quantized counterparts
+    Entropy = 2,
+    /// The range minimizing the mean squared error between the values and their quantized counterparts
+    Mse = 3
+};
+
 struct QuantizerOptions
 {
     QuantizerOptions() : QuantizerOptions(DataType::QuantisedAsymm8, false) {}
@@ -19,11 +33,29 @@ struct QuantizerOptions
     QuantizerOptions(DataType activationFormat) : QuantizerOptions(activationFormat, false) {}
 
     QuantizerOptions(DataType activationFormat, bool preserveType)
+    : QuantizerOptions(activationFormat, preserveType, false) {}
+
+    QuantizerOptions(DataType activationFormat, bool preserveType, bool perChannelWeights)
     : m_ActivationFormat(activationFormat)
-    , m_PreserveType(preserveType) {}
+    , m_PreserveType(preserveType)
+    , m_PerChannelWeights(perChannelWeights)
+    , m_NumCalibrationThreads(0)
+    , m_CalibrationMethod(CalibrationMethod::MinMax)
+    , m_CalibrationPercentile(99.99f) {}
 
     DataType m_ActivationFormat;
     bool m_PreserveType;
+    /// Quantize the weights of convolution, depthwise convolution and fully connected layers to
+    /// QuantisedSymm8PerAxis, with a scale for each output channel, rather than to a single QuantisedAsymm8 range.
+    bool m_PerChannelWeights;
+    /// Maximum number of calibration inferences a batch passed to Refine runs in parallel, each on its own copy of
+    /// the network. 0 uses one per hardware thread.
+    unsigned int m_NumCalibrationThreads;
+    /// Range selection for the tensors calibrated by Refine. Other than MinMax, the methods keep a histogram of the
+    /// values of each tensor
+    CalibrationMethod m_CalibrationMethod;
+    /// Percentile of the values kept in range by CalibrationMethod::Percentile, in (50, 100]
+    float m_CalibrationPercentile;
 };
 
 using INetworkQuantizerPtr = std::unique_ptr<class INetworkQuantizer, void(*)(INetworkQuantizer* quantizer)>;
@@ -32,7 +64,7 @@ using INetworkQuantizerPtr = std::unique_ptr<class INetworkQuantizer, void(*)(IN
 class INetworkQuantizer
 {
 public:
-    /// Create Quantizer object and return raw pointer
+    /// Create Quantizer object and return raw pointer. Throws InvalidArgumentException if the options are invalid
     static INetworkQuantizer* CreateRaw(INetwork* inputNetwork, const QuantizerOptions& options = QuantizerOptions());
 
     /// Create Quantizer object wrapped in unique_ptr
@@ -47,6 +79,10 @@ public:
     /// Refine input network with a set of refinement data for specified LayerBindingId
     virtual void Refine(const InputTensors& inputTensors) = 0;
 
+    /// Refine input network with a batch of refinement data, running the inferences in parallel. The resulting
+    /// ranges are the same as when refining with each entry of the batch in turn
+    virtual void Refine(const std::vector<InputTensors>& inputTensorsBatch) = 0;
+
     /// Extract final quantized network
     virtual INetworkPtr ExportNetwork() = 0;
 
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "armnn/Types.hpp"
+#include "BFloat16.hpp"
 #include "Half.hpp"
 
 namespace armnn
@@ -29,6 +30,12 @@ inline bool CompatibleTypes<Half>(DataType dataType)
     return dataType == DataType::Float16;
 }
 
+template<>
+inline bool CompatibleTypes<BFloat16>(DataType dataType)
+{
+    return dataType == DataType::BFloat16;
+}
+
 template<>
 inline bool CompatibleTypes<uint8_t>(DataType dataType)
 {
@@ -4,7 +4,6 @@
 //
 
 #include "DynamicQuantizationVisitor.hpp"
-#include "NetworkUtils.hpp"
 
 #include <boost/core/ignore_unused.hpp>
 #include <armnn/Descriptors.hpp>
@@ -15,9 +14,8 @@
 namespace armnn
 {
 
-DynamicQuantizationVisitor::DynamicQuantizationVisitor(RangeTracker& rangeTracker, Graph& graph)
-        : m_RangeTracker(rangeTracker),
-          m_Graph(graph)
+DynamicQuantizationVisitor::DynamicQuantizationVisitor(RangeTracker& rangeTracker)
+        : m_RangeTracker(rangeTracker)
 {}
 
 void DynamicQuantizationVisitor::SetRange(const IConnectableLayer* layer, unsigned int outputIdx, float min, float max)
@@ -39,7 +37,7 @@ void DynamicQuantizationVisitor::ForwardParentParameters(const IConnectableLayer
 
 void DynamicQuantizationVisitor::AddToCalibratedLayers(const IConnectableLayer* layer)
 {
-    m_LayersToCalibrate.push_back(layer);
+    m_LayersToCalibrate.insert(layer->GetGuid());
 }
 
 void DynamicQuantizationVisitor::AddToNonCalibratedLayers(const IConnectableLayer* layer)
@@ -47,41 +45,18 @@ void DynamicQuantizationVisitor::AddToNonCalibratedLayers(const IConnectableLaye
     m_LayersNotToCalibrate.push_back(layer);
 }
 
-void DynamicQuantizationVisitor::FinishVisit()
-{
-    for (const IConnectableLayer* layer : m_LayersToCalibrate)
-    {
-        std::vector<DebugLayer*> newDebugLayers = InsertDebugLayerAfter(
-            m_Graph, *boost::polymorphic_downcast<Layer*>(const_cast<IConnectableLayer*>(layer)));
-        // record them so we can take them out again efficiently afterward
-        m_DebugLayers.insert(std::end(m_DebugLayers), std::begin(newDebugLayers), std::end(newDebugLayers));
-    }
-}
-
-void DynamicQuantizationVisitor::RemoveDebugLayers()
-{
-    for (DebugLayer* debugLayer : m_DebugLayers)
-    {
-        OutputSlot& proceedingOutputSlot = *debugLayer->GetInputSlot(0).GetConnectedOutputSlot();
-        InputSlot& succeedingInputSlot = *debugLayer->GetOutputSlot(0).GetConnection(0);
-        proceedingOutputSlot.Disconnect(debugLayer->GetInputSlot(0));
-        debugLayer->GetOutputSlot(0).Disconnect(succeedingInputSlot);
-
-        m_Graph.EraseLayer(debugLayer);
-
-        proceedingOutputSlot.Connect(succeedingInputSlot);
-    }
-    m_DebugLayers.clear();
-}
-
 void DynamicQuantizationVisitor::VisitNonCalibratedLayers() {
-    RemoveDebugLayers();
     for (const IConnectableLayer* layer : m_LayersNotToCalibrate)
     {
         ForwardParentParameters(layer);
     }
 }
 
+bool DynamicQuantizationVisitor::IsCalibrated(LayerGuid guid) const
+{
+    return m_LayersToCalibrate.find(guid) != m_LayersToCalibrate.end();
+}
+
 void DynamicQuantizationVisitor::VisitAdditionLayer(const IConnectableLayer* layer, const char* name)
 {
     SetRange(layer, 0, -20.f, 20.f);
@@ -7,11 +7,12 @@
 
 #include "armnn/LayerVisitorBase.hpp"
 #include "RangeTracker.hpp"
-#include "layers/DebugLayer.hpp"
 
 #include <armnn/INetwork.hpp>
 #include <armnnQuantizer/INetworkQuantizer.hpp>
 
+#include <unordered_set>
+
 namespace armnn
 {
 
@@ -19,7 +20,7 @@ namespace armnn
 class DynamicQuantizationVisitor : public LayerVisitorBase<VisitorNoThrowPolicy>
 {
 public:
-    DynamicQuantizationVisitor(RangeTracker& rangeTracker, Graph& graph);
+    DynamicQuantizationVisitor(RangeTracker& rangeTracker);
     ~DynamicQuantizationVisitor() = default;
 
     /// Functions to set the Range on a per-layer-type basis
@@ -107,9 +108,11 @@ public:
                           LayerBindingId id,
                           const char* name = nullptr) override;
 
-    void FinishVisit() override;
     void VisitNonCalibratedLayers();
 
+    /// Whether the range of the outputs of a layer is calibrated from the values they take during inference
+    bool IsCalibrated(LayerGuid guid) const;
+
     const std::vector<armnn::LayerBindingId>& GetOutputLayers();
 
 private:
@@ -121,17 +124,13 @@ private:
     /// Mapping from a layer Guid to an array of ranges for outputs
     RangeTracker& m_RangeTracker;
 
-    Graph& m_Graph;
-
-    std::vector<const IConnectableLayer*> m_LayersToCalibrate;
+    std::unordered_set<LayerGuid> m_LayersToCalibrate;
     std::vector<const IConnectableLayer*> m_LayersNotToCalibrate;
-    std::vector<DebugLayer*> m_DebugLayers;
 
     std::vector<armnn::LayerBindingId> m_OutputLayers;
 
     void AddToCalibratedLayers(const IConnectableLayer* layer);
     void AddToNonCalibratedLayers(const IConnectableLayer* layer);
-    void RemoveDebugLayers();
 };
 
 } //namespace armnn
\ No newline at end of file
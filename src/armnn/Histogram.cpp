@@ -0,0 +1,310 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Narrowest window, in bins, that the search for the range minimizing the quantization error goes down to.
+constexpr unsigned int g_MinSearchWindowBins = 128;
+
+/// Adds counts gathered over the bins of [min, max] to the bins of [targetMin, targetMax], which must cover it.
+/// Values are assumed to be spread uniformly within each bin, so a bin overlapping several target bins is split
+/// between them in proportion to the overlap.
+void AddRebinned(const std::vector<double>& counts,
+                 float min,
+                 float max,
+                 std::vector<double>& targetCounts,
+                 float targetMin,
+                 float targetMax)
+{
+    const double targetBinWidth = (static_cast<double>(targetMax) - targetMin) / g_HistogramNumBins;
+    const auto toTargetBins = [&](double value)
+    {
+        return targetBinWidth > 0.0 ? (value - targetMin) / targetBinWidth : 0.0;
+    };
+
+    if (max == min)
+    {
+        // All the values are equal to min
+        const double bin = std::min(toTargetBins(min), static_cast<double>(g_HistogramNumBins - 1));
+        targetCounts[static_cast<unsigned int>(bin)] += std::accumulate(counts.begin(), counts.end(), 0.0);
+        return;
+    }
+
+    const double binWidth = (static_cast<double>(max) - min) / g_HistogramNumBins;
+    for (unsigned int i = 0; i < g_HistogramNumBins; ++i)
+    {
+        if (counts[i] == 0.0)
+        {
+            continue;
+        }
+
+        const double begin = toTargetBins(min + i * binWidth);
+        const double end   = toTargetBins(min + (i + 1) * binWidth);
+        for (unsigned int j = static_cast<unsigned int>(begin); j < g_HistogramNumBins && j < end; ++j)
+        {
+            const double overlap = std::min(end, j + 1.0) - std::max(begin, static_cast<double>(j));
+            targetCounts[j] += counts[i] * overlap / (end - begin);
+        }
+    }
+}
+
+} // anonymous namespace
+
+void Histogram::Add(const float* values, unsigned int numElements, float min, float max)
+{
+    if (numElements == 0)
+    {
+        return;
+    }
+
+    if (IsEmpty())
+    {
+        m_Min = min;
+        m_Max = max;
+        m_Counts.assign(g_HistogramNumBins, 0.0);
+    }
+    else if (min < m_Min || max > m_Max)
+    {
+        Widen(min, max);
+    }
+
+    if (m_Max == m_Min)
+    {
+        m_Counts[0] += numElements;
+        return;
+    }
+
+    const float binsPerUnit = static_cast<float>(g_HistogramNumBins) / (m_Max - m_Min);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        const auto bin = static_cast<unsigned int>((values[i] - m_Min) * binsPerUnit);
+        m_Counts[std::min(bin, g_HistogramNumBins - 1)] += 1.0;
+    }
+}
+
+void Histogram::Merge(const Histogram& other)
+{
+    if (other.IsEmpty())
+    {
+        return;
+    }
+
+    if (IsEmpty())
+    {
+        *this = other;
+        return;
+    }
+
+    if (other.m_Min < m_Min || other.m_Max > m_Max)
+    {
+        Widen(other.m_Min, other.m_Max);
+    }
+    AddRebinned(other.m_Counts, other.m_Min, other.m_Max, m_Counts, m_Min, m_Max);
+}
+
+void Histogram::Widen(float min, float max)
+{
+    const float newMin = std::min(min, m_Min);
+    const float newMax = std::max(max, m_Max);
+
+    std::vector<double> counts(g_HistogramNumBins, 0.0);
+    AddRebinned(m_Counts, m_Min, m_Max, counts, newMin, newMax);
+
+    m_Min = newMin;
+    m_Max = newMax;
+    m_Counts.swap(counts);
+}
+
+Histogram::MinMaxRange Histogram::SelectRange(CalibrationMethod method,
+                                              float percentile,
+                                              unsigned int numQuantizedLevels) const
+{
+    if (IsEmpty() || m_Max == m_Min)
+    {
+        return std::make_pair(m_Min, m_Max);
+    }
+
+    switch (method)
+    {
+        case CalibrationMethod::Percentile:
+        {
+            const double fraction = percentile / 100.0;
+            return std::make_pair(GetQuantile(1.0 - fraction), GetQuantile(fraction));
+        }
+        case CalibrationMethod::Entropy:
+        case CalibrationMethod::Mse:
+            return SearchRange(method, numQuantizedLevels);
+        case CalibrationMethod::MinMax:
+        default:
+            return std::make_pair(m_Min, m_Max);
+    }
+}
+
+float Histogram::GetQuantile(double fraction) const
+{
+    const double target = fraction * std::accumulate(m_Counts.begin(), m_Counts.end(), 0.0);
+
+    double cumulativeCount = 0.0;
+    for (unsigned int i = 0; i < g_HistogramNumBins; ++i)
+    {
+        if (m_Counts[i] > 0.0 && cumulativeCount + m_Counts[i] >= target)
+        {
+            const double withinBin = std::max(0.0, (target - cumulativeCount) / m_Counts[i]);
+            return m_Min + static_cast<float>((i + withinBin) * GetBinWidth());
+        }
+        cumulativeCount += m_Counts[i];
+    }
+    return m_Max;
+}
+
+Histogram::MinMaxRange Histogram::SearchRange(CalibrationMethod method, unsigned int numQuantizedLevels) const
+{
+    const auto getCost = [&](unsigned int firstBin, unsigned int lastBin)
+    {
+        return method == CalibrationMethod::Entropy ? GetKlDivergence(firstBin, lastBin, numQuantizedLevels)
+                                                    : GetQuantizationError(firstBin, lastBin, numQuantizedLevels);
+    };
+
+    // The window covers the bins [firstBin, lastBin)
+    unsigned int firstBin = 0;
+    unsigned int lastBin = g_HistogramNumBins;
+    unsigned int bestFirstBin = firstBin;
+    unsigned int bestLastBin = lastBin;
+    double bestCost = getCost(firstBin, lastBin);
+
+    while (lastBin - firstBin > g_MinSearchWindowBins)
+    {
+        if (m_Counts[firstBin] <= m_Counts[lastBin - 1])
+        {
+            ++firstBin;
+        }
+        else
+        {
+            --lastBin;
+        }
+
+        const double cost = getCost(firstBin, lastBin);
+        if (cost < bestCost)
+        {
+            bestCost = cost;
+            bestFirstBin = firstBin;
+            bestLastBin = lastBin;
+        }
+    }
+
+    const float binWidth = GetBinWidth();
+    return std::make_pair(m_Min + static_cast<float>(bestFirstBin) * binWidth,
+                          m_Min + static_cast<float>(bestLastBin) * binWidth);
+}
+
+double Histogram::GetQuantizationError(unsigned int firstBin,
+                                       unsigned int lastBin,
+                                       unsigned int numQuantizedLevels) const
+{
+    const double binWidth = GetBinWidth();
+
+    // The quantization schemes always keep zero in range
+    const double min = std::min(0.0, m_Min + firstBin * binWidth);
+    const double max = std::max(0.0, m_Min + lastBin * binWidth);
+    const double step = (max - min) / (numQuantizedLevels - 1);
+
+    // Values in range are rounded to the nearest level, with an error uniformly distributed in [-step/2, step/2],
+    // while values out of range are clamped to it
+    const double roundingError = step * step / 12.0;
+
+    double error = 0.0;
+    for (unsigned int i = 0; i < g_HistogramNumBins; ++i)
+    {
+        if (m_Counts[i] == 0.0)
+        {
+            continue;
+        }
+
+        const double value = m_Min + (i + 0.5) * binWidth;
+        if (value < min)
+        {
+            error += m_Counts[i] * (min - value) * (min - value);
+        }
+        else if (value > max)
+        {
+            error += m_Counts[i] * (value - max) * (value - max);
+        }
+        else
+        {
+            error += m_Counts[i] * roundingError;
+        }
+    }
+    return error;
+}
+
+double Histogram::GetKlDivergence(unsigned int firstBin,
+                                  unsigned int lastBin,
+                                  unsigned int numQuantizedLevels) const
+{
+    const unsigned int numBins = lastBin - firstBin;
+
+    // Reference distribution: the values in the window, with the values out of it clamped to its outer bins
+    std::vector<double> reference(m_Counts.begin() + firstBin, m_Counts.begin() + lastBin);
+    reference.front() += std::accumulate(m_Counts.begin(), m_Counts.begin() + firstBin, 0.0);
+    reference.back()  += std::accumulate(m_Counts.begin() + lastBin, m_Counts.end(), 0.0);
+
+    // Quantized distribution: the values in the window merged into numQuantizedLevels levels, each spread evenly
+    // over the non-empty bins it covers
+    const unsigned int numLevels = std::min(numQuantizedLevels, numBins);
+    std::vector<double> quantized(numBins, 0.0);
+    for (unsigned int level = 0; level < numLevels; ++level)
+    {
+        const unsigned int begin = firstBin + level * numBins / numLevels;
+        const unsigned int end   = firstBin + (level + 1) * numBins / numLevels;
+
+        double count = 0.0;
+        unsigned int numNonEmptyBins = 0;
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            count += m_Counts[i];
+            numNonEmptyBins += m_Counts[i] > 0.0 ? 1u : 0u;
+        }
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            quantized[i - firstBin] = m_Counts[i] > 0.0 ? count / numNonEmptyBins : 0.0;
+        }
+    }
+
+    const double referenceTotal = std::accumulate(reference.begin(), reference.end(), 0.0);
+    const double quantizedTotal = std::accumulate(quantized.begin(), quantized.end(), 0.0);
+    if (quantizedTotal == 0.0)
+    {
+        return std::numeric_limits<double>::max();
+    }
+
+    // Values of the reference that the quantized distribution misses are given a tiny probability, rather than
+    // making the divergence infinite
+    constexpr double epsilon = 1e-10;
+
+    double divergence = 0.0;
+    for (unsigned int i = 0; i < numBins; ++i)
+    {
+        if (reference[i] > 0.0)
+        {
+            const double p = reference[i] / referenceTotal;
+            const double q = std::max(quantized[i] / quantizedTotal, epsilon);
+            divergence += p * std::log(p / q);
+        }
+    }
+    return divergence;
+}
+
+} //namespace armnn
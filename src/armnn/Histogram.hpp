@@ -0,0 +1,65 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnnQuantizer/INetworkQuantizer.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+/// Number of bins the range of a Histogram is split into.
+constexpr unsigned int g_HistogramNumBins = 2048;
+
+/// Histogram of the values a tensor takes over a set of calibration inferences. Its range grows to cover all the
+/// values added to it, redistributing the counts already gathered over the wider bins.
+class Histogram
+{
+public:
+    using MinMaxRange = std::pair<float, float>;
+
+    bool IsEmpty() const { return m_Counts.empty(); }
+
+    float GetMin() const { return m_Min; }
+    float GetMax() const { return m_Max; }
+
+    const std::vector<double>& GetCounts() const { return m_Counts; }
+
+    /// Adds numElements values, whose smallest and largest are min and max.
+    void Add(const float* values, unsigned int numElements, float min, float max);
+
+    /// Adds the counts of another histogram.
+    void Merge(const Histogram& other);
+
+    /// Returns the range to quantize the values to, with numQuantizedLevels levels, according to a calibration
+    /// method. The percentile is used by CalibrationMethod::Percentile only.
+    MinMaxRange SelectRange(CalibrationMethod method, float percentile, unsigned int numQuantizedLevels) const;
+
+private:
+    /// Rebins the counts over a range that covers both the current one and [min, max].
+    void Widen(float min, float max);
+
+    float GetBinWidth() const { return (m_Max - m_Min) / static_cast<float>(g_HistogramNumBins); }
+
+    /// Returns the value below which a fraction of the values lie, interpolating within the bins.
+    float GetQuantile(double fraction) const;
+
+    /// Returns the range that minimizes a cost among the windows of bins obtained by repeatedly dropping the
+    /// lighter of the two outer bins. The cost of a window is the mean squared quantization error (MSE) or the
+    /// Kullback-Leibler divergence (Entropy) between the values and their quantized counterparts.
+    MinMaxRange SearchRange(CalibrationMethod method, unsigned int numQuantizedLevels) const;
+
+    double GetQuantizationError(unsigned int firstBin, unsigned int lastBin, unsigned int numQuantizedLevels) const;
+    double GetKlDivergence(unsigned int firstBin, unsigned int lastBin, unsigned int numQuantizedLevels) const;
+
+    float m_Min = 0.0f;
+    float m_Max = 0.0f;
+    std::vector<double> m_Counts;
+};
+
+} //namespace armnn
@@ -14,9 +14,11 @@
 #include "InternalTypes.hpp"
 #include "SerializeLayerParameters.hpp"
 
+#include <armnn/Descriptors.hpp>
 #include <armnn/Types.hpp>
 #include <armnn/Tensor.hpp>
 #include <armnn/INetwork.hpp>
+#include <armnn/Optional.hpp>
 
 #include <algorithm>
 #include <memory>
@@ -263,6 +265,10 @@ public:
     const BackendId& GetBackendId() const { return m_BackendId; }
     void SetBackendId(const BackendId& id) { m_BackendId = id; }
 
+    /// The activation applied to the output of this layer, set when an ActivationLayer has been fused into it.
+    const Optional<ActivationDescriptor>& GetFusedActivation() const { return m_FusedActivation; }
+    void SetFusedActivation(const ActivationDescriptor& activation) { m_FusedActivation = activation; }
+
     // Virtuals
 
     virtual std::unique_ptr<IWorkload> CreateWorkload(const Graph& graph, const IWorkloadFactory& factory) const = 0;
@@ -346,6 +352,7 @@ protected:
         WorkloadInfo info;
         CollectQueueDescriptorInputs(descriptor, info, graph);
         CollectQueueDescriptorOutputs(descriptor, info, graph);
+        descriptor.m_FusedActivation = m_FusedActivation;
         return info;
     }
 
@@ -371,6 +378,7 @@ private:
 
     const LayerType m_Type;
     BackendId m_BackendId;
+    Optional<ActivationDescriptor> m_FusedActivation;
 
     /// Used for sorting.
     mutable LayerPriority m_Priority = 0;
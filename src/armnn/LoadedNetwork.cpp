@@ -175,6 +175,7 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                 }
 
                 m_WorkloadQueue.push_back(move(workload));
+                m_WorkloadLayers.push_back(layer);
                 // release the constant data in the layer..
                 layer->ReleaseConstantData();
                 break;
@@ -589,9 +590,22 @@ bool LoadedNetwork::Execute()
             input->Execute();
         }
 
-        for (auto& workload : m_WorkloadQueue)
+        if (m_TensorObserver)
         {
-            workload->Execute();
+            for (const BindableLayer* inputLayer : m_OptimizedNetwork->GetGraph().GetInputLayers())
+            {
+                ObserveOutputs(*inputLayer);
+            }
+        }
+
+        for (unsigned int i = 0; i < m_WorkloadQueue.size(); ++i)
+        {
+            m_WorkloadQueue[i]->Execute();
+
+            if (m_TensorObserver)
+            {
+                ObserveOutputs(*m_WorkloadLayers[i]);
+            }
         }
 
         for (auto& output: m_OutputQueue)
@@ -619,4 +633,17 @@ void LoadedNetwork::RegisterDebugCallback(const DebugCallbackFunction& func)
     }
 }
 
+void LoadedNetwork::RegisterTensorObserver(const TensorObserverFunction& func)
+{
+    m_TensorObserver = func;
+}
+
+void LoadedNetwork::ObserveOutputs(const Layer& layer)
+{
+    for (unsigned int slotIndex = 0; slotIndex < layer.GetNumOutputSlots(); ++slotIndex)
+    {
+        m_TensorObserver(layer.GetGuid(), slotIndex, layer.GetOutputHandler(slotIndex).GetData());
+    }
+}
+
 }
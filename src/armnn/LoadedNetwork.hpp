@@ -53,6 +53,8 @@ public:
 
     void RegisterDebugCallback(const DebugCallbackFunction& func);
 
+    void RegisterTensorObserver(const TensorObserverFunction& func);
+
 private:
     void AllocateWorkingMemory();
 
@@ -64,6 +66,9 @@ private:
 
     bool Execute();
 
+    /// Calls m_TensorObserver for each output slot of a layer that has executed.
+    void ObserveOutputs(const Layer& layer);
+
     const IWorkloadFactory& GetWorkloadFactory(const Layer& layer) const;
 
     using BackendPtrMap = std::unordered_map<BackendId, IBackendInternalUniquePtr>;
@@ -80,6 +85,11 @@ private:
     WorkloadQueue m_InputQueue;
     WorkloadQueue m_WorkloadQueue;
     WorkloadQueue m_OutputQueue;
+
+    /// The layer each workload of m_WorkloadQueue was created for
+    std::vector<const Layer*> m_WorkloadLayers;
+
+    TensorObserverFunction m_TensorObserver;
     std::shared_ptr<Profiler> m_Profiler;
 
     mutable std::mutex m_WorkingMemMutex;
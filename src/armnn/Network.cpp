@@ -25,6 +25,7 @@
 #include <fcntl.h>
 #include <algorithm>
 #include <fstream>
+#include <map>
 #include <memory>
 #include <vector>
 #include <algorithm>
@@ -315,6 +316,108 @@ OptimizationResult AssignBackends(OptimizedNetwork* optNetObjPtr,
                           errMessages);
 }
 
+using Fp32WeightsMap = std::map<const Layer*, std::unique_ptr<ScopedCpuTensorHandle>>;
+
+/// Returns copies of the Float32 weights of the Convolution2d and FullyConnected layers that
+/// Fp32NetworkToBf16Converter reduces, which rounds them to BFloat16.
+Fp32WeightsMap CopyWeightsReducibleToBf16(Graph& graph)
+{
+    Fp32WeightsMap fp32Weights;
+    for (auto&& layer : graph)
+    {
+        std::unique_ptr<ScopedCpuTensorHandle>* weights = GetWeightsHandle(*layer);
+        if (weights && *weights && layer->GetDataType() == DataType::Float32)
+        {
+            fp32Weights.emplace(layer, std::make_unique<ScopedCpuTensorHandle>(**weights));
+        }
+    }
+    return fp32Weights;
+}
+
+/// Keeps in Float32 the Convolution2d and FullyConnected layers reduced to BFloat16 by Fp32NetworkToBf16Converter
+/// when the first preferred backend able to run them does not run them in BFloat16, or when no preferred backend
+/// runs the Fp32 -> Bf16 conversions of their inputs. These layers get back their original weights from
+/// fp32Weights, and the conversion layers are removed.
+void RevertUnsupportedBf16Reductions(Graph& graph, const BackendSettings& backendSettings,
+                                     Fp32WeightsMap& fp32Weights)
+{
+    auto availablePreferredBackends = backendSettings.GetAvailablePreferredBackends();
+    std::string reasonIfUnsupported;
+
+    auto IsSupportedOnAnyBackend = [&](Layer* layer)
+    {
+        for (const auto& backend : availablePreferredBackends)
+        {
+            layer->SetBackendId(backend);
+            if (IWorkloadFactory::IsLayerSupported(*layer, EmptyOptional(), reasonIfUnsupported))
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    auto IsSupportedInBf16 = [&](Layer* layer)
+    {
+        for (const auto& backend : availablePreferredBackends)
+        {
+            layer->SetBackendId(backend);
+            if (IWorkloadFactory::IsLayerSupported(*layer, EmptyOptional(), reasonIfUnsupported))
+            {
+                return true;
+            }
+            if (IWorkloadFactory::IsLayerSupported(*layer, DataType::Float32, reasonIfUnsupported))
+            {
+                return false;
+            }
+        }
+        // Unsupported in either type: AssignBackends reports it
+        return true;
+    };
+
+    std::vector<Layer*> reducedLayers;
+    for (auto&& layer : graph)
+    {
+        if ((layer->GetType() == LayerType::Convolution2d || layer->GetType() == LayerType::FullyConnected) &&
+            layer->GetDataType() == DataType::BFloat16)
+        {
+            reducedLayers.push_back(layer);
+        }
+    }
+
+    for (Layer* layer : reducedLayers)
+    {
+        std::vector<ConvertFp32ToBf16Layer*> convertLayers;
+        for (auto&& inputSlot = layer->BeginInputSlots(); inputSlot != layer->EndInputSlots(); ++inputSlot)
+        {
+            Layer& parent = inputSlot->GetConnectedOutputSlot()->GetOwningLayer();
+            if (parent.GetType() == LayerType::ConvertFp32ToBf16)
+            {
+                convertLayers.push_back(boost::polymorphic_downcast<ConvertFp32ToBf16Layer*>(&parent));
+            }
+        }
+
+        // Only the layers the converter reduced are reverted, not those given BFloat16 inputs by the network
+        if (convertLayers.size() != layer->GetNumInputSlots() ||
+            (IsSupportedInBf16(layer) &&
+             std::all_of(convertLayers.begin(), convertLayers.end(), IsSupportedOnAnyBackend)))
+        {
+            continue;
+        }
+
+        auto originalWeights = fp32Weights.find(layer);
+        if (originalWeights != fp32Weights.end())
+        {
+            *GetWeightsHandle(*layer) = std::move(originalWeights->second);
+        }
+        for (ConvertFp32ToBf16Layer* convertLayer : convertLayers)
+        {
+            convertLayer->GetOutputSlot().MoveAllConnections(*convertLayer->GetInputSlot(0).GetConnectedOutputSlot());
+            graph.EraseLayer(convertLayer);
+        }
+    }
+}
+
 BackendsMap CreateSupportedBackends(TensorHandleFactoryRegistry& handleFactoryRegistry,
                                     BackendSettings& backendSettings)
 {
@@ -800,6 +903,11 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         throw armnn::InvalidArgumentException("Invoked Optimize with no backends specified");
     }
 
+    if (options.m_ReduceFp32ToFp16 && options.m_ReduceFp32ToBf16)
+    {
+        throw armnn::InvalidArgumentException("Invoked Optimize with both Fp16 and Bf16 reductions set");
+    }
+
     const Network& network = *boost::polymorphic_downcast<const Network*>(&inNetwork);
     std::unique_ptr<Graph> graph = std::make_unique<Graph>(network.GetGraph());
 
@@ -812,14 +920,22 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
 
     // Perform optimisation passes
     using namespace optimizations;
-    Optimizer::Pass(optGraph, MakeOptimizations(SquashEqualPermuteSiblings(),
-                                                SquashEqualReshapeSiblings(),
-                                                OptimizeInversePermutes(),
-                                                MovePermuteUp(),
-                                                PermuteAsReshape(),
-                                                OptimizeConsecutiveReshapes(),
-                                                FoldPadIntoConvolution2d(),
-                                                PermuteAndBatchToSpaceAsDepthToSpace()));
+    Optimizer::Optimizations graphOptimizations = MakeOptimizations(SquashEqualPermuteSiblings(),
+                                                                    SquashEqualReshapeSiblings(),
+                                                                    OptimizeInversePermutes(),
+                                                                    MovePermuteUp(),
+                                                                    PermuteAsReshape(),
+                                                                    OptimizeConsecutiveReshapes(),
+                                                                    FoldPadIntoConvolution2d(),
+                                                                    PermuteAndBatchToSpaceAsDepthToSpace());
+    if (!options.m_DisableLayerFusion)
+    {
+        Append(graphOptimizations,
+               FuseBatchNormalizationIntoConvolution2d(),
+               FuseBatchNormalizationIntoDepthwiseConvolution2d(),
+               FuseBatchNormalizationIntoFullyConnected());
+    }
+    Optimizer::Pass(optGraph, graphOptimizations);
 
     // Infer the tensor infos for all output slots. Throws an exception on failure
     optGraph.InferTensorInfos();
@@ -830,6 +946,15 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         Optimizer::Pass(optGraph, MakeOptimizations(Fp32NetworkToFp16Converter()));
     }
 
+    // If Fp32 to Bf16 optimization is set convert the inputs and weights of the Fp32 convolutions and
+    // fully connected layers to Bf16, keeping their Fp32 weights until a backend is known to run them in Bf16
+    Fp32WeightsMap fp32Weights;
+    if (options.m_ReduceFp32ToBf16)
+    {
+        fp32Weights = CopyWeightsReducibleToBf16(optGraph);
+        Optimizer::Pass(optGraph, MakeOptimizations(Fp32NetworkToBf16Converter()));
+    }
+
     // Initialize backend settings
     BackendSettings backendSettings(backendPreferences, deviceSpec);
     if (backendSettings.GetAvailablePreferredBackends().empty())
@@ -841,6 +966,12 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
     }
 
+    if (options.m_ReduceFp32ToBf16)
+    {
+        RevertUnsupportedBf16Reductions(optGraph, backendSettings, fp32Weights);
+        fp32Weights.clear();
+    }
+
     // Create a map to temporarily hold initialized backend objects
     TensorHandleFactoryRegistry tensorHandleFactoryRegistry;
     BackendsMap backends = CreateSupportedBackends(tensorHandleFactoryRegistry, backendSettings);
@@ -860,7 +991,8 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
     }
 
     Optimizer::Pass(optGraph, MakeOptimizations(OptimizeInverseConversionsFp16(),
-                                                OptimizeInverseConversionsFp32()));
+                                                OptimizeInverseConversionsFp32(),
+                                                OptimizeInverseConversionsBf16()));
 
     // Apply the backend-specific optimizations
     OptimizationResult backendOptimizationResult = ApplyBackendOptimizations(optNetObjPtr,
@@ -873,6 +1005,12 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
     }
 
+    // Fuse activations into the layers producing their input, where the assigned backend supports it
+    if (!options.m_DisableLayerFusion)
+    {
+        Optimizer::Pass(optGraph, MakeOptimizations(FuseActivation(backends)));
+    }
+
     // If the debug flag is set, then insert a DebugLayer after each layer
     // Doing this after applying the backend optimizations as they might have changed some layers
     if (options.m_Debug)
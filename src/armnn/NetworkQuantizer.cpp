@@ -21,8 +21,12 @@
 #include "QuantizerVisitor.hpp"
 #include "OverrideInputRangeVisitor.hpp"
 
-#include <vector>
+#include <algorithm>
 #include <cmath>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <boost/variant.hpp>
 
@@ -35,6 +39,14 @@ using TContainer = boost::variant<std::vector<float>, std::vector<int>, std::vec
 
 INetworkQuantizer* INetworkQuantizer::CreateRaw(INetwork* inputNetwork, const QuantizerOptions& options)
 {
+    // Below 50 the lower quantile would exceed the upper one, inverting the selected ranges
+    if (options.m_CalibrationMethod == CalibrationMethod::Percentile &&
+        !(options.m_CalibrationPercentile > 50.0f && options.m_CalibrationPercentile <= 100.0f))
+    {
+        throw InvalidArgumentException("Calibration percentile " + std::to_string(options.m_CalibrationPercentile) +
+                                       " is not in (50, 100]");
+    }
+
     return new NetworkQuantizer(inputNetwork, options);
 }
 
@@ -60,84 +72,209 @@ void NetworkQuantizer::OverrideInputRange(LayerBindingId layerId, float min, flo
 
 void NetworkQuantizer::Refine(const InputTensors& inputTensors)
 {
+    Refine(std::vector<InputTensors>{ inputTensors });
+}
+
+void NetworkQuantizer::Refine(const std::vector<InputTensors>& inputTensorsBatch)
+{
+    if (inputTensorsBatch.empty())
+    {
+        return;
+    }
+
     // The first time Refine is called the m_Runtime and the DynamicQuantizationVisitor
-    // will not have been created. Need to get the environment set up, Runtime loaded,
+    // will not have been created. Need to get the environment set up, Runtime created,
     // DynamicQuantizationVisitor created and run over the network to initialise itself
-    // and the RangeTracker the Debug callback registered and an initial inference
-    // done to set up the first min/max values
+    // and the RangeTracker. The network is loaded in the runtime, once for each calibration
+    // context, as the contexts are needed
     if (!m_Runtime)
     {
         m_RefineCount = 0;
         m_Ranges.SetDynamicMode(true);
-        const Graph& cGraph = boost::polymorphic_downcast<const Network*>(m_InputNetwork)->GetGraph().TopologicalSort();
-
-        // need to insert Debug layers in the DynamicQuantizationVisitor
-        Graph& graph = const_cast<Graph&>(cGraph);
+        m_Ranges.SetHistogramMode(m_Options.m_CalibrationMethod != CalibrationMethod::MinMax);
+        const Graph& graph = boost::polymorphic_downcast<const Network*>(m_InputNetwork)->GetGraph().TopologicalSort();
 
         // Initialize RangeTracker to the default values for each layer.
         // The default values are overwritten by the min/max that is
         // recorded during the first dataset min/max calibration. This
         // initialisation is only required for the first call of Refine().
-        m_DynamicQuantizationVisitor = DynamicQuantizationVisitor(m_Ranges, graph);
-        VisitLayers(cGraph, m_DynamicQuantizationVisitor.value());
+        m_DynamicQuantizationVisitor = DynamicQuantizationVisitor(m_Ranges);
+        VisitLayers(graph, m_DynamicQuantizationVisitor.value());
 
         IRuntime::CreationOptions options;
         m_Runtime = IRuntime::Create(options);
+    }
+
+    unsigned int numContexts = m_Options.m_NumCalibrationThreads;
+    if (numContexts == 0)
+    {
+        numContexts = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numContexts = std::min(numContexts, static_cast<unsigned int>(inputTensorsBatch.size()));
+    AddCalibrationContexts(numContexts);
+
+    // Each context takes the next inference of the batch as soon as it is done with the previous one
+    std::atomic<unsigned int> nextInput(0);
+    if (numContexts == 1)
+    {
+        RunCalibration(*m_CalibrationContexts[0], inputTensorsBatch, nextInput);
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        std::vector<std::exception_ptr> exceptions(numContexts);
+        for (unsigned int i = 0; i < numContexts; ++i)
+        {
+            threads.emplace_back([&, i]()
+            {
+                try
+                {
+                    RunCalibration(*m_CalibrationContexts[i], inputTensorsBatch, nextInput);
+                }
+                catch (...)
+                {
+                    exceptions[i] = std::current_exception();
+                }
+            });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+        for (const std::exception_ptr& exception : exceptions)
+        {
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+        }
+    }
 
-        // Optimize network - debug already enabled for layers that require quantization
-        OptimizerOptions optimizerOptions(false, false);
+    // Merge the ranges observed by each context. The ranges of the first calibration dataset
+    // replace the default values
+    for (unsigned int i = 0; i < numContexts; ++i)
+    {
+        const CalibrationContext& context = *m_CalibrationContexts[i];
+        if (context.m_RefineCount == 0)
+        {
+            continue;
+        }
+
+        if (m_RefineCount == 0)
+        {
+            m_Ranges = context.m_Ranges;
+        }
+        else
+        {
+            m_Ranges.Merge(context.m_Ranges);
+        }
+        m_RefineCount += context.m_RefineCount;
+    }
+}
+
+void NetworkQuantizer::AddCalibrationContexts(unsigned int numContexts)
+{
+    while (m_CalibrationContexts.size() < numContexts)
+    {
+        // Optimize network - without fusing the layers, as the outputs of all the layers that require
+        // quantization must be observed
+        OptimizerOptions optimizerOptions(false, false, false, true);
         std::vector<BackendId> backends = {"CpuRef"};
         IOptimizedNetworkPtr optimizedNet = Optimize(*m_InputNetwork,
                                                      backends,
                                                      m_Runtime->GetDeviceSpec(),
                                                      optimizerOptions);
 
-        m_Runtime->LoadNetwork(m_NetworkId, std::move(optimizedNet));
+        auto context = std::make_unique<CalibrationContext>();
+        context->m_Ranges = m_Ranges;
+        context->m_RefineCount = 0;
+        m_Runtime->LoadNetwork(context->m_NetworkId, std::move(optimizedNet));
+
+        // Tensor observer to refine min/max in the RangeTracker of the context
+        CalibrationContext* contextPtr = context.get();
+        auto rangeTrackerCallback = [this, contextPtr](LayerGuid guid,
+                                                       unsigned int slotIndex,
+                                                       ITensorHandle *tensorHandle) {
+            if (!m_DynamicQuantizationVisitor.value().IsCalibrated(guid))
+            {
+                return;
+            }
 
-        // Debug callback function to refine min/max in RangeTracker
-        auto rangeTrackerCallback = [&](LayerGuid guid, unsigned int slotIndex, ITensorHandle *tensorHandle) {
             // Get min/max pair from tensor data
-            std::pair<float, float> minMax = armnnUtils::FindMinMax(tensorHandle);
+            const float* data = static_cast<const float*>(tensorHandle->Map(true));
+            const unsigned int numElements = tensorHandle->GetShape().GetNumElements();
+            std::pair<float, float> minMax = armnnUtils::FindMinMax(data, numElements);
 
-            // For first calibration dataset, set min/max range in RangeTracker to
+            // For first calibration dataset of the context, set min/max range in its RangeTracker to
             // min/max ranges gathered during inference
-            if (m_RefineCount == 0)
+            RangeTracker& ranges = contextPtr->m_Ranges;
+            if (contextPtr->m_RefineCount == 0)
             {
-                m_Ranges.ResetMinMax(guid, slotIndex, minMax.first, minMax.second);
+                ranges.ResetMinMax(guid, slotIndex, minMax.first, minMax.second);
+                ranges.ResetHistogram(guid, slotIndex);
             }
             else
             {
                 // For every other calibration dataset, only set min/max range if the
                 // values gathered are less than / greater than originally recorded.
-                m_Ranges.RefineMin(guid, slotIndex, minMax.first);
-                m_Ranges.RefineMax(guid, slotIndex, minMax.second);
+                ranges.RefineMin(guid, slotIndex, minMax.first);
+                ranges.RefineMax(guid, slotIndex, minMax.second);
             }
+
+            if (ranges.IsInHistogramMode())
+            {
+                ranges.AddToHistogram(guid, slotIndex, data, numElements, minMax.first, minMax.second);
+            }
+            tensorHandle->Unmap();
         };
 
-        m_Runtime->RegisterDebugCallback(m_NetworkId, rangeTrackerCallback);
+        m_Runtime->RegisterTensorObserver(context->m_NetworkId, rangeTrackerCallback);
+        m_CalibrationContexts.push_back(std::move(context));
     }
+}
 
+void NetworkQuantizer::RunCalibration(CalibrationContext& context,
+                                      const std::vector<InputTensors>& inputTensorsBatch,
+                                      std::atomic<unsigned int>& nextInput)
+{
     // Create output tensor for EnqueueWorkload
     std::vector<armnn::BindingPointInfo> outputBindings;
     auto outputLayers = m_DynamicQuantizationVisitor.value().GetOutputLayers();
     std::vector<TContainer> outputVectors;
     for (auto outputLayerBindingId : outputLayers)
     {
-        auto outputTensorInfo = m_Runtime->GetOutputTensorInfo(m_NetworkId, outputLayerBindingId);
+        auto outputTensorInfo = m_Runtime->GetOutputTensorInfo(context.m_NetworkId, outputLayerBindingId);
         outputBindings.push_back(std::make_pair(outputLayerBindingId, outputTensorInfo));
         outputVectors.push_back(std::vector<float>(outputTensorInfo.GetNumElements(), 0));
     }
     OutputTensors outputTensors = armnnUtils::MakeOutputTensors<TContainer>(outputBindings, outputVectors);
 
-    // Execute EnqueueWorkload with calibration image
-    m_Runtime->EnqueueWorkload(m_NetworkId, inputTensors, outputTensors);
-    ++m_RefineCount;
+    // Execute EnqueueWorkload with each calibration image taken by this context
+    context.m_RefineCount = 0;
+    for (unsigned int i = nextInput++; i < inputTensorsBatch.size(); i = nextInput++)
+    {
+        m_Runtime->EnqueueWorkload(context.m_NetworkId, inputTensorsBatch[i], outputTensors);
+        ++context.m_RefineCount;
+    }
 }
 
 INetworkPtr NetworkQuantizer::ExportNetwork()
 {
     const Graph& graph = boost::polymorphic_downcast<const Network*>(m_InputNetwork)->GetGraph().TopologicalSort();
 
+    std::unique_ptr<IQuantizationScheme> quantizationScheme;
+    switch (m_Options.m_ActivationFormat)
+    {
+        case DataType::QuantisedAsymm8:
+            quantizationScheme = std::make_unique<QAsymm8QuantizationScheme>();
+            break;
+        case DataType::QuantisedSymm16:
+            quantizationScheme = std::make_unique<QSymm16QuantizationScheme>();
+            break;
+        default:
+            throw InvalidArgumentException("Unsupported quantization target");
+    }
+
     // Step 1) Walk the graph and populate default min/max values for
     // intermediate tensors, only if Runtime does not exist (created
     // if Refine has been called)
@@ -149,29 +286,26 @@ INetworkPtr NetworkQuantizer::ExportNetwork()
     }
     else
     {
+        // Select the ranges of the calibrated layers from the histograms of their values, if any
+        const unsigned int numQuantizedLevels = 1u << quantizationScheme->NumBits();
+        m_Ranges.SelectRangesFromHistograms(m_Options.m_CalibrationMethod,
+                                            m_Options.m_CalibrationPercentile,
+                                            numQuantizedLevels);
+
         // Set min/max range of non-calibrated layers to parent layer's range
         m_DynamicQuantizationVisitor.value().VisitNonCalibratedLayers();
         // now tear down the runtime and the dynamic visitor.
+        m_CalibrationContexts.clear();
         m_Runtime.reset(nullptr);
         m_DynamicQuantizationVisitor = EmptyOptional();
         m_RefineCount = 0;
     }
 
     // Step 2) Convert input InputNetwork to Quantized InputNetwork
-    std::unique_ptr<IQuantizationScheme> quantizationScheme;
-    switch (m_Options.m_ActivationFormat)
-    {
-        case DataType::QuantisedAsymm8:
-            quantizationScheme = std::make_unique<QAsymm8QuantizationScheme>();
-            break;
-        case DataType::QuantisedSymm16:
-            quantizationScheme = std::make_unique<QSymm16QuantizationScheme>();
-            break;
-        default:
-            throw InvalidArgumentException("Unsupported quantization target");
-    }
-
-    QuantizerVisitor quantizerVisitor(m_Ranges, quantizationScheme.get(), m_Options.m_PreserveType);
+    QuantizerVisitor quantizerVisitor(m_Ranges,
+                                      quantizationScheme.get(),
+                                      m_Options.m_PreserveType,
+                                      m_Options.m_PerChannelWeights);
     VisitLayers(graph, quantizerVisitor);
 
     // clear the ranges
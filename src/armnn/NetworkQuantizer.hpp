@@ -14,6 +14,10 @@
 #include "DynamicQuantizationVisitor.hpp"
 #include "RangeTracker.hpp"
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 namespace armnn
 {
 
@@ -22,28 +26,46 @@ class NetworkQuantizer : public INetworkQuantizer
 public:
     NetworkQuantizer(INetwork* inputNetwork, const QuantizerOptions& options)
     : m_InputNetwork(inputNetwork),
-      m_NetworkId(0),
       m_Runtime(nullptr, &IRuntime::Destroy),
       m_RefineCount(0),
       m_Options(options) {}
 
     void OverrideInputRange(LayerBindingId layerId, float min, float max) override;
     void Refine(const InputTensors& inputTensors) override;
+    void Refine(const std::vector<InputTensors>& inputTensorsBatch) override;
 
     // Required for testing? Need some way to get min/max in RangeTracker (m_Ranges)
     std::pair<float, float> GetMinMaxRange(LayerGuid guid, unsigned int idx) { return m_Ranges.GetRange(guid, idx); }
     INetworkPtr ExportNetwork() override;
 
 private:
+    /// A copy of the network loaded in m_Runtime, which calibration inferences can run on in parallel with the
+    /// other contexts, recording the ranges they observe in their own RangeTracker
+    struct CalibrationContext
+    {
+        NetworkId m_NetworkId;
+        RangeTracker m_Ranges;
+        // counts the inferences run on this context during the current call of Refine
+        unsigned int m_RefineCount;
+    };
+
+    /// Loads copies of the network until there are at least numContexts calibration contexts
+    void AddCalibrationContexts(unsigned int numContexts);
+
+    /// Runs the calibration inferences of a batch, taking them from nextInput in turn
+    void RunCalibration(CalibrationContext& context,
+                        const std::vector<InputTensors>& inputTensorsBatch,
+                        std::atomic<unsigned int>& nextInput);
+
     /// Original input network to quantize
     INetwork* m_InputNetwork;
 
-    NetworkId m_NetworkId;
-
     // if we are run in dynamic mode this unique pointer will hold
     // the runtime between invocations of the Refine method.
     IRuntimePtr m_Runtime;
 
+    std::vector<std::unique_ptr<CalibrationContext>> m_CalibrationContexts;
+
     Optional<DynamicQuantizationVisitor> m_DynamicQuantizationVisitor;
 
     // counts the number of times refine is called
@@ -54,8 +76,6 @@ private:
 
     /// Options for the NetworkQuantizer
     QuantizerOptions m_Options;
-
-    std::pair<float, float> FindMinMax(ITensorHandle* tensorHandle);
 };
 
 } //namespace armnn
@@ -40,4 +40,48 @@ ConstTensor CreateQuantizedConst(const ConstTensor& tensor, std::vector<uint8_t>
     return ConstTensor(qInfo, backing);
 }
 
+ConstTensor CreatePerAxisQuantizedConst(const ConstTensor& tensor,
+                                        unsigned int quantizationDim,
+                                        std::vector<uint8_t>& backing)
+{
+    const TensorInfo& info = tensor.GetInfo();
+    BOOST_ASSERT_MSG(info.GetDataType() == DataType::Float32, "Can't quantize unsupported data type");
+    BOOST_ASSERT(quantizationDim < info.GetNumDimensions());
+
+    const TensorShape& shape = info.GetShape();
+    const unsigned int numSlices = shape[quantizationDim];
+    unsigned int sliceStride = 1;
+    for (unsigned int d = quantizationDim + 1; d < shape.GetNumDimensions(); ++d)
+    {
+        sliceStride *= shape[d];
+    }
+
+    const float* src = static_cast<const float*>(tensor.GetMemoryArea());
+    const unsigned int numElements = info.GetNumElements();
+
+    // The largest magnitude in each slice maps to 127, so that the range is symmetric and the offset is 0
+    std::vector<float> maxAbs(numSlices, 0.0f);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        float& sliceMax = maxAbs[(i / sliceStride) % numSlices];
+        sliceMax = std::max(sliceMax, std::abs(src[i]));
+    }
+
+    std::vector<float> scales(numSlices);
+    for (unsigned int s = 0; s < numSlices; ++s)
+    {
+        scales[s] = maxAbs[s] > 0.0f ? maxAbs[s] / 127.0f : 1.0f;
+    }
+
+    backing.resize(numElements);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        const int8_t quantized = armnn::Quantize<int8_t>(src[i], scales[(i / sliceStride) % numSlices], 0);
+        backing[i] = static_cast<uint8_t>(quantized);
+    }
+
+    TensorInfo qInfo(shape, DataType::QuantisedSymm8PerAxis, scales, quantizationDim);
+    return ConstTensor(qInfo, backing);
+}
+
 } // namespace armnn
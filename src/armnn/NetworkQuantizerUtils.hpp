@@ -46,6 +46,12 @@ void QuantizeConstant(const srcType* src, uint8_t* dst, size_t numElements, floa
 
 ConstTensor CreateQuantizedConst(const ConstTensor& tensor, std::vector<uint8_t>& backing);
 
+/// Quantizes a float32 tensor to QuantisedSymm8PerAxis, with a symmetric scale for each slice along quantizationDim.
+/// The int8 values are written to the backing as bytes.
+ConstTensor CreatePerAxisQuantizedConst(const ConstTensor& tensor,
+                                        unsigned int quantizationDim,
+                                        std::vector<uint8_t>& backing);
+
 template <typename LayerContainer>
 void VisitLayers(const LayerContainer& layerContainer, ILayerVisitor& visitor)
 {
@@ -10,10 +10,84 @@
 #include <armnn/Exceptions.hpp>
 
 #include <backendsCommon/BackendRegistry.hpp>
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <FloatingPointConverter.hpp>
 
 namespace armnn
 {
 
+namespace
+{
+
+template <typename ConvertLayer>
+std::vector<ConvertLayer*> InsertConvertLayersBefore(Graph& graph,
+                                                     Layer& layer,
+                                                     DataType inputDataType,
+                                                     DataType outputDataType,
+                                                     const char* namePrefix)
+{
+    std::vector<ConvertLayer*> convertLayers;
+    convertLayers.reserve(layer.GetNumInputSlots());
+
+    for (auto&& inputSlot = layer.BeginInputSlots(); inputSlot != layer.EndInputSlots(); ++inputSlot)
+    {
+        // Only the inputs of the type being converted from get a converter layer
+        if (inputSlot->GetConnectedOutputSlot()->GetTensorInfo().GetDataType() != inputDataType)
+        {
+            continue;
+        }
+
+        const std::string name =
+            std::string(namePrefix + std::to_string(inputSlot->GetSlotIndex()) + "-") + layer.GetName();
+        ConvertLayer* convertLayer = graph.InsertNewLayer<ConvertLayer>(*inputSlot, name.c_str());
+
+        // Sets output tensor info for the convert layer
+        TensorInfo convertInfo = convertLayer->GetInputSlot(0).GetConnectedOutputSlot()->GetTensorInfo();
+        convertInfo.SetDataType(outputDataType);
+
+        convertLayer->GetOutputSlot().SetTensorInfo(convertInfo);
+
+        convertLayers.emplace_back(convertLayer);
+    }
+
+    return convertLayers;
+}
+
+std::unique_ptr<ScopedCpuTensorHandle> ConvertTensorDataType(const ScopedCpuTensorHandle& tensor, DataType dataType)
+{
+    TensorInfo info = tensor.GetTensorInfo();
+    info.SetDataType(dataType);
+
+    const size_t numElements = info.GetNumElements();
+    if (dataType == DataType::BFloat16)
+    {
+        std::vector<BFloat16> newValues(numElements);
+        armnnUtils::FloatingPointConverter::ConvertFloat32ToBFloat16(
+            tensor.GetConstTensor<float>(), numElements, newValues.data());
+        return std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, newValues));
+    }
+
+    std::vector<float> newValues(numElements);
+    armnnUtils::FloatingPointConverter::ConvertBFloat16ToFloat32(
+        tensor.GetConstTensor<BFloat16>(), numElements, newValues.data());
+    return std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, newValues));
+}
+
+} // anonymous namespace
+
+std::vector<ConvertBf16ToFp32Layer*> InsertConvertBf16ToFp32LayersBefore(Graph& graph, Layer& layer)
+{
+    return InsertConvertLayersBefore<ConvertBf16ToFp32Layer>(
+        graph, layer, DataType::BFloat16, DataType::Float32, "convert_bf16_to_fp32-");
+}
+
+std::vector<ConvertFp32ToBf16Layer*> InsertConvertFp32ToBf16LayersBefore(Graph& graph, Layer& layer)
+{
+    return InsertConvertLayersBefore<ConvertFp32ToBf16Layer>(
+        graph, layer, DataType::Float32, DataType::BFloat16, "convert_fp32_to_bf16-");
+}
+
 std::vector<ConvertFp16ToFp32Layer*> InsertConvertFp16ToFp32LayersBefore(Graph& graph, Layer& layer)
 {
     std::vector<ConvertFp16ToFp32Layer*> convertLayers;
@@ -80,6 +154,30 @@ std::vector<ConvertFp32ToFp16Layer*> InsertConvertFp32ToFp16LayersAfter(Graph& g
     return convertLayers;
 }
 
+std::unique_ptr<ScopedCpuTensorHandle>* GetWeightsHandle(Layer& layer)
+{
+    switch (layer.GetType())
+    {
+        case LayerType::Convolution2d:
+            return &boost::polymorphic_downcast<Convolution2dLayer*>(&layer)->m_Weight;
+        case LayerType::FullyConnected:
+            return &boost::polymorphic_downcast<FullyConnectedLayer*>(&layer)->m_Weight;
+        default:
+            return nullptr;
+    }
+}
+
+void ConvertWeightsDataType(Layer& layer, DataType dataType)
+{
+    BOOST_ASSERT(dataType == DataType::Float32 || dataType == DataType::BFloat16);
+
+    std::unique_ptr<ScopedCpuTensorHandle>* weight = GetWeightsHandle(layer);
+    if (weight && *weight && (*weight)->GetTensorInfo().GetDataType() != dataType)
+    {
+        *weight = ConvertTensorDataType(**weight, dataType);
+    }
+}
+
 std::vector<DebugLayer*> InsertDebugLayerAfter(Graph& graph, Layer& layer)
 {
     std::vector<DebugLayer*> debugLayers;
@@ -11,10 +11,21 @@
 namespace armnn
 {
 
+std::vector<ConvertBf16ToFp32Layer*> InsertConvertBf16ToFp32LayersBefore(Graph& graph, Layer& layer);
+
+std::vector<ConvertFp32ToBf16Layer*> InsertConvertFp32ToBf16LayersBefore(Graph& graph, Layer& layer);
+
 std::vector<ConvertFp16ToFp32Layer*> InsertConvertFp16ToFp32LayersBefore(Graph& graph, Layer& layer);
 
 std::vector<ConvertFp32ToFp16Layer*> InsertConvertFp32ToFp16LayersAfter(Graph& graph, Layer& layer);
 
+/// Returns the constant weights of a Convolution2d or FullyConnected layer, or nullptr for other layers.
+std::unique_ptr<ScopedCpuTensorHandle>* GetWeightsHandle(Layer& layer);
+
+/// Converts the constant weights of a Convolution2d or FullyConnected layer between Float32 and BFloat16.
+/// Does nothing for other layers, or if the weights already have the requested data type.
+void ConvertWeightsDataType(Layer& layer, DataType dataType);
+
 std::vector<DebugLayer*> InsertDebugLayerAfter(Graph& graph, Layer& layer);
 
 } // namespace armnn
@@ -13,11 +13,13 @@ namespace armnn
 
 QuantizerVisitor::QuantizerVisitor(const RangeTracker& rangeTracker,
                                    const IQuantizationScheme* quantizationScheme,
-                                   bool preserveType)
+                                   bool preserveType,
+                                   bool perChannelWeights)
     : m_Ranges(rangeTracker)
     , m_QuantizedNetwork(INetwork::Create())
     , m_QuantizationScheme(quantizationScheme)
     , m_PreserveType(preserveType)
+    , m_PerChannelWeights(perChannelWeights)
 {
 }
 
@@ -90,18 +92,36 @@ ConstTensor QuantizerVisitor::CreateQuantizedBias(const IConnectableLayer* srcLa
     auto range = m_Ranges.GetRange(layerToFind.GetGuid(), slotIdx);
     OffsetScalePair qParams = m_QuantizationScheme->ComputeScheme(range.first, range.second);
 
+    const float* fp32Values = static_cast<const float*>(biases.value().GetMemoryArea());
+    backing.resize(biases.value().GetInfo().GetNumElements());
+
+    if (weights.GetInfo().HasPerAxisQuantization())
+    {
+        // Each output channel takes the scale of the weights it was computed with
+        const std::vector<float>& weightScales = weights.GetInfo().GetQuantizationScales();
+        const size_t channelsPerWeightScale = backing.size() / weightScales.size();
+
+        std::vector<float> scales(backing.size());
+        for (size_t i = 0; i < backing.size(); ++i)
+        {
+            scales[i] = qParams.first * weightScales[i / channelsPerWeightScale];
+            backing[i] = boost::numeric_cast<int32_t>(fp32Values[i] * ( 1 / scales[i] ));
+        }
+
+        TensorInfo qInfo(biases.value().GetInfo().GetShape(), DataType::Signed32, scales, 0);
+        return ConstTensor(qInfo, backing);
+    }
+
     // Get the quantization scale based on input and weight scale
     float scale = qParams.first * weights.GetInfo().GetQuantizationScale();
 
     // Set up quantized bias tensor info and allocate space
     TensorInfo qInfo(biases.value().GetInfo().GetShape(), DataType::Signed32, scale, 0);
-    backing.resize(biases.value().GetInfo().GetNumElements());
 
     // Convert values to int32
     for (size_t i = 0; i < backing.size(); ++i)
     {
-        float fp32Value = static_cast<const float*>(biases.value().GetMemoryArea())[i];
-        backing[i] = boost::numeric_cast<int32_t>(fp32Value * ( 1 / scale ));
+        backing[i] = boost::numeric_cast<int32_t>(fp32Values[i] * ( 1 / scale ));
     }
 
     return ConstTensor(qInfo, backing);
@@ -212,7 +232,9 @@ void QuantizerVisitor::VisitConvolution2dLayer(const IConnectableLayer* layer,
                                                const char* name)
 {
     std::vector<uint8_t> weightsBacking;
-    ConstTensor qWeights = CreateQuantizedConst(weights, weightsBacking);
+    ConstTensor qWeights = m_PerChannelWeights ?
+                           CreatePerAxisQuantizedConst(weights, 0, weightsBacking) :
+                           CreateQuantizedConst(weights, weightsBacking);
     Optional<ConstTensor> optionalQBiases;
     std::vector<int32_t> biasesBacking;
 
@@ -246,8 +268,13 @@ void QuantizerVisitor::VisitDepthwiseConvolution2dLayer(const IConnectableLayer*
                                                         const Optional<ConstTensor>& biases,
                                                         const char* name)
 {
+    // Depthwise convolutions only take per-axis weights with QuantisedAsymm8 inputs
+    const bool perChannelWeights = m_PerChannelWeights &&
+                                   m_QuantizationScheme->GetDataType() == DataType::QuantisedAsymm8;
     std::vector<uint8_t> weightsBacking;
-    ConstTensor qWeights = CreateQuantizedConst(weights, weightsBacking);
+    ConstTensor qWeights = perChannelWeights ?
+                           CreatePerAxisQuantizedConst(weights, 1, weightsBacking) :
+                           CreateQuantizedConst(weights, weightsBacking);
     Optional<ConstTensor> optionalQBiases;
     std::vector<int32_t> biasesBacking;
 
@@ -272,8 +299,12 @@ void QuantizerVisitor::VisitFullyConnectedLayer(const IConnectableLayer *layer,
                                                 const Optional<ConstTensor>& biases,
                                                 const char *name)
 {
+    // The output channels are the rows of the weight matrix when it is transposed, and its columns otherwise
+    const unsigned int outputChannelDim = desc.m_TransposeWeightMatrix ? 0 : 1;
     std::vector<uint8_t> weightsBacking;
-    ConstTensor qWeights = CreateQuantizedConst(weights, weightsBacking);
+    ConstTensor qWeights = m_PerChannelWeights ?
+                           CreatePerAxisQuantizedConst(weights, outputChannelDim, weightsBacking) :
+                           CreateQuantizedConst(weights, weightsBacking);
     Optional<ConstTensor> optionalQBiases;
     std::vector<int32_t> biasesBacking;
 
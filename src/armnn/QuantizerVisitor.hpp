@@ -27,7 +27,8 @@ class QuantizerVisitor : public LayerVisitorBase<VisitorThrowingPolicy>
 public:
     QuantizerVisitor(const RangeTracker& rangeTracker,
                      const IQuantizationScheme* quantizationScheme,
-                     bool preserveType = false);
+                     bool preserveType = false,
+                     bool perChannelWeights = false);
 
     ~QuantizerVisitor() = default;
 
@@ -205,6 +206,8 @@ private:
     const IQuantizationScheme* m_QuantizationScheme;
 
     const bool m_PreserveType;
+
+    const bool m_PerChannelWeights;
 };
 
 } //namespace armnn
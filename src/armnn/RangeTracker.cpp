@@ -6,6 +6,8 @@
 #include "RangeTracker.hpp"
 #include "InternalTypes.hpp"
 
+#include <algorithm>
+
 namespace armnn
 {
 
@@ -71,9 +73,92 @@ void RangeTracker::ResetMinMax(LayerGuid guid, unsigned int idx, float newMin, f
     currentMax = newMax;
 }
 
+void RangeTracker::Merge(const RangeTracker& other)
+{
+    for (const auto& otherGuidAndRanges : other.m_GuidToRangesMap)
+    {
+        auto search = m_GuidToRangesMap.find(otherGuidAndRanges.first);
+        if (search == m_GuidToRangesMap.end())
+        {
+            m_GuidToRangesMap.insert(otherGuidAndRanges);
+            continue;
+        }
+
+        MinMaxRanges& ranges = search->second;
+        const MinMaxRanges& otherRanges = otherGuidAndRanges.second;
+        for (size_t i = 0; i < otherRanges.size(); ++i)
+        {
+            if (i == ranges.size())
+            {
+                ranges.push_back(otherRanges[i]);
+                continue;
+            }
+            ranges[i].first  = std::min(ranges[i].first, otherRanges[i].first);
+            ranges[i].second = std::max(ranges[i].second, otherRanges[i].second);
+        }
+    }
+
+    for (const auto& otherGuidAndHistograms : other.m_GuidToHistogramsMap)
+    {
+        Histograms& histograms = m_GuidToHistogramsMap[otherGuidAndHistograms.first];
+        const Histograms& otherHistograms = otherGuidAndHistograms.second;
+        if (histograms.size() < otherHistograms.size())
+        {
+            histograms.resize(otherHistograms.size());
+        }
+        for (size_t i = 0; i < otherHistograms.size(); ++i)
+        {
+            histograms[i].Merge(otherHistograms[i]);
+        }
+    }
+}
+
+void RangeTracker::AddToHistogram(LayerGuid guid,
+                                  unsigned int idx,
+                                  const float* values,
+                                  unsigned int numElements,
+                                  float min,
+                                  float max)
+{
+    Histograms& histograms = m_GuidToHistogramsMap[guid];
+    if (histograms.size() <= idx)
+    {
+        histograms.resize(idx + 1);
+    }
+    histograms[idx].Add(values, numElements, min, max);
+}
+
+void RangeTracker::ResetHistogram(LayerGuid guid, unsigned int idx)
+{
+    auto search = m_GuidToHistogramsMap.find(guid);
+    if (search != m_GuidToHistogramsMap.end() && idx < search->second.size())
+    {
+        search->second[idx] = Histogram();
+    }
+}
+
+void RangeTracker::SelectRangesFromHistograms(CalibrationMethod method,
+                                              float percentile,
+                                              unsigned int numQuantizedLevels)
+{
+    for (const auto& guidAndHistograms : m_GuidToHistogramsMap)
+    {
+        const Histograms& histograms = guidAndHistograms.second;
+        for (unsigned int i = 0; i < histograms.size(); ++i)
+        {
+            if (!histograms[i].IsEmpty())
+            {
+                const MinMaxRange range = histograms[i].SelectRange(method, percentile, numQuantizedLevels);
+                ResetMinMax(guidAndHistograms.first, i, range.first, range.second);
+            }
+        }
+    }
+}
+
 void RangeTracker::Reset()
 {
     m_GuidToRangesMap.clear();
+    m_GuidToHistogramsMap.clear();
 }
 
 } //namespace armnn
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include "Histogram.hpp"
+
 #include <armnn/INetwork.hpp>
 #include <armnn/Types.hpp>
 
@@ -40,14 +42,34 @@ public:
     /// Overwrite min and max in RangeTracker with newMin and newMax
     void ResetMinMax(LayerGuid guid, unsigned int idx, float newMin, float newMax);
 
+    /// Widen the ranges to include the ranges of another RangeTracker, adding those of the layers missing here.
+    /// The histograms are merged likewise
+    void Merge(const RangeTracker& other);
+
+    /// Add values to the histogram of an output slot, with min and max the smallest and largest of them
+    void AddToHistogram(LayerGuid guid, unsigned int idx, const float* values, unsigned int numElements,
+                        float min, float max);
+
+    /// Empty the histogram of an output slot
+    void ResetHistogram(LayerGuid guid, unsigned int idx);
+
+    /// Overwrite the range of each output slot that has a histogram with the range selected from it
+    void SelectRangesFromHistograms(CalibrationMethod method, float percentile, unsigned int numQuantizedLevels);
+
     void Reset();
 
     void SetDynamicMode(bool flag) { m_DynamicMode = flag; }
 
     bool IsInDynamicMode() const { return m_DynamicMode; }
 
+    /// Whether the calibration keeps a histogram of the values of each output slot, on top of their range
+    void SetHistogramMode(bool flag) { m_HistogramMode = flag; }
+
+    bool IsInHistogramMode() const { return m_HistogramMode; }
+
 private:
     using MinMaxRanges = std::vector<MinMaxRange>;
+    using Histograms = std::vector<Histogram>;
 
     /// Retrieve the default range
     MinMaxRange DefaultRange() const { return std::make_pair(-15.0f, 15.0f); }
@@ -55,7 +77,12 @@ private:
     /// Mapping from a layer Guid to an array of ranges for outputs
     std::unordered_map<LayerGuid, MinMaxRanges> m_GuidToRangesMap;
 
+    /// Mapping from a layer Guid to an array of histograms for outputs
+    std::unordered_map<LayerGuid, Histograms> m_GuidToHistogramsMap;
+
     bool m_DynamicMode = false;
+
+    bool m_HistogramMode = false;
 };
 
 } //namespace armnn
\ No newline at end of file
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "armnn/Types.hpp"
+#include "BFloat16.hpp"
 #include "Half.hpp"
 
 namespace armnn
@@ -38,6 +39,18 @@ struct ResolveTypeImpl<DataType::QuantisedSymm16>
     using Type = int16_t;
 };
 
+template<>
+struct ResolveTypeImpl<DataType::QuantisedSymm8PerAxis>
+{
+    using Type = int8_t;
+};
+
+template<>
+struct ResolveTypeImpl<DataType::BFloat16>
+{
+    using Type = BFloat16;
+};
+
 template<>
 struct ResolveTypeImpl<DataType::Signed32>
 {
@@ -259,6 +259,12 @@ void Runtime::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunc
     loadedNetwork->RegisterDebugCallback(func);
 }
 
+void Runtime::RegisterTensorObserver(NetworkId networkId, const TensorObserverFunction& func)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    loadedNetwork->RegisterTensorObserver(func);
+}
+
 void Runtime::LoadDynamicBackends(const std::string& overrideBackendPath)
 {
     // Get the paths where to load the dynamic backends from
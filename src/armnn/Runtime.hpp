@@ -72,6 +72,11 @@ public:
     /// @param func callback function to pass to the debug layer.
     virtual void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func) override;
 
+    /// Registers a function observing the outputs of every layer of a network as it executes.
+    /// @param networkId The id of the network to observe.
+    /// @param func function to call after each layer has executed, for each of its output tensors.
+    virtual void RegisterTensorObserver(NetworkId networkId, const TensorObserverFunction& func) override;
+
     /// Creates a runtime for workload execution.
     /// May throw a ClRuntimeUnavailableException if @a defaultComputeDevice requires a CL runtime but
     /// it cannot be setup for some reason.
@@ -156,6 +156,24 @@ TensorInfo::TensorInfo(unsigned int numDimensions, const unsigned int* dimension
     m_Quantization.m_Offset = quantizationOffset;
 }
 
+TensorInfo::TensorInfo(const TensorShape& shape, DataType dataType,
+    const std::vector<float>& quantizationScales, unsigned int quantizationDim)
+ : m_Shape(shape)
+ , m_DataType(dataType)
+{
+    m_Quantization.m_Scales = quantizationScales;
+    m_Quantization.m_QuantizationDim = quantizationDim;
+}
+
+TensorInfo::TensorInfo(unsigned int numDimensions, const unsigned int* dimensionSizes, DataType dataType,
+    const std::vector<float>& quantizationScales, unsigned int quantizationDim)
+ : m_Shape(numDimensions, dimensionSizes)
+ , m_DataType(dataType)
+{
+    m_Quantization.m_Scales = quantizationScales;
+    m_Quantization.m_QuantizationDim = quantizationDim;
+}
+
 TensorInfo::TensorInfo(const TensorInfo& other)
 : m_Shape(other.m_Shape)
 , m_DataType(other.m_DataType)
@@ -197,7 +215,9 @@ bool TensorInfo::IsTypeSpaceMatch(const TensorInfo& other) const
     if (IsQuantized())
     {
         match &= GetQuantizationScale() == other.GetQuantizationScale() &&
-                 GetQuantizationOffset() == other.GetQuantizationOffset();
+                 GetQuantizationOffset() == other.GetQuantizationOffset() &&
+                 GetQuantizationScales() == other.GetQuantizationScales() &&
+                 GetQuantizationDim() == other.GetQuantizationDim();
     }
     return match;
 }
@@ -37,6 +37,10 @@ float armnn::Dequantize(QuantizedType value, float scale, int32_t offset)
 template
 uint8_t armnn::Quantize<uint8_t>(float value, float scale, int32_t offset);
 
+/// Explicit specialization of Quantize for int8_t
+template
+int8_t armnn::Quantize<int8_t>(float value, float scale, int32_t offset);
+
 /// Explicit specialization of Quantize for int16_t
 template
 int16_t armnn::Quantize<int16_t>(float value, float scale, int32_t offset);
@@ -49,6 +53,10 @@ int32_t armnn::Quantize<int32_t>(float value, float scale, int32_t offset);
 template
 float armnn::Dequantize<uint8_t>(uint8_t value, float scale, int32_t offset);
 
+/// Explicit specialization of Dequantize for int8_t
+template
+float armnn::Dequantize<int8_t>(int8_t value, float scale, int32_t offset);
+
 /// Explicit specialization of Dequantize for int16_t
 template
 float armnn::Dequantize<int16_t>(int16_t value, float scale, int32_t offset);
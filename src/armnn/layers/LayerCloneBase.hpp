@@ -18,6 +18,11 @@ LayerType* Layer::CloneBase(Graph& graph, Params&& ... params) const
     layer->SetBackendId(GetBackendId());
     layer->SetGuid(GetGuid());
 
+    if (m_FusedActivation.has_value())
+    {
+        layer->SetFusedActivation(m_FusedActivation.value());
+    }
+
     return layer;
 }
 
@@ -12,6 +12,9 @@
 #include "MovePermuteUp.hpp"
 #include "OptimizeInverseConversions.hpp"
 #include "ConvertFp32NetworkToFp16.hpp"
+#include "ConvertFp32NetworkToBf16.hpp"
 #include "AddDebug.hpp"
 #include "FoldPadIntoConvolution2d.hpp"
+#include "FuseActivation.hpp"
+#include "FuseBatchNormalization.hpp"
 #include "PermuteAndBatchToSpaceAsDepthToSpace.hpp"
\ No newline at end of file
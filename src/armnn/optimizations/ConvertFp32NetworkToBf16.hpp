@@ -0,0 +1,41 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "Optimization.hpp"
+#include "NetworkUtils.hpp"
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Reduces the Float32 inputs and weights of the Convolution2d and FullyConnected layers to BFloat16, leaving the
+/// rest of the network in Float32. These layers still accumulate in Float32, and their biases and outputs keep
+/// that type, so only the memory traffic of the convolutions and matrix products is halved.
+class ConvertFp32NetworkToBf16Impl
+{
+public:
+
+    void Run(Graph& graph, Layer& layer) const
+    {
+        if ((layer.GetType() == LayerType::Convolution2d || layer.GetType() == LayerType::FullyConnected) &&
+            layer.GetDataType() == DataType::Float32)
+        {
+            // add a ConvertFloat32ToBFloat16 layer before each of the inputs, and convert the weights in place
+            InsertConvertFp32ToBf16LayersBefore(graph, layer);
+            ConvertWeightsDataType(layer, DataType::BFloat16);
+        }
+    }
+
+protected:
+    ConvertFp32NetworkToBf16Impl() = default;
+    ~ConvertFp32NetworkToBf16Impl() = default;
+};
+
+using Fp32NetworkToBf16Converter = OptimizeForType<Layer, ConvertFp32NetworkToBf16Impl>;
+
+} // namespace optimizations
+} // namespace armnn
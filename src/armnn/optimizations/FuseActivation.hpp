@@ -0,0 +1,67 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <Network.hpp>
+
+#include <backendsCommon/IBackendInternal.hpp>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Fuses an ActivationLayer into the layer producing its input, so that the producer's workload applies the
+/// activation to its output instead of the tensor being written and read back. Must run after backends have
+/// been assigned: fusion only happens when the producer's backend reports support for it.
+class FuseActivationImpl
+{
+public:
+    FuseActivationImpl(const BackendsMap& backends)
+        : m_Backends(backends)
+    {}
+
+    /// Run for every ActivationLayer. Fuses it into its producer when the producer has no other consumer.
+    void Run(Graph&, ActivationLayer& layer) const
+    {
+        Layer& producer = layer.GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+        if (producer.GetNumOutputSlots() != 1 ||
+            producer.GetOutputSlot(0).GetNumConnections() != 1 ||
+            producer.GetFusedActivation().has_value() ||
+            producer.GetBackendId() != layer.GetBackendId())
+        {
+            return;
+        }
+
+        auto backend = m_Backends.find(producer.GetBackendId());
+        if (backend == m_Backends.end() ||
+            !backend->second->SupportsFusedActivation(producer.GetType(), layer.GetParameters()))
+        {
+            return;
+        }
+
+        producer.SetFusedActivation(layer.GetParameters());
+        producer.GetOutputSlot(0).SetTensorInfo(layer.GetOutputSlot(0).GetTensorInfo());
+        producer.AddRelatedLayerName(layer.GetNameStr());
+
+        // Moves the consumers of the activation to the producer.
+        // The activation layer will be removed as it's left unconnected.
+        layer.GetOutputSlot(0).MoveAllConnections(producer.GetOutputSlot(0));
+    }
+
+protected:
+    ~FuseActivationImpl() = default;
+
+private:
+    const BackendsMap& m_Backends;
+};
+
+using FuseActivation = OptimizeForType<ActivationLayer, FuseActivationImpl>;
+
+} // namespace optimizations
+} // namespace armnn
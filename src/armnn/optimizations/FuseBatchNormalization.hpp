@@ -0,0 +1,244 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Optimization.hpp"
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+#include <DataLayoutIndexed.hpp>
+#include <FloatingPointConverter.hpp>
+
+#include <Half.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace armnn
+{
+namespace optimizations
+{
+
+/// Folds a BatchNormalizationLayer into the weights and bias of the layer producing its input:
+///     scale = gamma / sqrt(variance + eps)
+///     weights' = weights * scale
+///     bias' = (bias - mean) * scale + beta
+/// where scale, mean and beta are indexed by the output channel each weight contributes to.
+template <typename BaseLayer>
+class FuseBatchNormalizationImpl
+{
+public:
+    /// Run for every connection between a base BaseLayer and a child BatchNormalizationLayer.
+    /// Replaces both layers by an equivalent BaseLayer when the base layer has no other consumer.
+    void Run(Graph& graph, InputSlot& connection) const
+    {
+        Layer& base = connection.GetConnectedOutputSlot()->GetOwningLayer();
+        Layer& child = connection.GetOwningLayer();
+
+        BOOST_ASSERT(base.GetType() == LayerEnumOf<BaseLayer>());
+        BOOST_ASSERT(child.GetType() == LayerType::BatchNormalization);
+
+        BaseLayer* layer = boost::polymorphic_downcast<BaseLayer*>(&base);
+        BatchNormalizationLayer* batchNormLayer = boost::polymorphic_downcast<BatchNormalizationLayer*>(&child);
+
+        if (base.GetOutputSlot(0).GetNumConnections() != 1 || !CanFuse(*layer, *batchNormLayer))
+        {
+            return;
+        }
+
+        const TensorInfo& weightsInfo = layer->m_Weight->GetTensorInfo();
+        const unsigned int numChannels = batchNormLayer->m_Mean->GetTensorInfo().GetNumElements();
+
+        const std::vector<float> mean     = ToFloat(*batchNormLayer->m_Mean);
+        const std::vector<float> variance = ToFloat(*batchNormLayer->m_Variance);
+        const std::vector<float> beta     = ToFloat(*batchNormLayer->m_Beta);
+        const std::vector<float> gamma    = ToFloat(*batchNormLayer->m_Gamma);
+        const float eps = batchNormLayer->GetParameters().m_Eps;
+
+        std::vector<float> scale(numChannels);
+        for (unsigned int c = 0; c < numChannels; ++c)
+        {
+            scale[c] = gamma[c] / std::sqrt(variance[c] + eps);
+        }
+
+        std::vector<float> weights = ToFloat(*layer->m_Weight);
+        for (unsigned int i = 0; i < weights.size(); ++i)
+        {
+            weights[i] *= scale[GetOutputChannel(*layer, weightsInfo.GetShape(), i)];
+        }
+
+        auto descriptor = layer->GetParameters();
+        std::vector<float> bias = descriptor.m_BiasEnabled ? ToFloat(*layer->m_Bias)
+                                                           : std::vector<float>(numChannels, 0.0f);
+        for (unsigned int c = 0; c < numChannels; ++c)
+        {
+            bias[c] = (bias[c] - mean[c]) * scale[c] + beta[c];
+        }
+        descriptor.m_BiasEnabled = true;
+
+        OutputSlot* parentOut = base.GetInputSlot(0).GetConnectedOutputSlot();
+
+        const std::string name = std::string("fused-") + child.GetName() + std::string("-into-") + base.GetName();
+        auto& newLayer = *graph.InsertNewLayer<BaseLayer>(base.GetInputSlot(0), descriptor, name.c_str());
+        newLayer.GetOutputHandler().SetTensorInfo(child.GetOutputHandler().GetTensorInfo());
+
+        newLayer.m_Weight = FromFloat(weights, weightsInfo);
+        newLayer.m_Bias   = FromFloat(bias, TensorInfo({ numChannels }, weightsInfo.GetDataType()));
+
+        // Reconnects with original parent.
+        newLayer.GetOutputSlot().MoveAllConnections(*parentOut);
+
+        // Moves connections in child output to the new layer.
+        // Child layer will be removed as it's left unconnected.
+        // Base layer will be removed if left unconnected.
+        child.GetOutputSlot().MoveAllConnections(newLayer.GetOutputSlot());
+    }
+
+protected:
+    FuseBatchNormalizationImpl() = default;
+    ~FuseBatchNormalizationImpl() = default;
+
+private:
+    static bool IsFoldableType(const ScopedCpuTensorHandle* tensor, DataType dataType)
+    {
+        return tensor != nullptr && tensor->GetTensorInfo().GetDataType() == dataType;
+    }
+
+    static bool CanFuse(const BaseLayer& layer, const BatchNormalizationLayer& batchNormLayer)
+    {
+        if (layer.m_Weight == nullptr)
+        {
+            return false;
+        }
+
+        const DataType dataType = layer.m_Weight->GetTensorInfo().GetDataType();
+        if (dataType != DataType::Float32 && dataType != DataType::Float16)
+        {
+            return false;
+        }
+        if (layer.GetParameters().m_BiasEnabled && !IsFoldableType(layer.m_Bias.get(), dataType))
+        {
+            return false;
+        }
+        if (!IsFoldableType(batchNormLayer.m_Mean.get(), dataType)  ||
+            !IsFoldableType(batchNormLayer.m_Variance.get(), dataType) ||
+            !IsFoldableType(batchNormLayer.m_Beta.get(), dataType)  ||
+            !IsFoldableType(batchNormLayer.m_Gamma.get(), dataType))
+        {
+            return false;
+        }
+
+        // The batch normalization must run along the channels the layer produces.
+        const TensorShape& outputShape = layer.GetOutputSlot(0).GetTensorInfo().GetShape();
+        const unsigned int channelsIndex = GetChannelsIndex(layer, batchNormLayer.GetParameters().m_DataLayout);
+        if (channelsIndex >= outputShape.GetNumDimensions())
+        {
+            return false;
+        }
+
+        const unsigned int numChannels = batchNormLayer.m_Mean->GetTensorInfo().GetNumElements();
+        return outputShape[channelsIndex] == numChannels &&
+               batchNormLayer.m_Variance->GetTensorInfo().GetNumElements() == numChannels &&
+               batchNormLayer.m_Beta->GetTensorInfo().GetNumElements() == numChannels &&
+               batchNormLayer.m_Gamma->GetTensorInfo().GetNumElements() == numChannels;
+    }
+
+    /// Returns the index of the channels dimension in the layer's output, or an out of range index when the batch
+    /// normalization's data layout does not match the layer's.
+    static unsigned int GetChannelsIndex(const Convolution2dLayer& layer, DataLayout batchNormLayout)
+    {
+        return layer.GetParameters().m_DataLayout == batchNormLayout ?
+            armnnUtils::DataLayoutIndexed(batchNormLayout).GetChannelsIndex() : MaxNumOfTensorDimensions;
+    }
+
+    static unsigned int GetChannelsIndex(const DepthwiseConvolution2dLayer& layer, DataLayout batchNormLayout)
+    {
+        return layer.GetParameters().m_DataLayout == batchNormLayout ?
+            armnnUtils::DataLayoutIndexed(batchNormLayout).GetChannelsIndex() : MaxNumOfTensorDimensions;
+    }
+
+    static unsigned int GetChannelsIndex(const FullyConnectedLayer&, DataLayout batchNormLayout)
+    {
+        // The output of a fully connected layer is [batches, channels].
+        return batchNormLayout == DataLayout::NCHW ? 1 : MaxNumOfTensorDimensions;
+    }
+
+    /// Returns the output channel the weight at the given index contributes to.
+    static unsigned int GetOutputChannel(const Convolution2dLayer&, const TensorShape& weightsShape, unsigned int index)
+    {
+        // Weights are [O, I, H, W] or [O, H, W, I].
+        return index / (weightsShape.GetNumElements() / weightsShape[0]);
+    }
+
+    static unsigned int GetOutputChannel(const DepthwiseConvolution2dLayer&,
+                                         const TensorShape& weightsShape,
+                                         unsigned int index)
+    {
+        // Weights are [M, I, H, W] and output channel i * M + m is computed from input channel i.
+        const unsigned int depthMultiplier = weightsShape[0];
+        const unsigned int inputChannels   = weightsShape[1];
+        const unsigned int kernelSize      = weightsShape[2] * weightsShape[3];
+
+        const unsigned int m = index / (inputChannels * kernelSize);
+        const unsigned int i = (index / kernelSize) % inputChannels;
+        return i * depthMultiplier + m;
+    }
+
+    static unsigned int GetOutputChannel(const FullyConnectedLayer& layer,
+                                         const TensorShape& weightsShape,
+                                         unsigned int index)
+    {
+        // Weights are [I, O], or [O, I] when the weight matrix is transposed.
+        return layer.GetParameters().m_TransposeWeightMatrix ? index / weightsShape[1] : index % weightsShape[1];
+    }
+
+    static std::vector<float> ToFloat(const ScopedCpuTensorHandle& tensor)
+    {
+        const TensorInfo& info = tensor.GetTensorInfo();
+        std::vector<float> values(info.GetNumElements());
+
+        if (info.GetDataType() == DataType::Float16)
+        {
+            armnnUtils::FloatingPointConverter::ConvertFloat16To32(tensor.GetConstTensor<Half>(),
+                                                                   info.GetNumElements(),
+                                                                   values.data());
+        }
+        else
+        {
+            const float* data = tensor.GetConstTensor<float>();
+            std::copy(data, data + info.GetNumElements(), values.begin());
+        }
+        return values;
+    }
+
+    static std::unique_ptr<ScopedCpuTensorHandle> FromFloat(const std::vector<float>& values, const TensorInfo& info)
+    {
+        if (info.GetDataType() == DataType::Float16)
+        {
+            std::vector<Half> halfValues(values.size());
+            armnnUtils::FloatingPointConverter::ConvertFloat32To16(values.data(), values.size(), halfValues.data());
+            return std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, halfValues));
+        }
+        return std::make_unique<ScopedCpuTensorHandle>(ConstTensor(info, values));
+    }
+};
+
+using FuseBatchNormalizationIntoConvolution2d =
+    OptimizeForConnection<Convolution2dLayer,
+                          BatchNormalizationLayer,
+                          FuseBatchNormalizationImpl<Convolution2dLayer>>;
+
+using FuseBatchNormalizationIntoDepthwiseConvolution2d =
+    OptimizeForConnection<DepthwiseConvolution2dLayer,
+                          BatchNormalizationLayer,
+                          FuseBatchNormalizationImpl<DepthwiseConvolution2dLayer>>;
+
+using FuseBatchNormalizationIntoFullyConnected =
+    OptimizeForConnection<FullyConnectedLayer,
+                          BatchNormalizationLayer,
+                          FuseBatchNormalizationImpl<FullyConnectedLayer>>;
+
+} // namespace optimizations
+} // namespace armnn
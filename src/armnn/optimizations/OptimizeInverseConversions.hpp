@@ -15,7 +15,7 @@ class OptimizeInverseConversionsImpl
 {
 public:
     /// Run for every connection between two inverse data type conversion layers, i.e.
-    /// Fp16ToFp32 followed by Fp32ToFp16 or vice-versa.
+    /// Fp16ToFp32 followed by Fp32ToFp16 or vice-versa, or Fp32ToBf16 followed by Bf16ToFp32.
     void Run(Graph& graph, InputSlot& connection) const
     {
         Layer& base  = connection.GetConnectedOutputSlot()->GetOwningLayer();
@@ -24,7 +24,9 @@ public:
         BOOST_ASSERT((base.GetType() == LayerType::ConvertFp16ToFp32 &&
                      child.GetType() == LayerType::ConvertFp32ToFp16) ||
                      (base.GetType() == LayerType::ConvertFp32ToFp16 &&
-                     child.GetType() == LayerType::ConvertFp16ToFp32));
+                     child.GetType() == LayerType::ConvertFp16ToFp32) ||
+                     (base.GetType() == LayerType::ConvertFp32ToBf16 &&
+                     child.GetType() == LayerType::ConvertBf16ToFp32));
 
         // Bypass both conversion layers
         child.GetOutputSlot().MoveAllConnections(*base.GetInputSlot(0).GetConnectedOutputSlot());
@@ -39,6 +41,8 @@ using OptimizeInverseConversionsFp16 =
     OptimizeForConnection<ConvertFp16ToFp32Layer, ConvertFp32ToFp16Layer, OptimizeInverseConversionsImpl>;
 using OptimizeInverseConversionsFp32 =
     OptimizeForConnection<ConvertFp32ToFp16Layer, ConvertFp16ToFp32Layer, OptimizeInverseConversionsImpl>;
+using OptimizeInverseConversionsBf16 =
+    OptimizeForConnection<ConvertFp32ToBf16Layer, ConvertBf16ToFp32Layer, OptimizeInverseConversionsImpl>;
 
 } // namespace optimizations
 } // namespace armnn
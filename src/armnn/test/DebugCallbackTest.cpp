@@ -93,6 +93,60 @@ BOOST_AUTO_TEST_CASE(RuntimeRegisterDebugCallback)
     BOOST_TEST(slotIndexes == expectedSlotIndexes);
 }
 
+BOOST_AUTO_TEST_CASE(RuntimeRegisterTensorObserver)
+{
+    INetworkPtr net = CreateSimpleNetwork();
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // Optimize the network without the debug option: no debug layers are needed to observe the tensors
+    std::vector<BackendId> backends = { "CpuRef" };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+
+    // Set up the observer, recording the values of each tensor
+    std::vector<LayerGuid> guids;
+    std::vector<unsigned int> slotIndexes;
+    std::vector<std::vector<float>> values;
+    auto observer = [&](LayerGuid guid, unsigned int slotIndex, ITensorHandle* tensor)
+    {
+        guids.push_back(guid);
+        slotIndexes.push_back(slotIndex);
+        const float* data = static_cast<const float*>(tensor->Map(true));
+        values.push_back(std::vector<float>(data, data + tensor->GetShape().GetNumElements()));
+        tensor->Unmap();
+    };
+
+    runtime->RegisterTensorObserver(netId, observer);
+
+    std::vector<float> inputData({-2, -1, 0, 1, 2});
+    std::vector<float> outputData(5);
+
+    InputTensors inputTensors
+    {
+        {0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data())}
+    };
+    OutputTensors outputTensors
+    {
+        {0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data())}
+    };
+
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+
+    // Check that the observer was called for the outputs of the input and the activation layers, in order
+    BOOST_TEST(guids.size() == 2);
+    BOOST_TEST(guids[0] != guids[1]);
+
+    const std::vector<unsigned int> expectedSlotIndexes({0, 0});
+    BOOST_TEST(slotIndexes == expectedSlotIndexes);
+
+    const std::vector<std::vector<float>> expectedValues({{-2, -1, 0, 1, 2}, {0, 0, 0, 1, 2}});
+    BOOST_TEST(values == expectedValues);
+}
+
 } // anonymous namespace
 
 BOOST_AUTO_TEST_SUITE_END()
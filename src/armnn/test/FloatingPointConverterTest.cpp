@@ -4,10 +4,17 @@
 //
 
 #include "FloatingPointConverter.hpp"
+#include <BFloat16.hpp>
 #include <Half.hpp>
 
 #include <boost/test/unit_test.hpp>
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
 BOOST_AUTO_TEST_SUITE(TestFPConversion)
 
 BOOST_AUTO_TEST_CASE(TestConvertFp32ToFp16)
@@ -51,4 +58,109 @@ BOOST_AUTO_TEST_CASE(TestConvertFp16ToFp32)
     }
 }
 
+BOOST_AUTO_TEST_CASE(TestConvertFp16ToFp32AllValues)
+{
+    // Every FP16 bit pattern, converted in bulk, must match the software Half conversion exactly.
+    std::vector<uint16_t> halfBits(65536);
+    for (size_t i = 0; i < halfBits.size(); i++)
+    {
+        halfBits[i] = static_cast<uint16_t>(i);
+    }
+    std::vector<float> convertedBuffer(halfBits.size());
+
+    armnnUtils::FloatingPointConverter::ConvertFloat16To32(halfBits.data(), halfBits.size(), convertedBuffer.data());
+
+    for (size_t i = 0; i < halfBits.size(); i++)
+    {
+        const float expected = reinterpret_cast<const armnn::Half*>(halfBits.data())[i];
+        if (std::isnan(expected))
+        {
+            BOOST_CHECK(std::isnan(convertedBuffer[i]));
+        }
+        else
+        {
+            BOOST_CHECK_EQUAL(expected, convertedBuffer[i]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestConvertFp32ToFp16Rounding)
+{
+    // Overflow, subnormals, exact ties between two FP16 values (rounded to even) and an odd number of elements,
+    // so that both the bulk and the remainder paths are exercised.
+    const float maxHalf = 65504.0f;
+    const float minSubnormalHalf = std::ldexp(1.0f, -24);
+    std::vector<float> floatArray = { 0.0f, -0.0f, 1.0f + std::ldexp(1.0f, -11), 1.0f + 3.0f * std::ldexp(1.0f, -11),
+                                      -2049.0f, 2051.0f, maxHalf, 65519.0f, 65520.0f, -1.0e10f,
+                                      minSubnormalHalf, 0.5f * minSubnormalHalf, 1.5f * minSubnormalHalf,
+                                      0.49f * minSubnormalHalf, std::ldexp(1.0f, -14) - minSubnormalHalf * 0.5f,
+                                      std::numeric_limits<float>::infinity(), -std::numeric_limits<float>::infinity(),
+                                      std::numeric_limits<float>::denorm_min(), 3.1f, -7.1f, 0.1f };
+    std::vector<armnn::Half> convertedBuffer(floatArray.size());
+
+    armnnUtils::FloatingPointConverter::ConvertFloat32To16(floatArray.data(), floatArray.size(),
+                                                           convertedBuffer.data());
+
+    for (size_t i = 0; i < floatArray.size(); i++)
+    {
+        const armnn::Half expected(floatArray[i]);
+        uint16_t expectedBits;
+        uint16_t actualBits;
+        std::memcpy(&expectedBits, &expected, sizeof(expectedBits));
+        std::memcpy(&actualBits, &convertedBuffer[i], sizeof(actualBits));
+        BOOST_CHECK_EQUAL(expectedBits, actualBits);
+    }
+
+    // Ties round to even.
+    BOOST_CHECK_EQUAL(static_cast<float>(convertedBuffer[2]), 1.0f);
+    BOOST_CHECK_EQUAL(static_cast<float>(convertedBuffer[3]), 1.0f + std::ldexp(1.0f, -9));
+    BOOST_CHECK_EQUAL(static_cast<float>(convertedBuffer[4]), -2048.0f);
+    BOOST_CHECK_EQUAL(static_cast<float>(convertedBuffer[5]), 2052.0f);
+
+    std::vector<float> nanArray(9, std::numeric_limits<float>::quiet_NaN());
+    std::vector<armnn::Half> convertedNans(nanArray.size());
+    armnnUtils::FloatingPointConverter::ConvertFloat32To16(nanArray.data(), nanArray.size(), convertedNans.data());
+    for (const armnn::Half& half : convertedNans)
+    {
+        BOOST_CHECK(half_float::isnan(half));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestConvertFp32ToBf16Rounding)
+{
+    // Exact values, ties between two BF16 values (rounded to even), overflow to infinity and NaN.
+    std::vector<float> floatArray = { 0.0f, -0.0f, 1.0f, -2.5f,
+                                      1.0f + std::ldexp(1.0f, -8), 1.0f + 3.0f * std::ldexp(1.0f, -8),
+                                      1.0f + std::ldexp(1.0f, -9), 3.4028235e38f,
+                                      std::numeric_limits<float>::infinity(),
+                                      std::numeric_limits<float>::quiet_NaN() };
+    std::vector<armnn::BFloat16> convertedBuffer(floatArray.size());
+
+    armnnUtils::FloatingPointConverter::ConvertFloat32ToBFloat16(floatArray.data(), floatArray.size(),
+                                                                 convertedBuffer.data());
+
+    const std::vector<uint16_t> expectedBits = { 0x0000, 0x8000, 0x3f80, 0xc020, 0x3f80, 0x3f82, 0x3f80, 0x7f80,
+                                                 0x7f80 };
+    for (size_t i = 0; i < expectedBits.size(); i++)
+    {
+        BOOST_CHECK_EQUAL(expectedBits[i], convertedBuffer[i].Val());
+    }
+    BOOST_CHECK(std::isnan(static_cast<float>(convertedBuffer.back())));
+}
+
+BOOST_AUTO_TEST_CASE(TestConvertBf16ToFp32)
+{
+    std::vector<armnn::BFloat16> bf16Array = { armnn::BFloat16::FromBits(0x3f80), armnn::BFloat16::FromBits(0xc020),
+                                               armnn::BFloat16::FromBits(0x3f82), armnn::BFloat16::FromBits(0xff80) };
+    std::vector<float> convertedBuffer(bf16Array.size());
+
+    armnnUtils::FloatingPointConverter::ConvertBFloat16ToFloat32(bf16Array.data(), bf16Array.size(),
+                                                                 convertedBuffer.data());
+
+    BOOST_CHECK_EQUAL(convertedBuffer[0], 1.0f);
+    BOOST_CHECK_EQUAL(convertedBuffer[1], -2.5f);
+    BOOST_CHECK_EQUAL(convertedBuffer[2], 1.015625f);
+    BOOST_CHECK_EQUAL(convertedBuffer[3], -std::numeric_limits<float>::infinity());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
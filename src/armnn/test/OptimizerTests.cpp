@@ -614,4 +614,286 @@ BOOST_AUTO_TEST_CASE(FoldPadLayerIntoConvolution2dLayer)
         &IsLayerOfType<armnn::OutputLayer>));
 }
 
+BOOST_AUTO_TEST_CASE(FuseBatchNormalizationIntoConvolution2dLayer)
+{
+    Graph graph;
+    const unsigned int inputShape[]   = { 1, 2, 2, 1 };
+    const unsigned int weightsShape[] = { 2, 1, 1, 1 };
+    const unsigned int outputShape[]  = { 1, 2, 2, 2 };
+    const unsigned int channelShape[] = { 2 };
+
+    armnn::TensorInfo inputInfo(4, inputShape, DataType::Float32);
+    armnn::TensorInfo outputInfo(4, outputShape, DataType::Float32);
+    armnn::TensorInfo channelInfo(1, channelShape, DataType::Float32);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    Convolution2dDescriptor convolution2dDescriptor;
+    convolution2dDescriptor.m_BiasEnabled = true;
+    convolution2dDescriptor.m_DataLayout = DataLayout::NHWC;
+
+    std::vector<float> weightsVector = { 2.0f, -1.0f };
+    std::vector<float> biasVector    = { 1.0f, 0.5f };
+    Convolution2dLayer* conv2dLayer = graph.AddLayer<Convolution2dLayer>(convolution2dDescriptor, "conv2d");
+    conv2dLayer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo(4, weightsShape, DataType::Float32), weightsVector));
+    conv2dLayer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, biasVector));
+    conv2dLayer->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    BatchNormalizationDescriptor batchNormDescriptor;
+    batchNormDescriptor.m_Eps = 0.0f;
+    batchNormDescriptor.m_DataLayout = DataLayout::NHWC;
+
+    std::vector<float> meanVector     = { 1.0f, -2.0f };
+    std::vector<float> varianceVector = { 4.0f, 0.25f };
+    std::vector<float> betaVector     = { 0.5f, 1.0f };
+    std::vector<float> gammaVector    = { 3.0f, 2.0f };
+    BatchNormalizationLayer* batchNormLayer =
+        graph.AddLayer<BatchNormalizationLayer>(batchNormDescriptor, "batchNorm");
+    batchNormLayer->m_Mean     = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, meanVector));
+    batchNormLayer->m_Variance = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, varianceVector));
+    batchNormLayer->m_Beta     = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, betaVector));
+    batchNormLayer->m_Gamma    = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, gammaVector));
+    batchNormLayer->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    // Connect up layers - input -> conv2d -> batchNorm -> output
+    input->GetOutputSlot().Connect(conv2dLayer->GetInputSlot(0));
+    conv2dLayer->GetOutputSlot().Connect(batchNormLayer->GetInputSlot(0));
+    batchNormLayer->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseBatchNormalizationIntoConvolution2d()));
+
+    auto checkFusedConv2d = [ ](const armnn::Layer* const layer) -> bool
+    {
+        if (!IsLayerOfType<armnn::Convolution2dLayer>(layer) ||
+            layer->GetNameStr() != "fused-batchNorm-into-conv2d")
+        {
+            return false;
+        }
+        const auto conv2dLayer = static_cast<const armnn::Convolution2dLayer*>(layer);
+        const float* weights = conv2dLayer->m_Weight->GetConstTensor<float>();
+        const float* bias = conv2dLayer->m_Bias->GetConstTensor<float>();
+
+        // scale = gamma / sqrt(variance) = { 1.5, 4 }
+        return conv2dLayer->GetParameters().m_BiasEnabled &&
+               weights[0] == 3.0f && weights[1] == -4.0f &&
+               bias[0] == 0.5f && bias[1] == 11.0f;
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+        graph.cend(),
+        &IsLayerOfType<armnn::InputLayer>,
+        checkFusedConv2d,
+        &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FuseBatchNormalizationIntoDepthwiseConvolution2dLayer)
+{
+    Graph graph;
+    const unsigned int inputShape[]   = { 1, 2, 1, 1 };
+    const unsigned int weightsShape[] = { 2, 2, 1, 1 };
+    const unsigned int outputShape[]  = { 1, 4, 1, 1 };
+    const unsigned int channelShape[] = { 4 };
+
+    armnn::TensorInfo inputInfo(4, inputShape, DataType::Float32);
+    armnn::TensorInfo outputInfo(4, outputShape, DataType::Float32);
+    armnn::TensorInfo channelInfo(1, channelShape, DataType::Float32);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    DepthwiseConvolution2dDescriptor depthwiseDescriptor;
+    depthwiseDescriptor.m_DataLayout = DataLayout::NCHW;
+
+    // Weights are [M, I, H, W] with a depth multiplier M of 2, so weight (m, i) feeds output channel i * 2 + m.
+    std::vector<float> weightsVector(4, 1.0f);
+    DepthwiseConvolution2dLayer* depthwiseLayer =
+        graph.AddLayer<DepthwiseConvolution2dLayer>(depthwiseDescriptor, "depthwise");
+    depthwiseLayer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo(4, weightsShape, DataType::Float32), weightsVector));
+    depthwiseLayer->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    BatchNormalizationDescriptor batchNormDescriptor;
+    batchNormDescriptor.m_Eps = 0.0f;
+    batchNormDescriptor.m_DataLayout = DataLayout::NCHW;
+
+    std::vector<float> meanVector     = { 0.0f, 0.0f, 0.0f, 0.0f };
+    std::vector<float> varianceVector = { 1.0f, 1.0f, 1.0f, 1.0f };
+    std::vector<float> betaVector     = { 0.0f, 1.0f, 2.0f, 3.0f };
+    std::vector<float> gammaVector    = { 1.0f, 2.0f, 3.0f, 4.0f };
+    BatchNormalizationLayer* batchNormLayer =
+        graph.AddLayer<BatchNormalizationLayer>(batchNormDescriptor, "batchNorm");
+    batchNormLayer->m_Mean     = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, meanVector));
+    batchNormLayer->m_Variance = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, varianceVector));
+    batchNormLayer->m_Beta     = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, betaVector));
+    batchNormLayer->m_Gamma    = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, gammaVector));
+    batchNormLayer->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    // Connect up layers - input -> depthwise -> batchNorm -> output
+    input->GetOutputSlot().Connect(depthwiseLayer->GetInputSlot(0));
+    depthwiseLayer->GetOutputSlot().Connect(batchNormLayer->GetInputSlot(0));
+    batchNormLayer->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseBatchNormalizationIntoDepthwiseConvolution2d()));
+
+    auto checkFusedDepthwise = [ ](const armnn::Layer* const layer) -> bool
+    {
+        if (!IsLayerOfType<armnn::DepthwiseConvolution2dLayer>(layer) ||
+            layer->GetNameStr() != "fused-batchNorm-into-depthwise")
+        {
+            return false;
+        }
+        const auto depthwiseLayer = static_cast<const armnn::DepthwiseConvolution2dLayer*>(layer);
+        const float* weights = depthwiseLayer->m_Weight->GetConstTensor<float>();
+        const float* bias = depthwiseLayer->m_Bias->GetConstTensor<float>();
+
+        // Weights (0, 0), (0, 1), (1, 0) and (1, 1) take the scales of output channels 0, 2, 1 and 3.
+        return depthwiseLayer->GetParameters().m_BiasEnabled &&
+               weights[0] == 1.0f && weights[1] == 3.0f && weights[2] == 2.0f && weights[3] == 4.0f &&
+               bias[0] == 0.0f && bias[1] == 1.0f && bias[2] == 2.0f && bias[3] == 3.0f;
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+        graph.cend(),
+        &IsLayerOfType<armnn::InputLayer>,
+        checkFusedDepthwise,
+        &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FuseBatchNormalizationIntoConvolution2dLayerFloat16)
+{
+    Graph graph;
+    const unsigned int inputShape[]   = { 1, 2, 2, 1 };
+    const unsigned int weightsShape[] = { 2, 1, 1, 1 };
+    const unsigned int outputShape[]  = { 1, 2, 2, 2 };
+    const unsigned int channelShape[] = { 2 };
+
+    armnn::TensorInfo inputInfo(4, inputShape, DataType::Float16);
+    armnn::TensorInfo outputInfo(4, outputShape, DataType::Float16);
+    armnn::TensorInfo channelInfo(1, channelShape, DataType::Float16);
+
+    auto toHalf = [](const std::vector<float>& values)
+    {
+        std::vector<Half> halfValues(values.size());
+        armnnUtils::FloatingPointConverter::ConvertFloat32To16(values.data(), values.size(), halfValues.data());
+        return halfValues;
+    };
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    Convolution2dDescriptor convolution2dDescriptor;
+    convolution2dDescriptor.m_BiasEnabled = true;
+    convolution2dDescriptor.m_DataLayout = DataLayout::NHWC;
+
+    std::vector<Half> weightsVector = toHalf({ 2.0f, -1.0f });
+    std::vector<Half> biasVector    = toHalf({ 1.0f, 0.5f });
+    Convolution2dLayer* conv2dLayer = graph.AddLayer<Convolution2dLayer>(convolution2dDescriptor, "conv2d");
+    conv2dLayer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo(4, weightsShape, DataType::Float16), weightsVector));
+    conv2dLayer->m_Bias = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, biasVector));
+    conv2dLayer->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    BatchNormalizationDescriptor batchNormDescriptor;
+    batchNormDescriptor.m_Eps = 0.0f;
+    batchNormDescriptor.m_DataLayout = DataLayout::NHWC;
+
+    std::vector<Half> meanVector     = toHalf({ 1.0f, -2.0f });
+    std::vector<Half> varianceVector = toHalf({ 4.0f, 0.25f });
+    std::vector<Half> betaVector     = toHalf({ 0.5f, 1.0f });
+    std::vector<Half> gammaVector    = toHalf({ 3.0f, 2.0f });
+    BatchNormalizationLayer* batchNormLayer =
+        graph.AddLayer<BatchNormalizationLayer>(batchNormDescriptor, "batchNorm");
+    batchNormLayer->m_Mean     = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, meanVector));
+    batchNormLayer->m_Variance = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, varianceVector));
+    batchNormLayer->m_Beta     = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, betaVector));
+    batchNormLayer->m_Gamma    = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, gammaVector));
+    batchNormLayer->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    Layer* output = graph.AddLayer<OutputLayer>(0, "output");
+
+    // Connect up layers - input -> conv2d -> batchNorm -> output
+    input->GetOutputSlot().Connect(conv2dLayer->GetInputSlot(0));
+    conv2dLayer->GetOutputSlot().Connect(batchNormLayer->GetInputSlot(0));
+    batchNormLayer->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseBatchNormalizationIntoConvolution2d()));
+
+    auto checkFusedConv2d = [ ](const armnn::Layer* const layer) -> bool
+    {
+        if (!IsLayerOfType<armnn::Convolution2dLayer>(layer) ||
+            layer->GetNameStr() != "fused-batchNorm-into-conv2d")
+        {
+            return false;
+        }
+        const auto conv2dLayer = static_cast<const armnn::Convolution2dLayer*>(layer);
+        if (conv2dLayer->m_Weight->GetTensorInfo().GetDataType() != DataType::Float16 ||
+            conv2dLayer->m_Bias->GetTensorInfo().GetDataType() != DataType::Float16)
+        {
+            return false;
+        }
+        const Half* weights = conv2dLayer->m_Weight->GetConstTensor<Half>();
+        const Half* bias = conv2dLayer->m_Bias->GetConstTensor<Half>();
+
+        // scale = gamma / sqrt(variance) = { 1.5, 4 }, all results being exact in half precision
+        return conv2dLayer->GetParameters().m_BiasEnabled &&
+               weights[0] == Half(3.0f) && weights[1] == Half(-4.0f) &&
+               bias[0] == Half(0.5f) && bias[1] == Half(11.0f);
+    };
+
+    BOOST_TEST(CheckSequence(graph.cbegin(),
+        graph.cend(),
+        &IsLayerOfType<armnn::InputLayer>,
+        checkFusedConv2d,
+        &IsLayerOfType<armnn::OutputLayer>));
+}
+
+BOOST_AUTO_TEST_CASE(FuseBatchNormalizationIntoFullyConnectedLayerWithOtherConsumers)
+{
+    Graph graph;
+    armnn::TensorInfo inputInfo({ 1, 3 }, DataType::Float32);
+    armnn::TensorInfo outputInfo({ 1, 2 }, DataType::Float32);
+    armnn::TensorInfo channelInfo({ 2 }, DataType::Float32);
+
+    Layer* input = graph.AddLayer<InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(inputInfo);
+
+    std::vector<float> weightsVector(6, 1.0f);
+    FullyConnectedLayer* fullyConnectedLayer =
+        graph.AddLayer<FullyConnectedLayer>(FullyConnectedDescriptor(), "fullyConnected");
+    fullyConnectedLayer->m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+        ConstTensor(TensorInfo({ 3, 2 }, DataType::Float32), weightsVector));
+    fullyConnectedLayer->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    std::vector<float> channelVector(2, 1.0f);
+    BatchNormalizationLayer* batchNormLayer =
+        graph.AddLayer<BatchNormalizationLayer>(BatchNormalizationDescriptor(), "batchNorm");
+    batchNormLayer->m_Mean     = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, channelVector));
+    batchNormLayer->m_Variance = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, channelVector));
+    batchNormLayer->m_Beta     = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, channelVector));
+    batchNormLayer->m_Gamma    = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(channelInfo, channelVector));
+    batchNormLayer->GetOutputSlot().SetTensorInfo(outputInfo);
+
+    Layer* output0 = graph.AddLayer<OutputLayer>(0, "output0");
+    Layer* output1 = graph.AddLayer<OutputLayer>(1, "output1");
+
+    // Connect up layers - input -> fullyConnected -> batchNorm -> output0
+    //                                             -> output1
+    input->GetOutputSlot().Connect(fullyConnectedLayer->GetInputSlot(0));
+    fullyConnectedLayer->GetOutputSlot().Connect(batchNormLayer->GetInputSlot(0));
+    fullyConnectedLayer->GetOutputSlot().Connect(output1->GetInputSlot(0));
+    batchNormLayer->GetOutputSlot().Connect(output0->GetInputSlot(0));
+
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(FuseBatchNormalizationIntoFullyConnected()));
+
+    // The fully connected output is still needed by output1, so nothing is fused.
+    BOOST_TEST(graph.GetNumLayers() == 5);
+    BOOST_TEST(fullyConnectedLayer->GetParameters().m_BiasEnabled == false);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
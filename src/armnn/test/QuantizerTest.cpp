@@ -17,6 +17,7 @@
 #include "../backends/backendsCommon/test/QuantizeHelper.hpp"
 #include "../../armnnQuantizer/CommandLineProcessor.hpp"
 
+#include <boost/core/ignore_unused.hpp>
 #include <boost/test/unit_test.hpp>
 
 #include <unordered_map>
@@ -347,6 +348,211 @@ BOOST_AUTO_TEST_CASE(InputOutputLayerDynamicQuant)
     quantizedNetwork->Accept(visitor);
 }
 
+BOOST_AUTO_TEST_CASE(InputOutputLayerDynamicQuantBatch)
+{
+    INetworkPtr network = CreateNetworkWithInputOutputLayers();
+
+    armnn::TensorInfo tensorInfo = GetInputTensorInfo(boost::polymorphic_downcast<const Network*>(network.get()));
+
+    // Outliers -56 and 98, -77 and 65, and none
+    std::vector<std::vector<float>> inputData{ { 0,   0, 0, -56, 98, 0, 0, 0 },
+                                               { 0, -77, 0, -56, 65, 0, 0, 0 },
+                                               { 1,   2, 3,   4,  5, 6, 7, 8 } };
+    std::vector<InputTensors> inputTensorsBatch;
+    for (const std::vector<float>& data : inputData)
+    {
+        inputTensorsBatch.push_back(InputTensors{ std::make_pair(0, armnn::ConstTensor(tensorInfo, data.data())) });
+    }
+
+    QuantizerOptions options;
+    options.m_NumCalibrationThreads = 2;
+    armnn::INetworkQuantizerPtr quantizer = armnn::INetworkQuantizer::Create(network.get(), options);
+
+    // The batch runs on two copies of the network, whose ranges are merged
+    quantizer->Refine(inputTensorsBatch);
+
+    // Outlier -80, refined by a single copy of the network
+    std::vector<float> inputData2({0, 0, 0, 0, 0, 0, 0, -80});
+    quantizer->Refine(InputTensors{ std::make_pair(0, armnn::ConstTensor(tensorInfo, inputData2.data())) });
+
+    INetworkPtr quantizedNetwork = quantizer->ExportNetwork();
+
+    // Output Layer should be quantized for a min max of -80 and 98
+    // according to QAsymm8 Quantization Scheme
+    const OffsetScalePair qParams = QAsymm8QuantizationScheme().ComputeScheme(-80.0, 98.0);
+
+    class TestOutputLayerVisitor : public LayerVisitorBase<VisitorNoThrowPolicy>
+    {
+    public:
+        TestOutputLayerVisitor(const OffsetScalePair& offsetScalePair) : m_OffsetScalePair(offsetScalePair) {}
+
+        void VisitOutputLayer(const IConnectableLayer* layer,
+                              LayerBindingId id,
+                              const char* name = nullptr) override
+        {
+            boost::ignore_unused(id, name);
+            const TensorInfo& info = layer->GetInputSlot(0).GetConnection()->GetTensorInfo();
+            BOOST_CHECK(info.GetQuantizationOffset() == m_OffsetScalePair.second);
+            BOOST_TEST(info.GetQuantizationScale() == m_OffsetScalePair.first, boost::test_tools::tolerance(0.001));
+        }
+
+    private:
+        const OffsetScalePair m_OffsetScalePair;
+    };
+
+    TestOutputLayerVisitor visitor(qParams);
+    quantizedNetwork->Accept(visitor);
+}
+
+BOOST_AUTO_TEST_CASE(MergeRangeTrackers)
+{
+    Network network;
+    IConnectableLayer* input0 = network.AddInputLayer(0);
+    IConnectableLayer* input1 = network.AddInputLayer(1);
+
+    RangeTracker ranges;
+    ranges.SetRange(input0, 0, -1.0f, 2.0f);
+
+    RangeTracker otherRanges;
+    otherRanges.SetRange(input0, 0, -3.0f, 1.0f);
+    otherRanges.SetRange(input1, 0, 4.0f, 5.0f);
+
+    ranges.Merge(otherRanges);
+
+    // The ranges of the layers in both trackers are widened to cover both, the others are added
+    BOOST_CHECK(ranges.GetRange(input0->GetGuid(), 0) == MinMaxRange(-3.0f, 2.0f));
+    BOOST_CHECK(ranges.GetRange(input1->GetGuid(), 0) == MinMaxRange(4.0f, 5.0f));
+}
+
+BOOST_AUTO_TEST_CASE(HistogramPercentileRange)
+{
+    std::vector<float> values(10000);
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<float>(i);
+    }
+
+    // Adding the values in two halves, with different ranges, is the same as adding them at once
+    Histogram histogram;
+    histogram.Add(values.data(), 10000, 0.0f, 9999.0f);
+
+    Histogram firstHalf;
+    Histogram secondHalf;
+    firstHalf.Add(values.data(), 5000, 0.0f, 4999.0f);
+    secondHalf.Add(values.data() + 5000, 5000, 5000.0f, 9999.0f);
+    firstHalf.Merge(secondHalf);
+
+    for (const Histogram& h : { histogram, firstHalf })
+    {
+        BOOST_CHECK(h.SelectRange(CalibrationMethod::MinMax, 99.0f, 256) == MinMaxRange(0.0f, 9999.0f));
+
+        // 1% of the values is left out of range on either side
+        MinMaxRange range = h.SelectRange(CalibrationMethod::Percentile, 99.0f, 256);
+        BOOST_TEST(range.first == 100.0f, boost::test_tools::tolerance(0.01f));
+        BOOST_TEST(range.second == 9900.0f, boost::test_tools::tolerance(0.001f));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(HistogramSearchedRangesClipOutliers)
+{
+    // Values spread evenly over [-1, 1], and an outlier
+    std::vector<float> values(10001);
+    for (unsigned int i = 0; i < 10000; ++i)
+    {
+        values[i] = -1.0f + 2.0f * static_cast<float>(i) / 9999.0f;
+    }
+    values[10000] = 20.0f;
+
+    Histogram histogram;
+    histogram.Add(values.data(), 10001, -1.0f, 20.0f);
+
+    // With 256 levels, the outlier costs less divergence clipped than the rounding of the other values in range
+    MinMaxRange range = histogram.SelectRange(CalibrationMethod::Entropy, 0.0f, 256);
+    BOOST_TEST(range.first == -1.0f);
+    BOOST_TEST(range.second == 1.0f, boost::test_tools::tolerance(0.05f));
+
+    // Whereas its squared error only outweighs the rounding error with much coarser levels
+    range = histogram.SelectRange(CalibrationMethod::Mse, 0.0f, 256);
+    BOOST_TEST(range.second > 10.0f);
+
+    range = histogram.SelectRange(CalibrationMethod::Mse, 0.0f, 16);
+    BOOST_TEST(range.first == -1.0f);
+    BOOST_TEST(range.second < 5.0f);
+}
+
+BOOST_AUTO_TEST_CASE(InputOutputLayerDynamicQuantPercentile)
+{
+    INetworkPtr network = CreateNetworkWithInputOutputLayers();
+
+    armnn::TensorInfo tensorInfo = GetInputTensorInfo(boost::polymorphic_downcast<const Network*>(network.get()));
+
+    // The values 0 to 999, over 125 inputs of 8 values
+    std::vector<std::vector<float>> inputData(125, std::vector<float>(8));
+    std::vector<InputTensors> inputTensorsBatch;
+    for (unsigned int i = 0; i < inputData.size(); ++i)
+    {
+        for (unsigned int j = 0; j < 8; ++j)
+        {
+            inputData[i][j] = static_cast<float>(i * 8 + j);
+        }
+        inputTensorsBatch.push_back(
+            InputTensors{ std::make_pair(0, armnn::ConstTensor(tensorInfo, inputData[i].data())) });
+    }
+
+    QuantizerOptions options;
+    options.m_CalibrationMethod = CalibrationMethod::Percentile;
+    options.m_CalibrationPercentile = 90.0f;
+    armnn::INetworkQuantizerPtr quantizer = armnn::INetworkQuantizer::Create(network.get(), options);
+    quantizer->Refine(inputTensorsBatch);
+    INetworkPtr quantizedNetwork = quantizer->ExportNetwork();
+
+    // The range is cut at the 90th percentile of the values, and extended down to 0 by the quantization scheme
+    const OffsetScalePair qParams = QAsymm8QuantizationScheme().ComputeScheme(0.0, 900.0);
+
+    class TestOutputLayerVisitor : public LayerVisitorBase<VisitorNoThrowPolicy>
+    {
+    public:
+        TestOutputLayerVisitor(const OffsetScalePair& offsetScalePair) : m_OffsetScalePair(offsetScalePair) {}
+
+        void VisitOutputLayer(const IConnectableLayer* layer,
+                              LayerBindingId id,
+                              const char* name = nullptr) override
+        {
+            boost::ignore_unused(id, name);
+            const TensorInfo& info = layer->GetInputSlot(0).GetConnection()->GetTensorInfo();
+            BOOST_CHECK(info.GetQuantizationOffset() == m_OffsetScalePair.second);
+            BOOST_TEST(info.GetQuantizationScale() == m_OffsetScalePair.first, boost::test_tools::tolerance(0.001f));
+        }
+
+    private:
+        const OffsetScalePair m_OffsetScalePair;
+    };
+
+    TestOutputLayerVisitor visitor(qParams);
+    quantizedNetwork->Accept(visitor);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidCalibrationPercentile)
+{
+    INetworkPtr network = CreateNetworkWithInputOutputLayers();
+
+    QuantizerOptions options;
+    options.m_CalibrationMethod = CalibrationMethod::Percentile;
+    for (float percentile : { 50.0f, 10.0f, -1.0f, 100.5f })
+    {
+        options.m_CalibrationPercentile = percentile;
+        BOOST_CHECK_THROW(INetworkQuantizer::Create(network.get(), options), InvalidArgumentException);
+    }
+
+    options.m_CalibrationPercentile = 100.0f;
+    BOOST_CHECK_NO_THROW(INetworkQuantizer::Create(network.get(), options));
+
+    // The percentile is not used by the other methods
+    options.m_CalibrationMethod = CalibrationMethod::MinMax;
+    options.m_CalibrationPercentile = 10.0f;
+    BOOST_CHECK_NO_THROW(INetworkQuantizer::Create(network.get(), options));
+}
+
 BOOST_AUTO_TEST_CASE(QuantizeAbsActivation)
 {
     ActivationDescriptor descriptor;
@@ -934,6 +1140,86 @@ BOOST_AUTO_TEST_CASE(QuantizeConvolution2dWithBiases)
     TestQuantizeConvolution2d(true);
 }
 
+BOOST_AUTO_TEST_CASE(QuantizeConvolution2dPerChannelWeights)
+{
+    class TestConv2dPerChannelQuantization : public TestQuantization
+    {
+    public:
+        TestConv2dPerChannelQuantization(const QuantizerOptions& options,
+                                         const TensorShape& inputShape,
+                                         const TensorShape& outputShape)
+        : TestQuantization(options, inputShape, outputShape) {}
+
+        void VisitConvolution2dLayer(const IConnectableLayer* layer,
+                                     const Convolution2dDescriptor& convolution2dDescriptor,
+                                     const ConstTensor& weights,
+                                     const Optional<ConstTensor>& biases,
+                                     const char* name = nullptr) override
+        {
+            const float inputScale = 30.0f / g_Asymm8QuantizationBase;
+
+            // One symmetric scale per output channel, from the largest magnitude in that channel
+            const TensorInfo& weightsInfo = weights.GetInfo();
+            BOOST_TEST((weightsInfo.GetDataType() == DataType::QuantisedSymm8PerAxis));
+            BOOST_TEST(weightsInfo.HasPerAxisQuantization());
+            BOOST_TEST(weightsInfo.GetQuantizationDim().value() == 0);
+            BOOST_TEST(weightsInfo.GetQuantizationScales().size() == 2);
+            BOOST_CHECK_CLOSE(weightsInfo.GetQuantizationScales()[0], 2.0f / 127.0f, g_TestTolerance);
+            BOOST_CHECK_CLOSE(weightsInfo.GetQuantizationScales()[1], 4.0f / 127.0f, g_TestTolerance);
+
+            const int8_t* weightsData = static_cast<const int8_t*>(weights.GetMemoryArea());
+            BOOST_TEST(weightsData[0] == -64);
+            BOOST_TEST(weightsData[1] == 127);
+            BOOST_TEST(weightsData[2] == 32);
+            BOOST_TEST(weightsData[3] == -127);
+
+            // The bias of each output channel is quantized with the scale of its weights
+            BOOST_CHECK(biases.has_value());
+            const TensorInfo& biasesInfo = biases.value().GetInfo();
+            BOOST_TEST((biasesInfo.GetDataType() == DataType::Signed32));
+            BOOST_TEST(biasesInfo.HasPerAxisQuantization());
+            BOOST_TEST(biasesInfo.GetQuantizationScales().size() == 2);
+            BOOST_CHECK_CLOSE(biasesInfo.GetQuantizationScales()[0], inputScale * 2.0f / 127.0f, g_TestTolerance);
+            BOOST_CHECK_CLOSE(biasesInfo.GetQuantizationScales()[1], inputScale * 4.0f / 127.0f, g_TestTolerance);
+
+            TestQuantizationParams(layer->GetOutputSlot(0).GetTensorInfo(), {inputScale, 128}, {0.0f, 0});
+        }
+    };
+
+    INetworkPtr network = INetwork::Create();
+
+    const TensorShape shape{1, 1, 1, 2};
+    TensorInfo info(shape, DataType::Float32);
+
+    // Two output channels of a 1x1 convolution over two input channels, in OHWI order
+    TensorInfo weightsInfo(TensorShape{2, 1, 1, 2}, DataType::Float32);
+    std::vector<float> weightsData{-1.0f, 2.0f, 1.0f, -4.0f};
+    ConstTensor weights(weightsInfo, weightsData);
+
+    TensorInfo biasesInfo(TensorShape{2}, DataType::Float32);
+    std::vector<float> biasesData{0.5f, -0.5f};
+    ConstTensor biases(biasesInfo, biasesData);
+
+    Convolution2dDescriptor descriptor;
+    descriptor.m_BiasEnabled = true;
+    descriptor.m_DataLayout = DataLayout::NHWC;
+
+    IConnectableLayer* input0 = network->AddInputLayer(0);
+    IConnectableLayer* conv2d = network->AddConvolution2dLayer(descriptor, weights, Optional<ConstTensor>(biases));
+    IConnectableLayer* output = network->AddOutputLayer(1);
+
+    input0->GetOutputSlot(0).Connect(conv2d->GetInputSlot(0));
+    conv2d->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input0->GetOutputSlot(0).SetTensorInfo(info);
+    conv2d->GetOutputSlot(0).SetTensorInfo(info);
+
+    const QuantizerOptions options(DataType::QuantisedAsymm8, false, true);
+    INetworkPtr quantizedNetwork = INetworkQuantizer::Create(network.get(), options)->ExportNetwork();
+    TestConv2dPerChannelQuantization validator(options, shape, shape);
+    VisitLayersTopologically(quantizedNetwork.get(), validator);
+}
+
 void TestQuantizeDepthwiseConvolution2d(bool useBiases)
 {
     class TestDepthwiseConv2dQuantization : public TestQuantization
@@ -1009,6 +1295,84 @@ BOOST_AUTO_TEST_CASE(QuantizeDepthwiseConvolution2dWithBiases)
     TestQuantizeDepthwiseConvolution2d(true);
 }
 
+BOOST_AUTO_TEST_CASE(QuantizeDepthwiseConvolution2dPerChannelWeights)
+{
+    class TestDepthwiseConv2dPerChannelQuantization : public TestQuantization
+    {
+    public:
+        TestDepthwiseConv2dPerChannelQuantization(const QuantizerOptions& options,
+                                                  const TensorShape& inputShape,
+                                                  const TensorShape& outputShape)
+        : TestQuantization(options, inputShape, outputShape)
+        , m_ActivationFormat(options.m_ActivationFormat) {}
+
+        void VisitDepthwiseConvolution2dLayer(const IConnectableLayer* layer,
+                                              const DepthwiseConvolution2dDescriptor& convolution2dDescriptor,
+                                              const ConstTensor& weights,
+                                              const Optional<ConstTensor>& biases,
+                                              const char* name = nullptr) override
+        {
+            const TensorInfo& weightsInfo = weights.GetInfo();
+            if (m_ActivationFormat == DataType::QuantisedAsymm8)
+            {
+                // One symmetric scale per input channel, from the largest magnitude in that channel
+                BOOST_TEST((weightsInfo.GetDataType() == DataType::QuantisedSymm8PerAxis));
+                BOOST_TEST(weightsInfo.GetQuantizationDim().value() == 1);
+                BOOST_TEST(weightsInfo.GetQuantizationScales().size() == 2);
+                BOOST_CHECK_CLOSE(weightsInfo.GetQuantizationScales()[0], 1.0f / 127.0f, g_TestTolerance);
+                BOOST_CHECK_CLOSE(weightsInfo.GetQuantizationScales()[1], 4.0f / 127.0f, g_TestTolerance);
+            }
+            else
+            {
+                // Depthwise convolutions do not take per-axis weights with QuantisedSymm16 inputs, so the
+                // weights are quantized per tensor as without the option
+                BOOST_TEST((weightsInfo.GetDataType() == DataType::QuantisedAsymm8));
+                BOOST_TEST(!weightsInfo.HasPerAxisQuantization());
+                TestConstantQuantizationParams(weightsInfo, {5.0f / g_Asymm8QuantizationBase, 51});
+            }
+        }
+
+    private:
+        DataType m_ActivationFormat;
+    };
+
+    INetworkPtr network = INetwork::Create();
+
+    const TensorShape shape{1, 1, 1, 2};
+    TensorInfo info(shape, DataType::Float32);
+
+    // A depth multiplier of 1 over two input channels, in [M, I, H, W] order
+    TensorInfo weightsInfo(TensorShape{1, 2, 1, 1}, DataType::Float32);
+    std::vector<float> weightsData{-1.0f, 4.0f};
+    ConstTensor weights(weightsInfo, weightsData);
+
+    DepthwiseConvolution2dDescriptor descriptor;
+    descriptor.m_DataLayout = DataLayout::NHWC;
+
+    IConnectableLayer* input0 = network->AddInputLayer(0);
+    IConnectableLayer* depthwiseConv2d =
+        network->AddDepthwiseConvolution2dLayer(descriptor, weights, EmptyOptional());
+    IConnectableLayer* output = network->AddOutputLayer(1);
+
+    input0->GetOutputSlot(0).Connect(depthwiseConv2d->GetInputSlot(0));
+    depthwiseConv2d->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input0->GetOutputSlot(0).SetTensorInfo(info);
+    depthwiseConv2d->GetOutputSlot(0).SetTensorInfo(info);
+
+    const QuantizerOptions qAsymm8Options(DataType::QuantisedAsymm8, false, true);
+    INetworkPtr quantizedNetworkQAsymm8 =
+        INetworkQuantizer::Create(network.get(), qAsymm8Options)->ExportNetwork();
+    TestDepthwiseConv2dPerChannelQuantization validatorQAsymm8(qAsymm8Options, shape, shape);
+    VisitLayersTopologically(quantizedNetworkQAsymm8.get(), validatorQAsymm8);
+
+    const QuantizerOptions qSymm16Options(DataType::QuantisedSymm16, false, true);
+    INetworkPtr quantizedNetworkQSymm16 =
+        INetworkQuantizer::Create(network.get(), qSymm16Options)->ExportNetwork();
+    TestDepthwiseConv2dPerChannelQuantization validatorQSymm16(qSymm16Options, shape, shape);
+    VisitLayersTopologically(quantizedNetworkQSymm16.get(), validatorQSymm16);
+}
+
 BOOST_AUTO_TEST_CASE(QuantizeInstanceNormalization)
 {
     class TestInstanceNormalizationQuantization : public TestQuantization
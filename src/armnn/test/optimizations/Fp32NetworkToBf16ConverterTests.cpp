@@ -0,0 +1,63 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "../TestUtils.hpp"
+
+#include <BFloat16.hpp>
+#include <Optimizer.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(Optimizer)
+using namespace armnn::optimizations;
+
+BOOST_AUTO_TEST_CASE(Fp32NetworkToBf16OptimizationFullyConnectedTest)
+{
+    armnn::Graph graph;
+
+    const armnn::TensorInfo infoFP32({ 1, 2 }, armnn::DataType::Float32);
+
+    std::vector<float> floatWeights{ 1.0f, 3.1f, -2.0f, 1.0f + 3.0f / 256.0f };
+    armnn::ConstTensor weights(armnn::TensorInfo({ 2, 2 }, armnn::DataType::Float32), floatWeights);
+
+    // Create the simple test network
+    auto input = graph.AddLayer<armnn::InputLayer>(0, "input");
+    input->GetOutputSlot().SetTensorInfo(infoFP32);
+
+    auto fc      = graph.AddLayer<armnn::FullyConnectedLayer>(armnn::FullyConnectedDescriptor(), "fc");
+    fc->m_Weight = std::make_unique<armnn::ScopedCpuTensorHandle>(weights);
+    fc->GetOutputSlot().SetTensorInfo(infoFP32);
+
+    auto floor = graph.AddLayer<armnn::FloorLayer>("floor");
+    floor->GetOutputSlot().SetTensorInfo(infoFP32);
+
+    auto output = graph.AddLayer<armnn::OutputLayer>(1, "output");
+
+    // Connect up the layers
+    input->GetOutputSlot().Connect(fc->GetInputSlot(0));
+    fc->GetOutputSlot().Connect(floor->GetInputSlot(0));
+    floor->GetOutputSlot().Connect(output->GetInputSlot(0));
+
+    // Run the optimizer
+    armnn::Optimizer::Pass(graph, armnn::MakeOptimizations(Fp32NetworkToBf16Converter()));
+
+    // Only the input of the fully connected layer is converted: its output and the floor stay in Float32
+    BOOST_TEST(CheckSequence(graph.cbegin(), graph.cend(), &IsLayerOfType<armnn::InputLayer>,
+                             &IsLayerOfType<armnn::ConvertFp32ToBf16Layer>, &IsLayerOfType<armnn::FullyConnectedLayer>,
+                             &IsLayerOfType<armnn::FloorLayer>, &IsLayerOfType<armnn::OutputLayer>));
+
+    BOOST_TEST((fc->GetInputSlot(0).GetConnection()->GetTensorInfo().GetDataType() == armnn::DataType::BFloat16));
+    BOOST_TEST((fc->GetOutputSlot().GetTensorInfo().GetDataType() == armnn::DataType::Float32));
+    BOOST_TEST((fc->m_Weight->GetTensorInfo().GetDataType() == armnn::DataType::BFloat16));
+
+    // The weights are rounded to the nearest BFloat16 value
+    const armnn::BFloat16* data = fc->m_Weight->GetConstTensor<armnn::BFloat16>();
+    BOOST_CHECK_EQUAL(static_cast<float>(data[0]), 1.0f);
+    BOOST_CHECK_EQUAL(static_cast<float>(data[1]), 3.09375f);
+    BOOST_CHECK_EQUAL(static_cast<float>(data[2]), -2.0f);
+    BOOST_CHECK_EQUAL(static_cast<float>(data[3]), 1.0f + 4.0f / 256.0f);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
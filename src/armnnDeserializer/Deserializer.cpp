@@ -451,6 +451,9 @@ armnn::TensorInfo ToTensorInfo(Deserializer::TensorRawPtr tensorPtr)
         case DataType_QuantisedSymm16:
             type = armnn::DataType::QuantisedSymm16;
             break;
+        case DataType_QuantisedSymm8PerAxis:
+            type = armnn::DataType::QuantisedSymm8PerAxis;
+            break;
         case DataType_Signed32:
             type = armnn::DataType::Signed32;
             break;
@@ -481,6 +484,18 @@ armnn::TensorInfo ToTensorInfo(Deserializer::TensorRawPtr tensorPtr)
     unsigned int size = dimensions->size();
     std::vector<unsigned int> outputDims(dimensions->begin(), dimensions->begin() + size);
 
+    auto quantizationScales = tensorPtr->quantizationScales();
+    if (quantizationScales != nullptr && quantizationScales->size() > 0)
+    {
+        std::vector<float> scales(quantizationScales->begin(), quantizationScales->end());
+        armnn::TensorInfo result(size,
+                                 outputDims.data(),
+                                 type,
+                                 scales,
+                                 tensorPtr->quantizationDim());
+        return result;
+    }
+
     // two statements (on purpose) for easier debugging:
     armnn::TensorInfo result(size,
                              outputDims.data(),
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: MIT
 //
 
+#include "CalibrationDataFile.hpp"
 #include "CommandLineProcessor.hpp"
 #include <armnnDeserializer/IDeserializer.hpp>
 #include <armnnQuantizer/INetworkQuantizer.hpp>
@@ -13,6 +14,56 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <thread>
+
+namespace
+{
+
+// Refine with batches of a few passes per thread, so that the threads are kept busy without
+// reading the whole data set in memory
+size_t GetCalibrationBatchSize(unsigned int numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    return 4 * numThreads;
+}
+
+void RefineFromCalibrationDataFile(armnn::INetworkQuantizer& quantizer,
+                                   armnnQuantizer::InputLayerVisitor& inputLayerVisitor,
+                                   const std::string& fileName,
+                                   size_t batchSize)
+{
+    armnnQuantizer::CalibrationDataFile calibrationDataFile(fileName);
+    for (const armnn::BindingPointInfo& input : calibrationDataFile.GetInputs())
+    {
+        const armnn::TensorInfo tensorInfo = inputLayerVisitor.GetTensorInfo(input.first);
+        if (input.second.GetDataType() != armnn::DataType::Float32 ||
+            input.second.GetShape() != tensorInfo.GetShape())
+        {
+            throw armnn::InvalidArgumentException("Calibration data file [" + fileName + "] does not match the " +
+                                                  "input with binding ID " + std::to_string(input.first));
+        }
+    }
+
+    // The records are read in the background one batch ahead of the one being refined
+    const size_t numRecords = calibrationDataFile.GetNumRecords();
+    calibrationDataFile.Prefetch(0, batchSize);
+    for (size_t firstRecord = 0; firstRecord < numRecords; firstRecord += batchSize)
+    {
+        calibrationDataFile.Prefetch(firstRecord + batchSize, batchSize);
+
+        std::vector<armnn::InputTensors> inputTensorsBatch;
+        for (size_t record = firstRecord; record < std::min(firstRecord + batchSize, numRecords); ++record)
+        {
+            inputTensorsBatch.push_back(calibrationDataFile.GetRecord(record));
+        }
+        quantizer.Refine(inputTensorsBatch);
+    }
+}
+
+} // anonymous namespace
 
 int main(int argc, char* argv[])
 {
@@ -41,19 +92,57 @@ int main(int argc, char* argv[])
                                           : armnn::DataType::QuantisedAsymm8;
 
     quantizerOptions.m_PreserveType = cmdline.HasPreservedDataType();
+    quantizerOptions.m_NumCalibrationThreads = cmdline.GetNumThreads();
+
+    const std::string calibrationMethod = cmdline.GetCalibrationMethod();
+    if (calibrationMethod == "Percentile")
+    {
+        quantizerOptions.m_CalibrationMethod = armnn::CalibrationMethod::Percentile;
+    }
+    else if (calibrationMethod == "Entropy")
+    {
+        quantizerOptions.m_CalibrationMethod = armnn::CalibrationMethod::Entropy;
+    }
+    else if (calibrationMethod == "Mse")
+    {
+        quantizerOptions.m_CalibrationMethod = armnn::CalibrationMethod::Mse;
+    }
+    else
+    {
+        quantizerOptions.m_CalibrationMethod = armnn::CalibrationMethod::MinMax;
+    }
+    quantizerOptions.m_CalibrationPercentile = cmdline.GetCalibrationPercentile();
 
     armnn::INetworkPtr network = parser->CreateNetworkFromBinary(binaryContent);
     armnn::INetworkQuantizerPtr quantizer = armnn::INetworkQuantizer::Create(network.get(), quantizerOptions);
 
-    if (cmdline.HasQuantizationData())
+    const size_t batchSize = GetCalibrationBatchSize(cmdline.GetNumThreads());
+    if (!cmdline.GetCalibrationFileName().empty())
+    {
+        armnnQuantizer::InputLayerVisitor inputLayerVisitor;
+        network->Accept(inputLayerVisitor);
+        RefineFromCalibrationDataFile(*quantizer, inputLayerVisitor, cmdline.GetCalibrationFileName(), batchSize);
+    }
+    else if (cmdline.HasQuantizationData())
     {
         armnnQuantizer::QuantizationDataSet dataSet = cmdline.GetQuantizationDataSet();
-        if (!dataSet.IsEmpty())
+        if (!dataSet.IsEmpty() && !cmdline.GetOutputCalibrationFileName().empty())
+        {
+            armnnQuantizer::InputLayerVisitor inputLayerVisitor;
+            network->Accept(inputLayerVisitor);
+
+            const std::string calibrationFileName = cmdline.GetOutputCalibrationFileName();
+            armnnQuantizer::ConvertToCalibrationDataFile(dataSet, inputLayerVisitor, calibrationFileName);
+            RefineFromCalibrationDataFile(*quantizer, inputLayerVisitor, calibrationFileName, batchSize);
+        }
+        else if (!dataSet.IsEmpty())
         {
             // Get the Input Tensor Infos
             armnnQuantizer::InputLayerVisitor inputLayerVisitor;
             network->Accept(inputLayerVisitor);
 
+            std::vector<armnn::InputTensors> inputTensorsBatch;
+            std::vector<std::vector<std::vector<float>>> inputDataBatch;
             for (armnnQuantizer::QuantizationInput quantizationInput : dataSet)
             {
                 armnn::InputTensors inputTensors;
@@ -68,8 +157,18 @@ int main(int argc, char* argv[])
                     inputTensors.push_back(std::make_pair(layerBindingId, inputTensor));
                     count++;
                 }
-                quantizer->Refine(inputTensors);
+                // The tensors point into the vectors held by inputData, which moving it does not change
+                inputDataBatch.push_back(std::move(inputData));
+                inputTensorsBatch.push_back(inputTensors);
+
+                if (inputTensorsBatch.size() == batchSize)
+                {
+                    quantizer->Refine(inputTensorsBatch);
+                    inputTensorsBatch.clear();
+                    inputDataBatch.clear();
+                }
             }
+            quantizer->Refine(inputTensorsBatch);
         }
     }
 
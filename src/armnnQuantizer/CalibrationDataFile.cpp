@@ -0,0 +1,356 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "CalibrationDataFile.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace armnnQuantizer
+{
+
+namespace
+{
+
+const char g_CalibrationDataMagic[8] = { 'A', 'R', 'M', 'N', 'N', 'C', 'A', 'L' };
+constexpr uint32_t g_CalibrationDataVersion = 1;
+
+size_t AlignUp(size_t size)
+{
+    return (size + g_CalibrationDataAlignment - 1) / g_CalibrationDataAlignment * g_CalibrationDataAlignment;
+}
+
+template <typename T>
+void Write(std::ofstream& stream, T value)
+{
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/// Reads the header fields one after the other, checking they lie within the file.
+class HeaderReader
+{
+public:
+    HeaderReader(const uint8_t* data, size_t size, const std::string& filePath)
+        : m_Data(data), m_Size(size), m_Offset(0), m_FilePath(filePath) {}
+
+    template <typename T>
+    T Read()
+    {
+        T value;
+        ReadBytes(&value, sizeof(value));
+        return value;
+    }
+
+    void ReadBytes(void* destination, size_t numBytes)
+    {
+        if (m_Offset + numBytes > m_Size)
+        {
+            throw armnn::ParseException("Calibration data file [" + m_FilePath + "] has a truncated header");
+        }
+        std::memcpy(destination, m_Data + m_Offset, numBytes);
+        m_Offset += numBytes;
+    }
+
+    size_t GetOffset() const { return m_Offset; }
+
+private:
+    const uint8_t* m_Data;
+    size_t m_Size;
+    size_t m_Offset;
+    const std::string& m_FilePath;
+};
+
+} // anonymous namespace
+
+CalibrationDataWriter::CalibrationDataWriter(const std::string& filePath,
+                                             const std::vector<armnn::BindingPointInfo>& inputs)
+    : m_FilePath(filePath)
+    , m_Stream(filePath, std::ios::binary)
+    , m_Inputs(inputs)
+    , m_NumRecords(0)
+{
+    if (!m_Stream)
+    {
+        throw armnn::Exception("Failed to open calibration data file [" + filePath + "] for writing");
+    }
+
+    m_Stream.write(g_CalibrationDataMagic, sizeof(g_CalibrationDataMagic));
+    Write(m_Stream, g_CalibrationDataVersion);
+    Write(m_Stream, static_cast<uint32_t>(m_Inputs.size()));
+    Write(m_Stream, m_NumRecords);
+    for (const armnn::BindingPointInfo& input : m_Inputs)
+    {
+        const armnn::TensorShape& shape = input.second.GetShape();
+        Write(m_Stream, static_cast<int32_t>(input.first));
+        Write(m_Stream, static_cast<uint32_t>(input.second.GetDataType()));
+        Write(m_Stream, static_cast<uint32_t>(shape.GetNumDimensions()));
+        for (unsigned int i = 0; i < shape.GetNumDimensions(); ++i)
+        {
+            Write(m_Stream, static_cast<uint32_t>(shape[i]));
+        }
+    }
+    WritePadding(m_Stream.tellp());
+}
+
+CalibrationDataWriter::~CalibrationDataWriter()
+{
+    if (m_Stream.is_open())
+    {
+        try
+        {
+            Close();
+        }
+        catch (const armnn::Exception&)
+        {
+            // Destructors must not throw: callers that need to know whether the file is complete call Close()
+        }
+    }
+}
+
+void CalibrationDataWriter::AddRecord(const std::vector<const void*>& inputData)
+{
+    if (inputData.size() != m_Inputs.size())
+    {
+        throw armnn::InvalidArgumentException("Calibration data record has " + std::to_string(inputData.size()) +
+                                              " inputs, expected " + std::to_string(m_Inputs.size()));
+    }
+
+    for (size_t i = 0; i < m_Inputs.size(); ++i)
+    {
+        const unsigned int numBytes = m_Inputs[i].second.GetNumBytes();
+        m_Stream.write(static_cast<const char*>(inputData[i]), numBytes);
+        WritePadding(numBytes);
+    }
+    ++m_NumRecords;
+}
+
+void CalibrationDataWriter::Close()
+{
+    // The number of records follows the magic, the version and the number of inputs
+    m_Stream.seekp(sizeof(g_CalibrationDataMagic) + 2 * sizeof(uint32_t));
+    Write(m_Stream, m_NumRecords);
+    m_Stream.close();
+
+    if (!m_Stream)
+    {
+        throw armnn::Exception("Failed to write calibration data file [" + m_FilePath + "]");
+    }
+}
+
+void CalibrationDataWriter::WritePadding(std::streamoff size)
+{
+    const size_t unpaddedSize = static_cast<size_t>(size);
+    const std::vector<char> padding(AlignUp(unpaddedSize) - unpaddedSize, 0);
+    m_Stream.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+}
+
+CalibrationDataFile::CalibrationDataFile(const std::string& filePath)
+    : m_FilePath(filePath)
+    , m_Data(nullptr)
+    , m_Size(0)
+    , m_RecordsOffset(0)
+    , m_RecordSize(0)
+    , m_NumRecords(0)
+{
+    const int fileDescriptor = open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        throw armnn::FileNotFoundException("Failed to open calibration data file [" + filePath + "]");
+    }
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size == 0)
+    {
+        close(fileDescriptor);
+        throw armnn::ParseException("Calibration data file [" + filePath + "] is empty");
+    }
+    m_Size = static_cast<size_t>(fileStatus.st_size);
+
+    // The mapping stays valid once the file is closed
+    void* data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (data == MAP_FAILED)
+    {
+        throw armnn::Exception("Failed to map calibration data file [" + filePath + "] in memory");
+    }
+    m_Data = static_cast<const uint8_t*>(data);
+
+    try
+    {
+        HeaderReader header(m_Data, m_Size, m_FilePath);
+
+        char magic[sizeof(g_CalibrationDataMagic)];
+        header.ReadBytes(magic, sizeof(magic));
+        if (std::memcmp(magic, g_CalibrationDataMagic, sizeof(magic)) != 0)
+        {
+            throw armnn::ParseException("File [" + filePath + "] is not a calibration data file");
+        }
+
+        const auto version = header.Read<uint32_t>();
+        if (version != g_CalibrationDataVersion)
+        {
+            throw armnn::ParseException("Calibration data file [" + filePath + "] has unsupported version " +
+                                        std::to_string(version));
+        }
+
+        const auto numInputs = header.Read<uint32_t>();
+        const auto numRecords = header.Read<uint64_t>();
+        for (uint32_t i = 0; i < numInputs; ++i)
+        {
+            const auto bindingId = header.Read<int32_t>();
+            // The writer only records Float32 inputs, which Refine consumes as such
+            const auto dataType = header.Read<uint32_t>();
+            if (dataType != static_cast<uint32_t>(armnn::DataType::Float32))
+            {
+                throw armnn::ParseException("Calibration data file [" + filePath + "] has an input of data type " +
+                                            std::to_string(dataType) + " rather than Float32");
+            }
+
+            const auto numDimensions = header.Read<uint32_t>();
+            if (numDimensions == 0 || numDimensions > armnn::MaxNumOfTensorDimensions)
+            {
+                throw armnn::ParseException("Calibration data file [" + filePath + "] has an input with " +
+                                            std::to_string(numDimensions) + " dimensions");
+            }
+
+            // TensorInfo counts the elements and bytes of a tensor in unsigned int, so these must not overflow it
+            std::vector<unsigned int> dimensions(numDimensions);
+            uint64_t numBytes = sizeof(float);
+            for (uint32_t& dimension : dimensions)
+            {
+                dimension = header.Read<uint32_t>();
+                numBytes *= dimension;
+                if (numBytes > std::numeric_limits<unsigned int>::max())
+                {
+                    throw armnn::ParseException("Calibration data file [" + filePath + "] has an input of more "
+                                                "than " + std::to_string(std::numeric_limits<unsigned int>::max()) +
+                                                " bytes");
+                }
+            }
+
+            armnn::TensorInfo tensorInfo(armnn::TensorShape(numDimensions, dimensions.data()),
+                                         armnn::DataType::Float32);
+            m_Inputs.emplace_back(bindingId, tensorInfo);
+            m_InputOffsets.push_back(m_RecordSize);
+            m_RecordSize += AlignUp(tensorInfo.GetNumBytes());
+
+            // Keeps the sum of the input sizes from overflowing: a record larger than the file cannot be read
+            if (m_RecordSize > m_Size)
+            {
+                throw armnn::ParseException("Calibration data file [" + filePath + "] is too small for its records");
+            }
+        }
+
+        m_RecordsOffset = AlignUp(header.GetOffset());
+        if (m_RecordSize == 0 || numRecords > (m_Size - std::min(m_Size, m_RecordsOffset)) / m_RecordSize)
+        {
+            throw armnn::ParseException("Calibration data file [" + filePath + "] does not hold the " +
+                                        std::to_string(numRecords) + " records its header announces");
+        }
+        m_NumRecords = static_cast<size_t>(numRecords);
+    }
+    catch (const armnn::Exception&)
+    {
+        munmap(const_cast<uint8_t*>(m_Data), m_Size);
+        throw;
+    }
+}
+
+CalibrationDataFile::~CalibrationDataFile()
+{
+    munmap(const_cast<uint8_t*>(m_Data), m_Size);
+}
+
+armnn::InputTensors CalibrationDataFile::GetRecord(size_t index) const
+{
+    if (index >= m_NumRecords)
+    {
+        throw armnn::InvalidArgumentException("Calibration data record " + std::to_string(index) +
+                                              " is out of range");
+    }
+
+    const uint8_t* record = m_Data + m_RecordsOffset + index * m_RecordSize;
+
+    armnn::InputTensors inputTensors;
+    for (size_t i = 0; i < m_Inputs.size(); ++i)
+    {
+        inputTensors.emplace_back(m_Inputs[i].first,
+                                  armnn::ConstTensor(m_Inputs[i].second, record + m_InputOffsets[i]));
+    }
+    return inputTensors;
+}
+
+void CalibrationDataFile::Prefetch(size_t firstRecord, size_t numRecords) const
+{
+    if (firstRecord >= m_NumRecords)
+    {
+        return;
+    }
+    numRecords = std::min(numRecords, m_NumRecords - firstRecord);
+
+    // madvise needs an address aligned to a page
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t begin = (m_RecordsOffset + firstRecord * m_RecordSize) / pageSize * pageSize;
+    const size_t end = m_RecordsOffset + (firstRecord + numRecords) * m_RecordSize;
+
+    // This is only a hint: the records are read on first access if it fails
+    madvise(const_cast<uint8_t*>(m_Data) + begin, end - begin, MADV_WILLNEED);
+}
+
+void ConvertToCalibrationDataFile(QuantizationDataSet& dataSet,
+                                  InputLayerVisitor& inputLayerVisitor,
+                                  const std::string& filePath)
+{
+    if (dataSet.IsEmpty())
+    {
+        throw armnn::InvalidArgumentException("No calibration data to convert");
+    }
+
+    // The inputs of the first pass set the layout of the records. The raw text files always hold float values.
+    std::vector<armnn::BindingPointInfo> inputs;
+    for (armnn::LayerBindingId layerBindingId : dataSet.begin()->GetLayerBindingIds())
+    {
+        const armnn::TensorShape shape = inputLayerVisitor.GetTensorInfo(layerBindingId).GetShape();
+        inputs.emplace_back(layerBindingId, armnn::TensorInfo(shape, armnn::DataType::Float32));
+    }
+
+    CalibrationDataWriter writer(filePath, inputs);
+    for (const QuantizationInput& quantizationInput : dataSet)
+    {
+        if (quantizationInput.GetLayerBindingIds().size() != inputs.size())
+        {
+            throw armnn::ParseException("Pass " + std::to_string(quantizationInput.GetPassId()) + " has " +
+                                        std::to_string(quantizationInput.GetNumberOfInputs()) + " inputs, expected " +
+                                        std::to_string(inputs.size()));
+        }
+
+        std::vector<std::vector<float>> inputData;
+        std::vector<const void*> inputDataPointers;
+        for (const armnn::BindingPointInfo& input : inputs)
+        {
+            inputData.push_back(quantizationInput.GetDataForEntry(input.first));
+            if (inputData.back().size() != input.second.GetNumElements())
+            {
+                throw armnn::ParseException("Pass " + std::to_string(quantizationInput.GetPassId()) +
+                                            " has " + std::to_string(inputData.back().size()) +
+                                            " values for binding id " + std::to_string(input.first) +
+                                            ", expected " + std::to_string(input.second.GetNumElements()));
+            }
+            inputDataPointers.push_back(inputData.back().data());
+        }
+        writer.AddRecord(inputDataPointers);
+    }
+    writer.Close();
+}
+
+} // namespace armnnQuantizer
@@ -0,0 +1,97 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "QuantizationDataSet.hpp"
+
+#include <armnn/Tensor.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace armnnQuantizer
+{
+
+// A calibration data file is a binary container of the input tensors of a number of calibration passes, in the
+// native byte order:
+// - a header: the magic "ARMNNCAL", the version (uint32), the number of inputs (uint32) and the number of records
+//   (uint64), followed by, for each input, its binding id (int32), data type (uint32), number of dimensions
+//   (uint32) and dimensions (uint32 each);
+// - the records, one per calibration pass, each holding the raw data of every input, in the order of the header.
+// The header and the data of each input are padded to a multiple of g_CalibrationDataAlignment bytes, so that
+// every record has the same size and the tensors can be used in place once the file is mapped in memory.
+
+/// Alignment, in bytes, of the header and of the data of each input within a calibration data file.
+constexpr unsigned int g_CalibrationDataAlignment = 16;
+
+/// Writes a calibration data file, one record at a time.
+class CalibrationDataWriter
+{
+public:
+    CalibrationDataWriter(const std::string& filePath, const std::vector<armnn::BindingPointInfo>& inputs);
+
+    /// Closes the file if Close() has not been called.
+    ~CalibrationDataWriter();
+
+    /// Appends a record, given the data of each input in the order of the inputs passed to the constructor.
+    void AddRecord(const std::vector<const void*>& inputData);
+
+    /// Completes the header with the number of records and closes the file.
+    void Close();
+
+private:
+    void WritePadding(std::streamoff size);
+
+    std::string m_FilePath;
+    std::ofstream m_Stream;
+    std::vector<armnn::BindingPointInfo> m_Inputs;
+    uint64_t m_NumRecords;
+};
+
+/// A calibration data file mapped in memory. The records are not read until they are first accessed, or until
+/// Prefetch() asks for them to be read in the background.
+class CalibrationDataFile
+{
+public:
+    explicit CalibrationDataFile(const std::string& filePath);
+    ~CalibrationDataFile();
+
+    CalibrationDataFile(const CalibrationDataFile&) = delete;
+    CalibrationDataFile& operator=(const CalibrationDataFile&) = delete;
+
+    /// The binding id and tensor info of each input, in the order their data is stored in the records.
+    const std::vector<armnn::BindingPointInfo>& GetInputs() const { return m_Inputs; }
+
+    size_t GetNumRecords() const { return m_NumRecords; }
+
+    /// Returns the input tensors of a record, which point to the data of the mapped file.
+    armnn::InputTensors GetRecord(size_t index) const;
+
+    /// Starts reading numRecords records from firstRecord in the background, so that the I/O overlaps with the
+    /// processing of the records before them. Records past the end of the file are ignored.
+    void Prefetch(size_t firstRecord, size_t numRecords) const;
+
+private:
+    std::string m_FilePath;
+    const uint8_t* m_Data;
+    size_t m_Size;
+    std::vector<armnn::BindingPointInfo> m_Inputs;
+    /// Offset of the data of each input within a record.
+    std::vector<size_t> m_InputOffsets;
+    size_t m_RecordsOffset;
+    size_t m_RecordSize;
+    size_t m_NumRecords;
+};
+
+/// Writes the data of a QuantizationDataSet, read from the raw text files listed in its CSV file, to a calibration
+/// data file. The shapes of the inputs are taken from the input layers of the network.
+void ConvertToCalibrationDataFile(QuantizationDataSet& dataSet,
+                                  InputLayerVisitor& inputLayerVisitor,
+                                  const std::string& filePath);
+
+} // namespace armnnQuantizer
@@ -82,6 +82,31 @@ bool ValidateQuantizationScheme(const std::string& scheme)
     return true;
 }
 
+bool ValidateCalibrationMethod(const std::string& method, float percentile)
+{
+    std::vector<std::string> supportedMethods = {
+        "MinMax",
+        "Percentile",
+        "Entropy",
+        "Mse"
+    };
+
+    auto iterator = std::find(supportedMethods.begin(), supportedMethods.end(), method);
+    if (iterator == supportedMethods.end())
+    {
+        std::cerr << "Calibration Method [" << method << "] is not supported" << std::endl;
+        return false;
+    }
+
+    if (method == "Percentile" && (percentile <= 50.0f || percentile > 100.0f))
+    {
+        std::cerr << "Calibration percentile [" << percentile << "] is not in (50, 100]" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
 bool CommandLineProcessor::ProcessCommandLine(int argc, char* argv[])
 {
     namespace po = boost::program_options;
@@ -97,8 +122,21 @@ bool CommandLineProcessor::ProcessCommandLine(int argc, char* argv[])
                               "Quantization scheme, \"QAsymm8\" or \"QSymm16\", default value QAsymm8")
                 ("csvfile,c", po::value<std::string>(&m_CsvFileName)->default_value(""),
                              "CSV file containing paths for RAW input tensors")
+                ("calibration-file,b", po::value<std::string>(&m_CalibrationFileName)->default_value(""),
+                              "Calibration data file containing the input tensors, instead of the CSV file")
+                ("write-calibration-file,w",
+                              po::value<std::string>(&m_OutputCalibrationFileName)->default_value(""),
+                              "Calibration data file to convert the RAW input tensors listed by the CSV file to")
                 ("preserve-data-type,p", po::bool_switch(&m_PreserveDataType)->default_value(false),
                               "Preserve the input and output data types")
+                ("threads,t", po::value<unsigned int>(&m_NumThreads)->default_value(0),
+                              "Number of calibration inferences to run in parallel, 0 for one per hardware thread")
+                ("calibration-method,m", po::value<std::string>(&m_CalibrationMethod)->default_value("MinMax"),
+                              "Selection of the calibrated ranges, \"MinMax\", \"Percentile\", \"Entropy\" or "
+                              "\"Mse\", default value MinMax")
+                ("percentile,e", po::value<float>(&m_CalibrationPercentile)->default_value(99.99f),
+                              "Percentile of the values kept in range by the Percentile calibration method, "
+                              "default value 99.99")
                 ("outdir,d", po::value<std::string>(&m_OutputDirectory)->required(),
                              "Directory that output file will be written to")
                 ("outfile,o", po::value<std::string>(&m_OutputFileName)->required(), "ArmNN output file name");
@@ -142,6 +180,11 @@ bool CommandLineProcessor::ProcessCommandLine(int argc, char* argv[])
         return false;
     }
 
+    if (!ValidateCalibrationMethod(m_CalibrationMethod, m_CalibrationPercentile))
+    {
+        return false;
+    }
+
     if (m_CsvFileName != "")
     {
         if (!armnnQuantizer::ValidateProvidedFile(m_CsvFileName))
@@ -158,6 +201,36 @@ bool CommandLineProcessor::ProcessCommandLine(int argc, char* argv[])
         m_QuantizationDataSet = QuantizationDataSet(m_CsvFileName);
     }
 
+    if (m_CalibrationFileName != "")
+    {
+        if (m_CsvFileName != "")
+        {
+            std::cerr << "Only one of the CSV file and the calibration data file can be specified" << std::endl;
+            return false;
+        }
+
+        if (!armnnQuantizer::ValidateProvidedFile(m_CalibrationFileName))
+        {
+            return false;
+        }
+    }
+
+    if (m_OutputCalibrationFileName != "")
+    {
+        if (m_CsvFileName == "")
+        {
+            std::cerr << "A CSV file must be specified to write a calibration data file" << std::endl;
+            return false;
+        }
+
+        if (boost::filesystem::exists(m_OutputCalibrationFileName))
+        {
+            std::cerr << "Calibration data file [" << m_OutputCalibrationFileName << "] already exists"
+                      << std::endl;
+            return false;
+        }
+    }
+
     if (!armnnQuantizer::ValidateOutputDirectory(m_OutputDirectory))
     {
         return false;
@@ -15,6 +15,12 @@ namespace armnnQuantizer
 // parses the command line to extract
 // * the input file -f containing the serialized fp32 ArmNN input graph (must exist...and be a input graph file)
 // * the csv file -c <optional> detailing the paths for RAW input tensors to use for refinement
+// * the calibration data file -b <optional> holding the input tensors to use for refinement, instead of the csv file
+// * the calibration data file -w <optional> the input tensors listed by the csv file are converted to, before
+//   refining from it
+// * the number of threads -t <optional> to run the refinement inferences on
+// * the calibration method -m <optional> selecting the ranges from the refinement data, with the percentile
+//   -e <optional> of the Percentile method
 // * the directory -d to place the output file into (must already exist and be writable)
 // * the name of the file -o the quantized ArmNN input graph will be written to (must not already exist)
 // * LATER: the min and max overrides to be applied to the inputs
@@ -35,6 +41,11 @@ public:
     std::string GetQuantizationScheme() {return m_QuantizationScheme;}
     QuantizationDataSet GetQuantizationDataSet() {return m_QuantizationDataSet;}
     bool HasPreservedDataType() {return m_PreserveDataType;}
+    unsigned int GetNumThreads() {return m_NumThreads;}
+    std::string GetCalibrationMethod() {return m_CalibrationMethod;}
+    float GetCalibrationPercentile() {return m_CalibrationPercentile;}
+    std::string GetCalibrationFileName() {return m_CalibrationFileName;}
+    std::string GetOutputCalibrationFileName() {return m_OutputCalibrationFileName;}
     bool HasQuantizationData() {return !m_QuantizationDataSet.IsEmpty();}
 
 protected:
@@ -46,6 +57,11 @@ protected:
     std::string m_QuantizationScheme;
     QuantizationDataSet m_QuantizationDataSet;
     bool m_PreserveDataType;
+    unsigned int m_NumThreads;
+    std::string m_CalibrationMethod;
+    float m_CalibrationPercentile;
+    std::string m_CalibrationFileName;
+    std::string m_OutputCalibrationFileName;
 };
 
 } // namespace armnnQuantizer
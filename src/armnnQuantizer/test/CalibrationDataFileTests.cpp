@@ -0,0 +1,143 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <boost/test/unit_test.hpp>
+
+#include "../CalibrationDataFile.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <fstream>
+#include <vector>
+
+#define BOOST_FILESYSTEM_NO_DEPRECATED
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/filesystem/path.hpp>
+
+using namespace armnnQuantizer;
+
+struct CalibrationDataFileTestHelper
+{
+    CalibrationDataFileTestHelper()
+        : m_FilePath(boost::filesystem::temp_directory_path() /
+                     boost::filesystem::unique_path("%%%%-%%%%-%%%%.armnncal"))
+    {}
+
+    ~CalibrationDataFileTestHelper()
+    {
+        boost::system::error_code errorCode;
+        boost::filesystem::remove(m_FilePath, errorCode);
+    }
+
+    /// Overwrites the uint32 at the given offset of the file
+    void PatchUInt32(std::streamoff offset, uint32_t value)
+    {
+        std::fstream stream(m_FilePath.string(), std::ios::binary | std::ios::in | std::ios::out);
+        stream.seekp(offset);
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    boost::filesystem::path m_FilePath;
+};
+
+BOOST_AUTO_TEST_SUITE(CalibrationDataFileTests)
+
+BOOST_FIXTURE_TEST_CASE(CalibrationDataFileRoundTrip, CalibrationDataFileTestHelper)
+{
+    const std::vector<armnn::BindingPointInfo> inputs =
+    {
+        { 0, armnn::TensorInfo({ 1, 3 }, armnn::DataType::Float32) },
+        { 2, armnn::TensorInfo({ 2, 2, 1 }, armnn::DataType::Float32) }
+    };
+
+    const std::vector<std::vector<float>> input0Data = { { 1.0f, 2.0f, 3.0f }, { -1.0f, -2.0f, -3.0f } };
+    const std::vector<std::vector<float>> input2Data = { { 4.0f, 5.0f, 6.0f, 7.0f }, { 0.5f, 0.25f, 0.0f, -8.0f } };
+
+    CalibrationDataWriter writer(m_FilePath.string(), inputs);
+    for (size_t i = 0; i < input0Data.size(); ++i)
+    {
+        writer.AddRecord({ input0Data[i].data(), input2Data[i].data() });
+    }
+    writer.Close();
+
+    CalibrationDataFile file(m_FilePath.string());
+    BOOST_TEST(file.GetNumRecords() == 2);
+    BOOST_TEST(file.GetInputs().size() == 2);
+    BOOST_TEST(file.GetInputs()[0].first == 0);
+    BOOST_TEST(file.GetInputs()[1].first == 2);
+    BOOST_CHECK(file.GetInputs()[1].second.GetShape() == inputs[1].second.GetShape());
+    BOOST_CHECK(file.GetInputs()[1].second.GetDataType() == armnn::DataType::Float32);
+
+    file.Prefetch(0, 10);
+    for (size_t i = 0; i < input0Data.size(); ++i)
+    {
+        const armnn::InputTensors record = file.GetRecord(i);
+        BOOST_TEST(record.size() == 2);
+
+        // The tensors point to the data of the file, aligned for in place use
+        const auto* data0 = static_cast<const float*>(record[0].second.GetMemoryArea());
+        const auto* data2 = static_cast<const float*>(record[1].second.GetMemoryArea());
+        BOOST_TEST(reinterpret_cast<uintptr_t>(data0) % g_CalibrationDataAlignment == 0);
+        BOOST_TEST(reinterpret_cast<uintptr_t>(data2) % g_CalibrationDataAlignment == 0);
+
+        BOOST_TEST(std::vector<float>(data0, data0 + 3) == input0Data[i], boost::test_tools::per_element());
+        BOOST_TEST(std::vector<float>(data2, data2 + 4) == input2Data[i], boost::test_tools::per_element());
+    }
+
+    BOOST_CHECK_THROW(file.GetRecord(2), armnn::InvalidArgumentException);
+}
+
+BOOST_FIXTURE_TEST_CASE(CalibrationDataFileRejectsTruncatedFile, CalibrationDataFileTestHelper)
+{
+    const std::vector<armnn::BindingPointInfo> inputs = { { 0, armnn::TensorInfo({ 4 }, armnn::DataType::Float32) } };
+    const std::vector<float> data = { 1.0f, 2.0f, 3.0f, 4.0f };
+
+    {
+        CalibrationDataWriter writer(m_FilePath.string(), inputs);
+        writer.AddRecord({ data.data() });
+        writer.AddRecord({ data.data() });
+    }
+
+    // Drop the last record
+    boost::filesystem::resize_file(m_FilePath, boost::filesystem::file_size(m_FilePath) - sizeof(float));
+    BOOST_CHECK_THROW(CalibrationDataFile file(m_FilePath.string()), armnn::ParseException);
+
+    std::ofstream(m_FilePath.string(), std::ios::binary | std::ios::trunc) << "NOTARMNN";
+    BOOST_CHECK_THROW(CalibrationDataFile file(m_FilePath.string()), armnn::ParseException);
+}
+
+BOOST_FIXTURE_TEST_CASE(CalibrationDataFileRejectsInvalidInputs, CalibrationDataFileTestHelper)
+{
+    const std::vector<armnn::BindingPointInfo> inputs = { { 0, armnn::TensorInfo({ 2, 2 }, armnn::DataType::Float32) } };
+    const std::vector<float> data = { 1.0f, 2.0f, 3.0f, 4.0f };
+
+    // Offsets in the header of the data type and of the dimensions of the only input
+    const std::streamoff dataTypeOffset = 28;
+    const std::streamoff dimensionsOffset = 36;
+
+    const auto writeFile = [&]()
+    {
+        CalibrationDataWriter writer(m_FilePath.string(), inputs);
+        writer.AddRecord({ data.data() });
+    };
+
+    writeFile();
+    BOOST_CHECK_NO_THROW(CalibrationDataFile file(m_FilePath.string()));
+
+    // Only Float32 inputs are read, be the data type unknown or another valid one
+    PatchUInt32(dataTypeOffset, 1000);
+    BOOST_CHECK_THROW(CalibrationDataFile file(m_FilePath.string()), armnn::ParseException);
+    PatchUInt32(dataTypeOffset, static_cast<uint32_t>(armnn::DataType::QuantisedAsymm8));
+    BOOST_CHECK_THROW(CalibrationDataFile file(m_FilePath.string()), armnn::ParseException);
+
+    // 4 x (2^30 + 1) elements would wrap around to the 4 elements of the record in an unsigned int
+    writeFile();
+    PatchUInt32(dimensionsOffset, 4);
+    PatchUInt32(dimensionsOffset + 4, (1u << 30) + 1);
+    BOOST_CHECK_THROW(CalibrationDataFile file(m_FilePath.string()), armnn::ParseException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
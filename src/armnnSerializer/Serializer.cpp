@@ -1205,25 +1205,40 @@ flatbuffers::Offset<flatbuffers::Vector<T>> SerializerVisitor::CreateDataVector(
     return fbVector;
 }
 
-flatbuffers::Offset<serializer::ConstTensor>
-    SerializerVisitor::CreateConstTensorInfo(const armnn::ConstTensor& constTensor)
+flatbuffers::Offset<serializer::TensorInfo> SerializerVisitor::CreateTensorInfo(const armnn::TensorInfo& tensorInfo)
 {
-    armnn::TensorInfo tensorInfo = constTensor.GetInfo();
-
     // Get the dimensions
     std::vector<unsigned int> shape;
-
     for(unsigned int dim = 0; dim < tensorInfo.GetShape().GetNumDimensions(); ++dim)
     {
         shape.push_back(tensorInfo.GetShape()[dim]);
     }
 
+    if (tensorInfo.HasPerAxisQuantization())
+    {
+        return serializer::CreateTensorInfo(m_flatBufferBuilder,
+                                            m_flatBufferBuilder.CreateVector(shape),
+                                            GetFlatBufferDataType(tensorInfo.GetDataType()),
+                                            tensorInfo.GetQuantizationScale(),
+                                            tensorInfo.GetQuantizationOffset(),
+                                            m_flatBufferBuilder.CreateVector(tensorInfo.GetQuantizationScales()),
+                                            tensorInfo.GetQuantizationDim().value());
+    }
+
+    return serializer::CreateTensorInfo(m_flatBufferBuilder,
+                                        m_flatBufferBuilder.CreateVector(shape),
+                                        GetFlatBufferDataType(tensorInfo.GetDataType()),
+                                        tensorInfo.GetQuantizationScale(),
+                                        tensorInfo.GetQuantizationOffset());
+}
+
+flatbuffers::Offset<serializer::ConstTensor>
+    SerializerVisitor::CreateConstTensorInfo(const armnn::ConstTensor& constTensor)
+{
+    armnn::TensorInfo tensorInfo = constTensor.GetInfo();
+
     // Create FlatBuffer TensorInfo
-    auto flatBufferTensorInfo = serializer::CreateTensorInfo(m_flatBufferBuilder,
-                                                             m_flatBufferBuilder.CreateVector(shape),
-                                                             GetFlatBufferDataType(tensorInfo.GetDataType()),
-                                                             tensorInfo.GetQuantizationScale(),
-                                                             tensorInfo.GetQuantizationOffset());
+    auto flatBufferTensorInfo = CreateTensorInfo(tensorInfo);
     flatbuffers::Offset<void> fbPayload;
 
     switch (tensorInfo.GetDataType())
@@ -1257,6 +1272,7 @@ flatbuffers::Offset<serializer::ConstTensor>
             break;
         }
         case armnn::DataType::QuantisedAsymm8:
+        case armnn::DataType::QuantisedSymm8PerAxis:
         case armnn::DataType::Boolean:
         default:
         {
@@ -1308,19 +1324,8 @@ std::vector<fb::Offset<serializer::OutputSlot>>
         const IOutputSlot& outputSlot = layer->GetOutputSlot(slotIndex);
         const armnn::TensorInfo& tensorInfo = outputSlot.GetTensorInfo();
 
-        // Get the dimensions
-        std::vector<unsigned int> shape;
-        for(unsigned int dim = 0; dim < tensorInfo.GetShape().GetNumDimensions(); ++dim)
-        {
-            shape.push_back(tensorInfo.GetShape()[dim]);
-        }
-
         // Create FlatBuffer TensorInfo
-        auto flatBufferTensorInfo = serializer::CreateTensorInfo(m_flatBufferBuilder,
-                                                                 m_flatBufferBuilder.CreateVector(shape),
-                                                                 GetFlatBufferDataType(tensorInfo.GetDataType()),
-                                                                 tensorInfo.GetQuantizationScale(),
-                                                                 tensorInfo.GetQuantizationOffset());
+        auto flatBufferTensorInfo = CreateTensorInfo(tensorInfo);
 
         // Create FlatBuffer Outputslot
         outputSlots.push_back(serializer::CreateOutputSlot(m_flatBufferBuilder,
@@ -255,6 +255,9 @@ private:
     /// Creates the serializer AnyLayer for the layer and adds it to m_serializedLayers.
     void CreateAnyLayer(const flatbuffers::Offset<void>& layer, const armnnSerializer::Layer serializerLayer);
 
+    /// Creates the serialized TensorInfo, including the per-axis quantization parameters if it has any.
+    flatbuffers::Offset<armnnSerializer::TensorInfo> CreateTensorInfo(const armnn::TensorInfo& tensorInfo);
+
     /// Creates the serializer ConstTensor for the armnn ConstTensor.
     flatbuffers::Offset<armnnSerializer::ConstTensor> CreateConstTensorInfo(
             const armnn::ConstTensor& constTensor);
@@ -20,6 +20,7 @@ armnnSerializer::ConstTensorData GetFlatBufferConstTensorData(armnn::DataType da
         case armnn::DataType::Float16:
             return armnnSerializer::ConstTensorData::ConstTensorData_ShortData;
         case armnn::DataType::QuantisedAsymm8:
+        case armnn::DataType::QuantisedSymm8PerAxis:
         case armnn::DataType::Boolean:
             return armnnSerializer::ConstTensorData::ConstTensorData_ByteData;
         default:
@@ -39,6 +40,8 @@ armnnSerializer::DataType GetFlatBufferDataType(armnn::DataType dataType)
             return armnnSerializer::DataType::DataType_Signed32;
         case armnn::DataType::QuantisedAsymm8:
             return armnnSerializer::DataType::DataType_QuantisedAsymm8;
+        case armnn::DataType::QuantisedSymm8PerAxis:
+            return armnnSerializer::DataType::DataType_QuantisedSymm8PerAxis;
         case armnn::DataType::Boolean:
             return armnnSerializer::DataType::DataType_Boolean;
         default:
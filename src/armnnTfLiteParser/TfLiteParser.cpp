@@ -315,6 +315,10 @@ armnn::TensorInfo ToTensorInfo(TfLiteParser::TensorRawPtr tensorPtr, const std::
         case tflite::TensorType_INT32:
             type = armnn::DataType::Signed32;
             break;
+        case tflite::TensorType_INT8:
+            // Only per-axis quantized constants (e.g. per-channel convolution weights) are supported in int8.
+            type = armnn::DataType::QuantisedSymm8PerAxis;
+            break;
 
         default:
         {
@@ -329,6 +333,41 @@ armnn::TensorInfo ToTensorInfo(TfLiteParser::TensorRawPtr tensorPtr, const std::
         }
     }
 
+    std::vector<unsigned int> safeShape = shapes;
+    if (safeShape.size() == 0)
+    {
+        safeShape.push_back(1);
+    }
+
+    // Per-axis quantization: one scale per index along the quantized dimension, and zero offsets.
+    if (tensorPtr->quantization.get() &&
+        (tensorPtr->quantization->scale.size() > 1 || type == armnn::DataType::QuantisedSymm8PerAxis))
+    {
+        const std::vector<float>& scales = tensorPtr->quantization->scale;
+        const int32_t quantizationDim = tensorPtr->quantization->quantized_dimension;
+        if (quantizationDim < 0 ||
+            static_cast<size_t>(quantizationDim) >= safeShape.size() ||
+            scales.size() != safeShape[static_cast<size_t>(quantizationDim)])
+        {
+            CheckLocation location = CHECK_LOCATION();
+            throw ParseException(
+                boost::str(
+                    boost::format("Invalid per-axis quantization (%1% scales along dimension %2%) for tensor: "
+                                  "%3%. %4%") %
+                                  scales.size() %
+                                  quantizationDim %
+                                  tensorPtr->name %
+                                  location.AsString()));
+        }
+
+        armnn::TensorInfo result(static_cast<unsigned int>(safeShape.size()),
+                                 safeShape.data(),
+                                 type,
+                                 scales,
+                                 static_cast<unsigned int>(quantizationDim));
+        return result;
+    }
+
     float quantizationScale = 0.0f;
     int32_t quantizationOffset = 0;
 
@@ -349,12 +388,6 @@ armnn::TensorInfo ToTensorInfo(TfLiteParser::TensorRawPtr tensorPtr, const std::
         }
     }
 
-    std::vector<unsigned int> safeShape = shapes;
-    if (safeShape.size() == 0)
-    {
-        safeShape.push_back(1);
-    }
-
     // two statements (on purpose) for easier debugging:
     armnn::TensorInfo result(static_cast<unsigned int>(safeShape.size()),
                              safeShape.data(),
@@ -814,10 +847,26 @@ void TfLiteParser::ParseDepthwiseConv2D(size_t subgraphIndex, size_t operatorInd
     unsigned int filterWidth  = filterTensorInfo.GetShape()[2];
 
     // Reshape weights as [ H, W, I, M ]
+    const unsigned int depthMultiplier = filterTensorInfo.GetShape()[3] / inputTensorInfo.GetShape()[3];
     filterTensorInfo.SetShape({ filterHeight,
                                 filterWidth,
                                 inputTensorInfo.GetShape()[3],
-                                filterTensorInfo.GetShape()[3] / inputTensorInfo.GetShape()[3] });
+                                depthMultiplier });
+
+    // Per-channel weights are quantized along I * M, which only maps onto a single ArmNN dimension (I) when M is 1.
+    if (filterTensorInfo.HasPerAxisQuantization())
+    {
+        if (depthMultiplier != 1)
+        {
+            throw ParseException(
+                boost::str(
+                    boost::format("Per-channel quantized DepthwiseConv2D weights are only supported with a depth "
+                                  "multiplier of 1 (got %1%). %2%") %
+                                  depthMultiplier %
+                                  CHECK_LOCATION().AsString()));
+        }
+        filterTensorInfo.SetQuantizationDim(2u);
+    }
 
     // Mappings from TensorflowLite filter tensors to the ArmNN filter tensors (ArmNN weights have to be [M, I, H, W])
     PermutationVector permutationVector{ 2, 3, 1, 0 }; // [H, W, I, M] -> [M, I, H, W]
@@ -2671,6 +2720,11 @@ TfLiteParser::CreateConstTensor(TensorRawPtr tensorPtr,
                                                           tensorPtr,
                                                           tensorInfo,
                                                           permutationVector);
+        case armnn::DataType::QuantisedSymm8PerAxis:
+            return CreateConstTensorAndStoreData<int8_t>(bufferPtr,
+                                                         tensorPtr,
+                                                         tensorInfo,
+                                                         permutationVector);
         default:
         {
             std::stringstream errString;
@@ -2796,6 +2850,7 @@ TfLiteParser::SupportedDataStorage::SupportedDataStorage(std::unique_ptr<float[]
 : m_FloatData(std::move(data))
 , m_Uint8Data(nullptr)
 , m_Int32Data(nullptr)
+, m_Int8Data(nullptr)
 {
 }
 
@@ -2803,6 +2858,7 @@ TfLiteParser::SupportedDataStorage::SupportedDataStorage(std::unique_ptr<uint8_t
 : m_FloatData(nullptr)
 , m_Uint8Data(std::move(data))
 , m_Int32Data(nullptr)
+, m_Int8Data(nullptr)
 {
 }
 
@@ -2810,6 +2866,15 @@ TfLiteParser::SupportedDataStorage::SupportedDataStorage(std::unique_ptr<int32_t
 : m_FloatData(nullptr)
 , m_Uint8Data(nullptr)
 , m_Int32Data(std::move(data))
+, m_Int8Data(nullptr)
+{
+}
+
+TfLiteParser::SupportedDataStorage::SupportedDataStorage(std::unique_ptr<int8_t[]> && data)
+: m_FloatData(nullptr)
+, m_Uint8Data(nullptr)
+, m_Int32Data(nullptr)
+, m_Int8Data(std::move(data))
 {
 }
 
@@ -0,0 +1,73 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace armnn
+{
+
+/// Brain floating point: the upper 16 bits of an IEEE 754 float, so it keeps the 8-bit exponent (and the range) of
+/// float with a 7-bit mantissa. Conversions from float round to nearest, with ties to even.
+class BFloat16
+{
+public:
+    BFloat16() : m_Value(0) {}
+
+    explicit BFloat16(float value) : m_Value(Float32ToBits(value)) {}
+
+    BFloat16& operator=(float value)
+    {
+        m_Value = Float32ToBits(value);
+        return *this;
+    }
+
+    operator float() const { return BitsToFloat32(m_Value); }
+
+    bool operator==(const BFloat16& other) const { return m_Value == other.m_Value; }
+    bool operator!=(const BFloat16& other) const { return m_Value != other.m_Value; }
+
+    /// The raw bits.
+    uint16_t Val() const { return m_Value; }
+
+    static BFloat16 FromBits(uint16_t bits)
+    {
+        BFloat16 result;
+        result.m_Value = bits;
+        return result;
+    }
+
+    static uint16_t Float32ToBits(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        if ((bits & 0x7fffffffu) > 0x7f800000u)
+        {
+            // NaN: truncating could turn it into infinity, so keep the sign and return a quiet NaN.
+            return static_cast<uint16_t>((bits >> 16) | 0x0040u);
+        }
+
+        // Rounds the dropped 16 bits to nearest even. Values that round past the largest finite value become
+        // infinity, as they would in IEEE 754.
+        bits += 0x7fffu + ((bits >> 16) & 1u);
+        return static_cast<uint16_t>(bits >> 16);
+    }
+
+    static float BitsToFloat32(uint16_t bits)
+    {
+        const uint32_t floatBits = static_cast<uint32_t>(bits) << 16;
+        float value;
+        std::memcpy(&value, &floatBits, sizeof(value));
+        return value;
+    }
+
+private:
+    uint16_t m_Value;
+};
+
+} //namespace armnn
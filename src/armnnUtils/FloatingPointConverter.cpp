@@ -5,13 +5,186 @@
 
 #include "FloatingPointConverter.hpp"
 
+#include "BFloat16.hpp"
 #include "Half.hpp"
 
 #include <boost/assert.hpp>
 
+#include <cstdint>
+#include <cstring>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define ARMNN_FP16_CONVERSION_F16C
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define ARMNN_FP16_CONVERSION_NEON
+#include <arm_neon.h>
+#endif
+
 namespace armnnUtils
 {
 
+namespace
+{
+
+static_assert(sizeof(armnn::Half) == sizeof(uint16_t), "armnn::Half is expected to hold the raw FP16 bits");
+static_assert(sizeof(armnn::BFloat16) == sizeof(uint16_t), "armnn::BFloat16 is expected to hold the raw bits");
+
+uint32_t FloatToBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float BitsToFloat(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Portable conversions, bit-exact with the hardware instructions (and armnn::Half): round to nearest, ties to even.
+uint16_t Float32ToFloat16Bits(float value)
+{
+    const uint32_t denormMagicBits = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+    uint32_t bits = FloatToBits(value);
+    const uint32_t sign = bits & 0x80000000u;
+    bits ^= sign;
+
+    uint32_t result;
+    if (bits >= ((127u + 16u) << 23))
+    {
+        // Too large for FP16, infinity or NaN. NaNs stay NaNs (quiet), everything else becomes infinity.
+        result = bits > 0x7f800000u ? 0x7e00u : 0x7c00u;
+    }
+    else if (bits < (113u << 23))
+    {
+        // Subnormal FP16 or zero: the FP32 addition aligns the 10 mantissa bits at the bottom and does the rounding.
+        result = FloatToBits(BitsToFloat(bits) + BitsToFloat(denormMagicBits)) - denormMagicBits;
+    }
+    else
+    {
+        // Normal FP16: rebias the exponent and round the dropped 13 mantissa bits to nearest even.
+        const uint32_t mantissaOdd = (bits >> 13) & 1u;
+        bits += ((15u - 127u) << 23) + 0xfffu + mantissaOdd;
+        result = bits >> 13;
+    }
+
+    return static_cast<uint16_t>(result | (sign >> 16));
+}
+
+float Float16BitsToFloat32(uint16_t half)
+{
+    const uint32_t shiftedExponent = 0x7c00u << 13;
+
+    uint32_t bits = (half & 0x7fffu) << 13;
+    const uint32_t exponent = bits & shiftedExponent;
+    bits += (127u - 15u) << 23;
+
+    if (exponent == shiftedExponent)
+    {
+        // Infinity or NaN.
+        bits += (128u - 16u) << 23;
+    }
+    else if (exponent == 0)
+    {
+        // Zero or subnormal: renormalize through an FP32 subtraction.
+        bits += 1u << 23;
+        bits = FloatToBits(BitsToFloat(bits) - BitsToFloat(113u << 23));
+    }
+
+    return BitsToFloat(bits | ((half & 0x8000u) << 16));
+}
+
+void ConvertFloat32To16Portable(const float* src, size_t numElements, uint16_t* dst)
+{
+    for (size_t i = 0; i < numElements; i++)
+    {
+        dst[i] = Float32ToFloat16Bits(src[i]);
+    }
+}
+
+void ConvertFloat16To32Portable(const uint16_t* src, size_t numElements, float* dst)
+{
+    for (size_t i = 0; i < numElements; i++)
+    {
+        dst[i] = Float16BitsToFloat32(src[i]);
+    }
+}
+
+#if defined(ARMNN_FP16_CONVERSION_F16C)
+
+// F16C is checked for at runtime, so the library still runs on CPUs without it.
+bool HasF16c()
+{
+    static const bool hasF16c = []
+    {
+        unsigned int eax, ebx, ecx, edx;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        {
+            return false;
+        }
+        // The F16C instructions are VEX encoded, so the OS must also save the AVX state.
+        return (ecx & bit_F16C) != 0 && (ecx & bit_OSXSAVE) != 0 && __builtin_cpu_supports("avx");
+    }();
+    return hasF16c;
+}
+
+__attribute__((target("avx,f16c")))
+void ConvertFloat32To16F16c(const float* src, size_t numElements, uint16_t* dst)
+{
+    size_t i = 0;
+    for (; i + 8 <= numElements; i += 8)
+    {
+        const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), halves);
+    }
+    ConvertFloat32To16Portable(src + i, numElements - i, dst + i);
+}
+
+__attribute__((target("avx,f16c")))
+void ConvertFloat16To32F16c(const uint16_t* src, size_t numElements, float* dst)
+{
+    size_t i = 0;
+    for (; i + 8 <= numElements; i += 8)
+    {
+        const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(halves));
+    }
+    ConvertFloat16To32Portable(src + i, numElements - i, dst + i);
+}
+
+#elif defined(ARMNN_FP16_CONVERSION_NEON)
+
+// FP16 conversions are part of the base AArch64 instruction set and round using the FPCR mode, round to nearest
+// even by default.
+void ConvertFloat32To16Neon(const float* src, size_t numElements, uint16_t* dst)
+{
+    size_t i = 0;
+    for (; i + 4 <= numElements; i += 4)
+    {
+        vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+    }
+    ConvertFloat32To16Portable(src + i, numElements - i, dst + i);
+}
+
+void ConvertFloat16To32Neon(const uint16_t* src, size_t numElements, float* dst)
+{
+    size_t i = 0;
+    for (; i + 4 <= numElements; i += 4)
+    {
+        vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+    }
+    ConvertFloat16To32Portable(src + i, numElements - i, dst + i);
+}
+
+#endif
+
+} // anonymous namespace
+
 void FloatingPointConverter::ConvertFloat32To16(const float* srcFloat32Buffer,
                                                 size_t numElements,
                                                 void* dstFloat16Buffer)
@@ -19,12 +192,20 @@ void FloatingPointConverter::ConvertFloat32To16(const float* srcFloat32Buffer,
     BOOST_ASSERT(srcFloat32Buffer != nullptr);
     BOOST_ASSERT(dstFloat16Buffer != nullptr);
 
-    armnn::Half* pHalf = reinterpret_cast<armnn::Half*>(dstFloat16Buffer);
+    uint16_t* pHalf = static_cast<uint16_t*>(dstFloat16Buffer);
 
-    for (size_t i = 0; i < numElements; i++)
+#if defined(ARMNN_FP16_CONVERSION_F16C)
+    if (HasF16c())
     {
-        pHalf[i] = armnn::Half(srcFloat32Buffer[i]);
+        ConvertFloat32To16F16c(srcFloat32Buffer, numElements, pHalf);
+        return;
     }
+#elif defined(ARMNN_FP16_CONVERSION_NEON)
+    ConvertFloat32To16Neon(srcFloat32Buffer, numElements, pHalf);
+    return;
+#endif
+
+    ConvertFloat32To16Portable(srcFloat32Buffer, numElements, pHalf);
 }
 
 void FloatingPointConverter::ConvertFloat16To32(const void* srcFloat16Buffer,
@@ -34,11 +215,49 @@ void FloatingPointConverter::ConvertFloat16To32(const void* srcFloat16Buffer,
     BOOST_ASSERT(srcFloat16Buffer != nullptr);
     BOOST_ASSERT(dstFloat32Buffer != nullptr);
 
-    const armnn::Half* pHalf = reinterpret_cast<const armnn::Half*>(srcFloat16Buffer);
+    const uint16_t* pHalf = static_cast<const uint16_t*>(srcFloat16Buffer);
+
+#if defined(ARMNN_FP16_CONVERSION_F16C)
+    if (HasF16c())
+    {
+        ConvertFloat16To32F16c(pHalf, numElements, dstFloat32Buffer);
+        return;
+    }
+#elif defined(ARMNN_FP16_CONVERSION_NEON)
+    ConvertFloat16To32Neon(pHalf, numElements, dstFloat32Buffer);
+    return;
+#endif
+
+    ConvertFloat16To32Portable(pHalf, numElements, dstFloat32Buffer);
+}
+
+// BFloat16 is the upper half of FP32, so both conversions are a few integer operations per element, which the
+// compiler vectorizes.
+void FloatingPointConverter::ConvertFloat32ToBFloat16(const float* srcFloat32Buffer,
+                                                      size_t numElements,
+                                                      void* dstBFloat16Buffer)
+{
+    BOOST_ASSERT(srcFloat32Buffer != nullptr);
+    BOOST_ASSERT(dstBFloat16Buffer != nullptr);
+
+    uint16_t* pBFloat16 = static_cast<uint16_t*>(dstBFloat16Buffer);
+    for (size_t i = 0; i < numElements; i++)
+    {
+        pBFloat16[i] = armnn::BFloat16::Float32ToBits(srcFloat32Buffer[i]);
+    }
+}
+
+void FloatingPointConverter::ConvertBFloat16ToFloat32(const void* srcBFloat16Buffer,
+                                                      size_t numElements,
+                                                      float* dstFloat32Buffer)
+{
+    BOOST_ASSERT(srcBFloat16Buffer != nullptr);
+    BOOST_ASSERT(dstFloat32Buffer != nullptr);
 
+    const uint16_t* pBFloat16 = static_cast<const uint16_t*>(srcBFloat16Buffer);
     for (size_t i = 0; i < numElements; i++)
     {
-        dstFloat32Buffer[i] = pHalf[i];
+        dstFloat32Buffer[i] = armnn::BFloat16::BitsToFloat32(pBFloat16[i]);
     }
 }
 
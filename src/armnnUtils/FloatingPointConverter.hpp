@@ -17,5 +17,11 @@ public:
     static void ConvertFloat32To16(const float *srcFloat32Buffer, size_t numElements, void *dstFloat16Buffer);
 
     static void ConvertFloat16To32(const void *srcFloat16Buffer, size_t numElements, float *dstFloat32Buffer);
+
+    // Converts a buffer of FP32 values to BFloat16, rounding to nearest even, and stores in the given
+    // dstBFloat16Buffer. dstBFloat16Buffer should be (numElements * 2) in size
+    static void ConvertFloat32ToBFloat16(const float *srcFloat32Buffer, size_t numElements, void *dstBFloat16Buffer);
+
+    static void ConvertBFloat16ToFloat32(const void *srcBFloat16Buffer, size_t numElements, float *dstFloat32Buffer);
 };
 } //namespace armnnUtils
@@ -5,8 +5,9 @@
 
 #pragma once
 
-// Set style to round to nearest
+// Set style to round to nearest, with ties to even as IEEE 754 and the hardware conversion instructions do
 #define HALF_ROUND_STYLE 1
+#define HALF_ROUND_TIES_TO_EVEN 1
 
 #include <type_traits>
 #include <half/half.hpp>
@@ -8,35 +8,106 @@
 #include "Half.hpp"
 #include <armnn/Tensor.hpp>
 
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cstring>
+#include <limits>
 
 namespace
 {
 
+/// Edge of the square tiles transposes are blocked into. A tile of the widest supported element type spans 2KiB of
+/// source and destination data, which keeps both sides of the tile resident in the L1 cache.
+constexpr unsigned int g_PermuteTileSize = 16;
+
+/// Copies a [rows x cols] block from a source laid out column after column (srcColStride apart) into a destination
+/// laid out row after row (dstRowStride apart), one tile at a time.
+template <typename T>
+void TransposeBlock(const T* src, T* dst,
+                    unsigned int rows, unsigned int cols,
+                    size_t srcColStride, size_t dstRowStride)
+{
+    for (unsigned int r0 = 0; r0 < rows; r0 += g_PermuteTileSize)
+    {
+        const unsigned int rowEnd = std::min(rows, r0 + g_PermuteTileSize);
+        for (unsigned int c0 = 0; c0 < cols; c0 += g_PermuteTileSize)
+        {
+            if (rowEnd - r0 == g_PermuteTileSize && cols - c0 >= g_PermuteTileSize)
+            {
+                // Full tile: fixed trip counts let the compiler unroll and vectorise the copy.
+                for (unsigned int r = r0; r < r0 + g_PermuteTileSize; ++r)
+                {
+                    const T* srcTile = src + r + c0 * srcColStride;
+                    T* dstTile = dst + r * dstRowStride + c0;
+                    for (unsigned int c = 0; c < g_PermuteTileSize; ++c)
+                    {
+                        dstTile[c] = srcTile[c * srcColStride];
+                    }
+                }
+            }
+            else
+            {
+                const unsigned int colEnd = std::min(cols, c0 + g_PermuteTileSize);
+                for (unsigned int r = r0; r < rowEnd; ++r)
+                {
+                    for (unsigned int c = c0; c < colEnd; ++c)
+                    {
+                        dst[r * dstRowStride + c] = src[r + c * srcColStride];
+                    }
+                }
+            }
+        }
+    }
+}
+
 class PermuteLoop
 {
 public:
     using size_type = unsigned int;
 
     PermuteLoop(const armnn::TensorShape& dstShape, const armnn::PermutationVector& mappings)
-        : m_DstShape(dstShape)
+        : m_NumDims(0)
     {
         assert(dstShape.GetNumDimensions() == mappings.GetSize());
 
         const size_type numDims = dstShape.GetNumDimensions();
 
+        std::array<size_type, armnn::MaxNumOfTensorDimensions> srcStrides;
         size_type srcStride = 1U;
-        size_type dstStride = 1U;
 
         for (size_type i = numDims - 1U, k = 0U; k < numDims; ++k, --i)
         {
-            m_SrcStrides[mappings[i]] = srcStride;
-            m_DstStrides[i] = dstStride;
-
+            srcStrides[mappings[i]] = srcStride;
             srcStride *= dstShape[mappings[i]];
-            dstStride *= dstShape[i];
         }
+
+        // Walk the destination dimensions from the outermost, dropping dimensions of size 1 and folding each
+        // dimension into the previous one when both are also adjacent, in the same order, in the source.
+        for (size_type i = 0; i < numDims; ++i)
+        {
+            if (dstShape[i] == 1)
+            {
+                continue;
+            }
+            if (m_NumDims > 0 && m_Dims[m_NumDims - 1].m_SrcStride == srcStrides[i] * dstShape[i])
+            {
+                m_Dims[m_NumDims - 1].m_Size *= dstShape[i];
+                m_Dims[m_NumDims - 1].m_SrcStride = srcStrides[i];
+                continue;
+            }
+            m_Dims[m_NumDims++] = { dstShape[i], srcStrides[i], 0 };
+        }
+
+        size_type dstStride = 1U;
+        for (size_type i = m_NumDims; i-- > 0;)
+        {
+            m_Dims[i].m_DstStride = dstStride;
+            dstStride *= m_Dims[i].m_Size;
+        }
+        m_NumElements = dstStride;
     }
 
     void Unroll(const void* srcData, void* dstData, size_t dataTypeSize)
@@ -45,48 +116,130 @@ public:
         assert(dstData);
         assert(dataTypeSize > 0);
 
-        const unsigned char* srcDataPtr = reinterpret_cast<const unsigned char*>(srcData);
-        unsigned char* dstDataPtr       = reinterpret_cast<unsigned char*>(dstData);
-
-        const unsigned char* const srcEndPtr = srcDataPtr + m_DstShape.GetNumElements() * dataTypeSize;
-        unsigned char* const       dstEndPtr = dstDataPtr + m_DstShape.GetNumElements() * dataTypeSize;
-
-        Unroll(0, srcDataPtr, dstDataPtr, srcEndPtr, dstEndPtr, dataTypeSize);
+        switch (dataTypeSize)
+        {
+            case 1:
+                Run(reinterpret_cast<const uint8_t*>(srcData), reinterpret_cast<uint8_t*>(dstData));
+                break;
+            case 2:
+                Run(reinterpret_cast<const uint16_t*>(srcData), reinterpret_cast<uint16_t*>(dstData));
+                break;
+            case 4:
+                Run(reinterpret_cast<const uint32_t*>(srcData), reinterpret_cast<uint32_t*>(dstData));
+                break;
+            case 8:
+                Run(reinterpret_cast<const uint64_t*>(srcData), reinterpret_cast<uint64_t*>(dstData));
+                break;
+            default:
+            {
+                // Permute the bytes of each element as an extra, innermost dimension.
+                const size_type elementSize = boost::numeric_cast<size_type>(dataTypeSize);
+                for (size_type i = 0; i < m_NumDims; ++i)
+                {
+                    m_Dims[i].m_SrcStride *= elementSize;
+                    m_Dims[i].m_DstStride *= elementSize;
+                }
+                if (m_NumDims > 0 && m_Dims[m_NumDims - 1].m_SrcStride == elementSize)
+                {
+                    m_Dims[m_NumDims - 1] = { m_Dims[m_NumDims - 1].m_Size * elementSize, 1U, 1U };
+                }
+                else
+                {
+                    m_Dims[m_NumDims++] = { elementSize, 1U, 1U };
+                }
+                m_NumElements *= elementSize;
+                Run(reinterpret_cast<const uint8_t*>(srcData), reinterpret_cast<uint8_t*>(dstData));
+                break;
+            }
+        }
     }
 
 private:
-    void Unroll(size_type dimension,
-                const unsigned char* srcData, unsigned char* dstData,
-                const unsigned char* srcEnd, unsigned char* dstEnd,
-                size_t dataTypeSize)
+    struct Dimension
     {
-        assert(srcData);
-        assert(dstData);
-        assert(srcEnd);
-        assert(dstEnd);
-        assert(srcData < srcEnd);
-        assert(dstData < dstEnd);
-        assert(dataTypeSize > 0);
+        size_type m_Size;
+        size_type m_SrcStride;
+        size_type m_DstStride;
+    };
 
-        if (dimension >= m_DstShape.GetNumDimensions())
+    template <typename T>
+    void Run(const T* srcData, T* dstData) const
+    {
+        if (m_NumDims <= 1)
         {
-            ::memcpy(dstData, srcData, dataTypeSize);
+            // The permutation keeps the data in order.
+            ::memcpy(dstData, srcData, m_NumElements * sizeof(T));
+            return;
         }
-        else
+
+        const Dimension& inner = m_Dims[m_NumDims - 1];
+        if (inner.m_SrcStride == 1)
         {
-            for (size_type i = 0; i < m_DstShape[dimension]; i++)
+            // Rows of the destination are contiguous in the source: copy them whole.
+            ForEachOuter(m_NumDims - 1, m_NumDims, [&](size_t srcOffset, size_t dstOffset)
             {
-                Unroll(dimension + 1, srcData, dstData, srcEnd, dstEnd, dataTypeSize);
+                ::memcpy(dstData + dstOffset, srcData + srcOffset, inner.m_Size * sizeof(T));
+            });
+            return;
+        }
+
+        // Otherwise the innermost source dimension, which has a stride of 1, is transposed with the innermost
+        // destination dimension, for each index of the remaining dimensions.
+        size_type srcInner = 0;
+        while (m_Dims[srcInner].m_SrcStride != 1)
+        {
+            ++srcInner;
+        }
+        const Dimension& rows = m_Dims[srcInner];
 
-                srcData += m_SrcStrides[dimension] * dataTypeSize;
-                dstData += m_DstStrides[dimension] * dataTypeSize;
+        ForEachOuter(m_NumDims - 1, srcInner, [&](size_t srcOffset, size_t dstOffset)
+        {
+            TransposeBlock(srcData + srcOffset, dstData + dstOffset,
+                           rows.m_Size, inner.m_Size, inner.m_SrcStride, rows.m_DstStride);
+        });
+    }
+
+    /// Calls function with the source and destination offsets of every index of the first numOuter dimensions,
+    /// leaving out the dimension skip.
+    template <typename Function>
+    void ForEachOuter(size_type numOuter, size_type skip, Function function) const
+    {
+        std::array<size_type, armnn::MaxNumOfTensorDimensions + 1> index{};
+        size_t srcOffset = 0;
+        size_t dstOffset = 0;
+
+        while (true)
+        {
+            function(srcOffset, dstOffset);
+
+            size_type d = numOuter;
+            while (d-- > 0)
+            {
+                if (d == skip)
+                {
+                    continue;
+                }
+                const Dimension& dim = m_Dims[d];
+                srcOffset += dim.m_SrcStride;
+                dstOffset += dim.m_DstStride;
+                if (++index[d] < dim.m_Size)
+                {
+                    break;
+                }
+                srcOffset -= size_t(dim.m_SrcStride) * dim.m_Size;
+                dstOffset -= size_t(dim.m_DstStride) * dim.m_Size;
+                index[d] = 0;
+            }
+            if (d == std::numeric_limits<size_type>::max())
+            {
+                return;
             }
         }
     }
 
-    armnn::TensorShape m_DstShape;
-    std::array<size_type, armnn::MaxNumOfTensorDimensions> m_SrcStrides;
-    std::array<size_type, armnn::MaxNumOfTensorDimensions> m_DstStrides;
+    std::array<Dimension, armnn::MaxNumOfTensorDimensions + 1> m_Dims;
+    size_type m_NumDims;
+    size_type m_NumElements;
 };
 
 } // namespace
@@ -114,6 +267,12 @@ armnn::TensorInfo Permuted(const armnn::TensorInfo& info, const armnn::Permutati
 {
     armnn::TensorInfo outInfo(info);
     outInfo.SetShape(Permuted(info.GetShape(), mappings));
+
+    // The quantization dimension of a per-axis quantized tensor moves with the dimension it refers to.
+    if (info.HasPerAxisQuantization())
+    {
+        outInfo.SetQuantizationDim(mappings[info.GetQuantizationDim().value()]);
+    }
     return outInfo;
 }
 
@@ -0,0 +1,251 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "QuantizedConverter.hpp"
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__)
+#define ARMNN_QUANTIZED_CONVERSION_SSE2
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#define ARMNN_QUANTIZED_CONVERSION_NEON
+#include <arm_neon.h>
+#endif
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+// Scaled values are clamped to this magnitude before being converted to integers. It is far outside the range of
+// any quantized type, so the final clamping gives the same result, and every float up to it holds an exact integer.
+constexpr float g_MaxScaledValue = 16777216.0f;
+
+template<typename QuantizedType>
+QuantizedType QuantizeValue(float value, float scale, int32_t offset)
+{
+    constexpr int32_t min = std::numeric_limits<QuantizedType>::lowest();
+    constexpr int32_t max = std::numeric_limits<QuantizedType>::max();
+
+    const float scaled = std::min(std::max(value / scale, -g_MaxScaledValue), g_MaxScaledValue);
+    const int32_t quantized = static_cast<int32_t>(std::round(scaled)) + offset;
+    return static_cast<QuantizedType>(std::min(std::max(quantized, min), max));
+}
+
+#if defined(ARMNN_QUANTIZED_CONVERSION_SSE2)
+
+constexpr size_t g_VectorSize = 8;
+
+// Divides by the scale, rounds half away from zero and adds the offset. SSE2 only truncates, so the rounding is
+// done by stepping away from zero whenever the dropped fraction is at least a half.
+__m128i QuantizeToInt32(__m128 values, __m128 scale, __m128i offset)
+{
+    const __m128 scaled = _mm_min_ps(_mm_max_ps(_mm_div_ps(values, scale), _mm_set1_ps(-g_MaxScaledValue)),
+                                     _mm_set1_ps(g_MaxScaledValue));
+    const __m128i truncated = _mm_cvttps_epi32(scaled);
+
+    const __m128 fraction = _mm_sub_ps(scaled, _mm_cvtepi32_ps(truncated));
+    const __m128 absFraction = _mm_andnot_ps(_mm_set1_ps(-0.0f), fraction);
+    const __m128i roundAway = _mm_castps_si128(_mm_cmpge_ps(absFraction, _mm_set1_ps(0.5f)));
+    const __m128i negative = _mm_castps_si128(_mm_cmplt_ps(scaled, _mm_setzero_ps()));
+
+    // +1 or -1 (following the sign of the value) where the fraction rounds away from zero, 0 elsewhere.
+    const __m128i step = _mm_sub_epi32(_mm_xor_si128(_mm_and_si128(roundAway, _mm_set1_epi32(1)), negative), negative);
+    return _mm_add_epi32(_mm_add_epi32(truncated, step), offset);
+}
+
+// Saturating packs clamp to the range of the quantized type.
+void StoreQuantized(__m128i low, __m128i high, uint8_t* dst)
+{
+    const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(low, high), _mm_setzero_si128());
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), packed);
+}
+
+void StoreQuantized(__m128i low, __m128i high, int16_t* dst)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packs_epi32(low, high));
+}
+
+void LoadQuantized(const uint8_t* src, __m128i& low, __m128i& high)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i values = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)), zero);
+    low  = _mm_unpacklo_epi16(values, zero);
+    high = _mm_unpackhi_epi16(values, zero);
+}
+
+void LoadQuantized(const int16_t* src, __m128i& low, __m128i& high)
+{
+    const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    low  = _mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16);
+    high = _mm_srai_epi32(_mm_unpackhi_epi16(values, values), 16);
+}
+
+template<typename QuantizedType>
+size_t QuantizeVectors(const float* src, size_t numElements, QuantizedType* dst, float scale, int32_t offset)
+{
+    const __m128 scaleVector = _mm_set1_ps(scale);
+    const __m128i offsetVector = _mm_set1_epi32(offset);
+
+    size_t i = 0;
+    for (; i + g_VectorSize <= numElements; i += g_VectorSize)
+    {
+        StoreQuantized(QuantizeToInt32(_mm_loadu_ps(src + i), scaleVector, offsetVector),
+                       QuantizeToInt32(_mm_loadu_ps(src + i + 4), scaleVector, offsetVector),
+                       dst + i);
+    }
+    return i;
+}
+
+template<typename QuantizedType>
+size_t DequantizeVectors(const QuantizedType* src, size_t numElements, float* dst, float scale, int32_t offset)
+{
+    const __m128 scaleVector = _mm_set1_ps(scale);
+    const __m128i offsetVector = _mm_set1_epi32(offset);
+
+    size_t i = 0;
+    for (; i + g_VectorSize <= numElements; i += g_VectorSize)
+    {
+        __m128i low;
+        __m128i high;
+        LoadQuantized(src + i, low, high);
+        _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(low, offsetVector)), scaleVector));
+        _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_sub_epi32(high, offsetVector)), scaleVector));
+    }
+    return i;
+}
+
+#elif defined(ARMNN_QUANTIZED_CONVERSION_NEON)
+
+constexpr size_t g_VectorSize = 8;
+
+// vcvtaq rounds half away from zero, and the saturating add and narrowing clamp to the range of the quantized type.
+int32x4_t QuantizeToInt32(float32x4_t values, float32x4_t scale, int32x4_t offset)
+{
+    return vqaddq_s32(vcvtaq_s32_f32(vdivq_f32(values, scale)), offset);
+}
+
+void StoreQuantized(int32x4_t low, int32x4_t high, uint8_t* dst)
+{
+    vst1_u8(dst, vqmovun_s16(vcombine_s16(vqmovn_s32(low), vqmovn_s32(high))));
+}
+
+void StoreQuantized(int32x4_t low, int32x4_t high, int16_t* dst)
+{
+    vst1q_s16(dst, vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)));
+}
+
+void LoadQuantized(const uint8_t* src, int32x4_t& low, int32x4_t& high)
+{
+    const uint16x8_t values = vmovl_u8(vld1_u8(src));
+    low  = vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(values)));
+    high = vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(values)));
+}
+
+void LoadQuantized(const int16_t* src, int32x4_t& low, int32x4_t& high)
+{
+    const int16x8_t values = vld1q_s16(src);
+    low  = vmovl_s16(vget_low_s16(values));
+    high = vmovl_s16(vget_high_s16(values));
+}
+
+template<typename QuantizedType>
+size_t QuantizeVectors(const float* src, size_t numElements, QuantizedType* dst, float scale, int32_t offset)
+{
+    const float32x4_t scaleVector = vdupq_n_f32(scale);
+    const int32x4_t offsetVector = vdupq_n_s32(offset);
+
+    size_t i = 0;
+    for (; i + g_VectorSize <= numElements; i += g_VectorSize)
+    {
+        StoreQuantized(QuantizeToInt32(vld1q_f32(src + i), scaleVector, offsetVector),
+                       QuantizeToInt32(vld1q_f32(src + i + 4), scaleVector, offsetVector),
+                       dst + i);
+    }
+    return i;
+}
+
+template<typename QuantizedType>
+size_t DequantizeVectors(const QuantizedType* src, size_t numElements, float* dst, float scale, int32_t offset)
+{
+    const float32x4_t scaleVector = vdupq_n_f32(scale);
+    const int32x4_t offsetVector = vdupq_n_s32(offset);
+
+    size_t i = 0;
+    for (; i + g_VectorSize <= numElements; i += g_VectorSize)
+    {
+        int32x4_t low;
+        int32x4_t high;
+        LoadQuantized(src + i, low, high);
+        vst1q_f32(dst + i, vmulq_f32(vcvtq_f32_s32(vsubq_s32(low, offsetVector)), scaleVector));
+        vst1q_f32(dst + i + 4, vmulq_f32(vcvtq_f32_s32(vsubq_s32(high, offsetVector)), scaleVector));
+    }
+    return i;
+}
+
+#else
+
+template<typename QuantizedType>
+size_t QuantizeVectors(const float*, size_t, QuantizedType*, float, int32_t)
+{
+    return 0;
+}
+
+template<typename QuantizedType>
+size_t DequantizeVectors(const QuantizedType*, size_t, float*, float, int32_t)
+{
+    return 0;
+}
+
+#endif
+
+} // anonymous namespace
+
+template<typename QuantizedType>
+void QuantizedConverter::Quantize(const float* srcBuffer, size_t numElements, QuantizedType* dstBuffer,
+                                  float scale, int32_t offset)
+{
+    BOOST_ASSERT(srcBuffer != nullptr);
+    BOOST_ASSERT(dstBuffer != nullptr);
+    BOOST_ASSERT(scale != 0.f);
+
+    for (size_t i = QuantizeVectors(srcBuffer, numElements, dstBuffer, scale, offset); i < numElements; i++)
+    {
+        dstBuffer[i] = QuantizeValue<QuantizedType>(srcBuffer[i], scale, offset);
+    }
+}
+
+template<typename QuantizedType>
+void QuantizedConverter::Dequantize(const QuantizedType* srcBuffer, size_t numElements, float* dstBuffer,
+                                    float scale, int32_t offset)
+{
+    BOOST_ASSERT(srcBuffer != nullptr);
+    BOOST_ASSERT(dstBuffer != nullptr);
+
+    for (size_t i = DequantizeVectors(srcBuffer, numElements, dstBuffer, scale, offset); i < numElements; i++)
+    {
+        dstBuffer[i] = static_cast<float>(static_cast<int32_t>(srcBuffer[i]) - offset) * scale;
+    }
+}
+
+template
+void QuantizedConverter::Quantize<uint8_t>(const float*, size_t, uint8_t*, float, int32_t);
+
+template
+void QuantizedConverter::Quantize<int16_t>(const float*, size_t, int16_t*, float, int32_t);
+
+template
+void QuantizedConverter::Dequantize<uint8_t>(const uint8_t*, size_t, float*, float, int32_t);
+
+template
+void QuantizedConverter::Dequantize<int16_t>(const int16_t*, size_t, float*, float, int32_t);
+
+} //namespace armnnUtils
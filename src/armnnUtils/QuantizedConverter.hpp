@@ -0,0 +1,27 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace armnnUtils
+{
+class QuantizedConverter
+{
+public:
+    // Quantizes a buffer of FP32 values into dstBuffer. Gives the same results as calling armnn::Quantize on each
+    // value: rounds half away from zero, then clamps to the range of QuantizedType (uint8_t or int16_t).
+    template<typename QuantizedType>
+    static void Quantize(const float* srcBuffer, size_t numElements, QuantizedType* dstBuffer,
+                         float scale, int32_t offset);
+
+    // Dequantizes a buffer of quantized values into dstBuffer, with the same results as armnn::Dequantize.
+    template<typename QuantizedType>
+    static void Dequantize(const QuantizedType* srcBuffer, size_t numElements, float* dstBuffer,
+                           float scale, int32_t offset);
+};
+} //namespace armnnUtils
@@ -10,6 +10,8 @@
 #include <boost/format.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <algorithm>
+
 namespace armnnUtils
 {
 
@@ -52,33 +54,54 @@ armnn::TensorInfo GetTensorInfo(unsigned int numberOfBatches,
     }
 }
 
-std::pair<float, float> FindMinMax(armnn::ITensorHandle* tensorHandle)
+std::pair<float, float> FindMinMax(const float* data, unsigned int numElements)
 {
-    auto tensor_data = static_cast<const float *>(tensorHandle->Map(true));
-    auto tensor_size = tensorHandle->GetShape().GetNumElements();
+    if (numElements == 0)
+    {
+        return std::make_pair(0.0f, 0.0f);
+    }
 
-    // Set min/max initially to first value in tensor
-    float min = tensor_data[0];
-    float max = tensor_data[0];
+    // Independent accumulators for each lane break the dependency between consecutive comparisons, so that the
+    // compiler can keep them in vector registers
+    constexpr unsigned int numLanes = 8;
+    float mins[numLanes];
+    float maxs[numLanes];
+    for (unsigned int lane = 0; lane < numLanes; ++lane)
+    {
+        mins[lane] = data[0];
+        maxs[lane] = data[0];
+    }
 
-    // Loop over rest of tensor and update min/max if necessary
-    for (unsigned int val = 1; val < tensor_size; val++)
+    const unsigned int numVectorElements = numElements - numElements % numLanes;
+    for (unsigned int i = 0; i < numVectorElements; i += numLanes)
     {
-        if (tensor_data[val] < min)
+        for (unsigned int lane = 0; lane < numLanes; ++lane)
         {
-            min = tensor_data[val];
-        }
-        else if (tensor_data[val] > max)
-        {
-            max = tensor_data[val];
+            mins[lane] = std::min(mins[lane], data[i + lane]);
+            maxs[lane] = std::max(maxs[lane], data[i + lane]);
         }
     }
 
-    tensorHandle->Unmap();
+    float min = *std::min_element(mins, mins + numLanes);
+    float max = *std::max_element(maxs, maxs + numLanes);
+    for (unsigned int i = numVectorElements; i < numElements; ++i)
+    {
+        min = std::min(min, data[i]);
+        max = std::max(max, data[i]);
+    }
 
     return std::make_pair(min, max);
 }
 
+std::pair<float, float> FindMinMax(armnn::ITensorHandle* tensorHandle)
+{
+    auto tensorData = static_cast<const float*>(tensorHandle->Map(true));
+    auto minMax = FindMinMax(tensorData, tensorHandle->GetShape().GetNumElements());
+    tensorHandle->Unmap();
+
+    return minMax;
+}
+
 armnn::TensorShape ExpandDims(const armnn::TensorShape& tensorShape, int axis)
 {
     unsigned int outputDim = tensorShape.GetNumDimensions() + 1;
@@ -135,4 +158,21 @@ unsigned int GetUnsignedAxis(const unsigned int inputDimension, const int axis)
     return uAxis;
 }
 
+std::pair<unsigned int, std::vector<float>> GetPerAxisParams(const armnn::TensorInfo& info)
+{
+    const std::vector<float>& scales = info.GetQuantizationScales();
+    armnn::Optional<unsigned int> quantizationDim = info.GetQuantizationDim();
+    if (!info.HasPerAxisQuantization())
+    {
+        throw armnn::InvalidArgumentException(
+            std::string("Per-axis quantization params not set for tensor of type ") +
+            armnn::GetDataTypeName(info.GetDataType()), CHECK_LOCATION());
+    }
+    unsigned int axisFactor = GetNumElementsBetween(info.GetShape(),
+                                                    quantizationDim.value() + 1,
+                                                    info.GetNumDimensions());
+
+    return { axisFactor, scales };
+}
+
 }
@@ -22,6 +22,9 @@ armnn::TensorInfo GetTensorInfo(unsigned int numberOfBatches,
                                 const armnn::DataLayout dataLayout,
                                 const armnn::DataType dataType);
 
+/// Returns the smallest and largest of numElements floats, or (0, 0) if there are none.
+std::pair<float, float> FindMinMax(const float* data, unsigned int numElements);
+
 std::pair<float, float> FindMinMax(armnn::ITensorHandle* tensorHandle);
 
 armnn::TensorShape ExpandDims(const armnn::TensorShape& tensorShape, int axis);
@@ -32,4 +35,8 @@ unsigned int GetNumElementsBetween(const armnn::TensorShape& shape,
 
 unsigned int GetUnsignedAxis(const unsigned int inputDimension, const int axis);
 
+/// Returns the number of consecutive elements that share a quantization scale (the number of elements after the
+/// quantization dimension) and the scales, for a tensor with per-axis quantization.
+std::pair<unsigned int, std::vector<float>> GetPerAxisParams(const armnn::TensorInfo& info);
+
 } // namespace armnnUtils
@@ -0,0 +1,122 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <Permute.hpp>
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <numeric>
+#include <vector>
+
+using namespace armnn;
+using namespace armnnUtils;
+
+namespace
+{
+
+// Element by element permute used as the expected result.
+std::vector<uint8_t> ReferencePermute(const TensorShape& srcShape,
+                                      const PermutationVector& mappings,
+                                      const std::vector<uint8_t>& src,
+                                      size_t dataTypeSize)
+{
+    const TensorShape dstShape = Permuted(srcShape, mappings);
+    const unsigned int numDims = srcShape.GetNumDimensions();
+
+    std::vector<uint8_t> dst(src.size());
+    std::vector<unsigned int> index(numDims, 0);
+
+    for (unsigned int i = 0; i < srcShape.GetNumElements(); ++i)
+    {
+        unsigned int dstIndex = 0;
+        for (unsigned int d = 0; d < numDims; ++d)
+        {
+            unsigned int dstDimIndex = 0;
+            for (unsigned int k = 0; k < numDims; ++k)
+            {
+                if (mappings[k] == d)
+                {
+                    dstDimIndex = index[k];
+                }
+            }
+            dstIndex = dstIndex * dstShape[d] + dstDimIndex;
+        }
+        std::copy(src.data() + i * dataTypeSize,
+                  src.data() + (i + 1) * dataTypeSize,
+                  dst.data() + dstIndex * dataTypeSize);
+
+        for (unsigned int d = numDims; d-- > 0;)
+        {
+            if (++index[d] < srcShape[d])
+            {
+                break;
+            }
+            index[d] = 0;
+        }
+    }
+    return dst;
+}
+
+void CheckPermute(const TensorShape& srcShape, const PermutationVector& mappings, size_t dataTypeSize)
+{
+    std::vector<uint8_t> src(srcShape.GetNumElements() * dataTypeSize);
+    std::iota(src.begin(), src.end(), 0);
+
+    std::vector<uint8_t> dst(src.size());
+    Permute(Permuted(srcShape, mappings), mappings, src.data(), dst.data(), dataTypeSize);
+
+    const std::vector<uint8_t> expected = ReferencePermute(srcShape, mappings, src, dataTypeSize);
+    BOOST_TEST(dst == expected, boost::test_tools::per_element());
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(PermuteSuite)
+
+BOOST_AUTO_TEST_CASE(PermuteNhwcToNchw)
+{
+    for (size_t dataTypeSize : { 1u, 2u, 3u, 4u, 8u })
+    {
+        CheckPermute({ 2, 19, 37, 5 }, { 0, 2, 3, 1 }, dataTypeSize);
+        CheckPermute({ 1, 40, 33, 64 }, { 0, 2, 3, 1 }, dataTypeSize);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(PermuteNchwToNhwc)
+{
+    for (size_t dataTypeSize : { 1u, 2u, 3u, 4u, 8u })
+    {
+        CheckPermute({ 2, 5, 19, 37 }, { 0, 3, 1, 2 }, dataTypeSize);
+        CheckPermute({ 1, 64, 33, 40 }, { 0, 3, 1, 2 }, dataTypeSize);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(PermuteContiguousRows)
+{
+    // Swaps the two outer dimensions, the rows are copied whole.
+    CheckPermute({ 3, 4, 17 }, { 1, 0, 2 }, 4);
+    CheckPermute({ 2, 3, 4, 5 }, { 1, 0, 2, 3 }, 3);
+}
+
+BOOST_AUTO_TEST_CASE(PermuteReducesToCopy)
+{
+    // Only dimensions of size 1 move.
+    CheckPermute({ 1, 6, 1, 7 }, { 2, 1, 0, 3 }, 4);
+    CheckPermute({ 5, 1 }, { 1, 0 }, 2);
+    CheckPermute({ 1, 1, 1, 1 }, { 3, 2, 1, 0 }, 4);
+}
+
+BOOST_AUTO_TEST_CASE(PermuteGeneral)
+{
+    CheckPermute({ 2, 3, 4, 5 }, { 3, 2, 1, 0 }, 4);
+    CheckPermute({ 2, 3, 4, 5 }, { 1, 3, 0, 2 }, 2);
+    CheckPermute({ 7, 9, 11 }, { 2, 0, 1 }, 1);
+    CheckPermute({ 33, 17 }, { 1, 0 }, 4);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
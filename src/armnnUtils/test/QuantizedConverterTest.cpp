@@ -0,0 +1,80 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <QuantizedConverter.hpp>
+
+#include <armnn/TypesUtils.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+using namespace armnnUtils;
+
+namespace
+{
+
+// Values on both sides of every rounding tie, far outside the quantized range, and an odd number of them so that
+// the vector loop and the remainder are both exercised.
+std::vector<float> MakeValues(float scale)
+{
+    std::vector<float> values;
+    for (int i = -70000; i <= 70000; i += 7)
+    {
+        values.push_back((static_cast<float>(i) + 0.5f) * scale);
+        values.push_back(static_cast<float>(i) * 0.37f * scale);
+    }
+    values.push_back(1.0e20f);
+    values.push_back(-1.0e20f);
+    values.push_back(-0.0f);
+    return values;
+}
+
+template<typename QuantizedType>
+void CheckMatchesScalar(float scale, int32_t offset)
+{
+    const std::vector<float> values = MakeValues(scale);
+
+    std::vector<QuantizedType> quantized(values.size());
+    QuantizedConverter::Quantize(values.data(), values.size(), quantized.data(), scale, offset);
+
+    std::vector<float> dequantized(values.size());
+    QuantizedConverter::Dequantize(quantized.data(), quantized.size(), dequantized.data(), scale, offset);
+
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        BOOST_TEST(quantized[i] == armnn::Quantize<QuantizedType>(values[i], scale, offset));
+        BOOST_TEST(dequantized[i] == armnn::Dequantize(quantized[i], scale, offset));
+    }
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(QuantizedConverterSuite)
+
+BOOST_AUTO_TEST_CASE(QuantizeQAsymm8MatchesScalar)
+{
+    CheckMatchesScalar<uint8_t>(0.5f, 128);
+    CheckMatchesScalar<uint8_t>(1.7f, 3);
+}
+
+BOOST_AUTO_TEST_CASE(QuantizeQSymm16MatchesScalar)
+{
+    CheckMatchesScalar<int16_t>(0.01f, 0);
+    CheckMatchesScalar<int16_t>(3.0f, 0);
+}
+
+BOOST_AUTO_TEST_CASE(QuantizeRoundsHalfAwayFromZero)
+{
+    const std::vector<float> values = { -2.5f, -1.5f, -0.5f, 0.5f, 1.5f, 2.5f, 3.49f, -3.51f, 300.0f };
+    std::vector<int16_t> quantized(values.size());
+
+    QuantizedConverter::Quantize(values.data(), values.size(), quantized.data(), 1.0f, 0);
+
+    const std::vector<int16_t> expected = { -3, -2, -1, 1, 2, 3, 3, -4, 300 };
+    BOOST_TEST(quantized == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -9,6 +9,8 @@
 
 #include <boost/test/unit_test.hpp>
 
+#include <vector>
+
 using namespace armnn;
 using namespace armnnUtils;
 
@@ -134,4 +136,29 @@ BOOST_AUTO_TEST_CASE(ExpandDimsInvalidNegativeAxisTest)
     BOOST_CHECK_THROW(ExpandDims(inputShape, -5), armnn::InvalidArgumentException);
 }
 
+BOOST_AUTO_TEST_CASE(FindMinMaxTest)
+{
+    // Enough values for a few whole vectors and a remainder, with the extremes in the remainder
+    std::vector<float> values(21);
+    for (unsigned int i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<float>(i % 5) - 2.0f;
+    }
+    values[19] = -3.5f;
+    values[20] = 4.0f;
+
+    std::pair<float, float> minMax = FindMinMax(values.data(), static_cast<unsigned int>(values.size()));
+    BOOST_TEST(minMax.first == -3.5f);
+    BOOST_TEST(minMax.second == 4.0f);
+
+    // Fewer values than a vector
+    minMax = FindMinMax(values.data(), 3);
+    BOOST_TEST(minMax.first == -2.0f);
+    BOOST_TEST(minMax.second == 0.0f);
+
+    minMax = FindMinMax(values.data(), 0);
+    BOOST_TEST(minMax.first == 0.0f);
+    BOOST_TEST(minMax.second == 0.0f);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
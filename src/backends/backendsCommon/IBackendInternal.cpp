@@ -76,6 +76,11 @@ bool IBackendInternal::SupportsTensorAllocatorAPI() const
     return !GetHandleFactoryPreferences().empty();
 }
 
+bool IBackendInternal::SupportsFusedActivation(LayerType, const ActivationDescriptor&) const
+{
+    return false;
+}
+
 ITensorHandleFactory::FactoryId IBackendInternal::GetBackwardCompatibleFavoriteHandleFactory()
 {
     auto favorites = GetHandleFactoryPreferences();
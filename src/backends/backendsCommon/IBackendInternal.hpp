@@ -119,6 +119,10 @@ public:
 
     bool SupportsTensorAllocatorAPI() const;
 
+    /// (Optional) Returns true if the workloads this backend creates for layers of the given type apply
+    /// QueueDescriptor::m_FusedActivation, allowing a following ActivationLayer to be fused into them.
+    virtual bool SupportsFusedActivation(LayerType layerType, const ActivationDescriptor& activation) const;
+
     ITensorHandleFactory::FactoryId GetBackwardCompatibleFavoriteHandleFactory();
 
     /// (Optional) Returns a vector of supported TensorHandleFactory ids in preference order.
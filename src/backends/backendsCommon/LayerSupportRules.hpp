@@ -26,10 +26,14 @@ inline armnn::Optional<armnn::DataType> GetBiasTypeFromWeightsType(armnn::Option
         case armnn::DataType::Float16:
         case armnn::DataType::Float32:
             return weightsType;
+        case armnn::DataType::BFloat16:
+            return armnn::DataType::Float32;
         case armnn::DataType::QuantisedAsymm8:
             return armnn::DataType::Signed32;
         case armnn::DataType::QuantisedSymm16:
             return armnn::DataType::Signed32;
+        case armnn::DataType::QuantisedSymm8PerAxis:
+            return armnn::DataType::Signed32;
         default:
             BOOST_ASSERT_MSG(false, "GetBiasTypeFromWeightsType(): Unsupported data type.");
     }
@@ -30,6 +30,7 @@ DataType GetBiasDataType(DataType inputDataType)
         case DataType::Float16:
             return DataType::Float16;
         case DataType::Float32:
+        case DataType::BFloat16:
             return DataType::Float32;
         case DataType::QuantisedAsymm8:
             return DataType::Signed32;
@@ -192,6 +193,35 @@ void ValidateBiasTensorQuantization(const TensorInfo& biasTensor,
                                     const TensorInfo& weightsTensorInfo,
                                     const std::string& descName)
 {
+    if (weightsTensorInfo.HasPerAxisQuantization())
+    {
+        // Each output channel has its own bias scale, the product of the input scale and the scale of the weights
+        // producing that channel: for depthwise convolutions, several output channels share a weights scale.
+        const std::vector<float>& weightScales = weightsTensorInfo.GetQuantizationScales();
+        const std::vector<float>& biasScales = biasTensor.GetQuantizationScales();
+        if (!biasTensor.HasPerAxisQuantization() || weightScales.empty() || biasScales.empty() ||
+            biasScales.size() % weightScales.size() != 0)
+        {
+            throw InvalidArgumentException(descName + ": Expected one quantization scale per output channel for "
+                                           "bias tensor, as the weights have per-axis quantization.");
+        }
+        const size_t biasesPerWeightScale = biasScales.size() / weightScales.size();
+        for (size_t i = 0; i < biasScales.size(); ++i)
+        {
+            const float expectedScale =
+                inputTensorInfo.GetQuantizationScale() * weightScales[i / biasesPerWeightScale];
+            if (std::abs(biasScales[i] - expectedScale) > 0.00000001f)
+            {
+                std::stringstream msg;
+                msg << std::setprecision(10) << descName << ": Expected " << expectedScale <<
+                    " quantization scale for bias tensor at index " << i <<
+                    " (the product of the input and weight scales), but got " << biasScales[i];
+                throw InvalidArgumentException(msg.str());
+            }
+        }
+        return;
+    }
+
     if (biasTensor.GetQuantizationOffset() != 0)
     {
         throw InvalidArgumentException(descName + ": Expected zero quantization offset for bias tensor but got " +
@@ -292,6 +322,66 @@ void ValidateTensorDataTypesMatch(const TensorInfo& first,
     }
 }
 
+//---------------------------------------------------------------
+void ValidateAccumulatorOutputDataType(const TensorInfo& inputInfo,
+                                       const TensorInfo& outputInfo,
+                                       const std::string& descName)
+{
+    // BFloat16 inputs are accumulated in Float32, which can be stored as it is.
+    if (inputInfo.GetDataType() == DataType::BFloat16 && outputInfo.GetDataType() == DataType::Float32)
+    {
+        return;
+    }
+
+    ValidateTensorDataTypesMatch(inputInfo, outputInfo, descName, "input", "output");
+}
+
+//---------------------------------------------------------------
+// allowQSymm16With8BitWeights is only set by the FullyConnected and Convolution2d workloads, whose reference
+// kernels also take 8-bit weights with QuantisedSymm16 inputs.
+void ValidateWeightDataType(const TensorInfo& inputInfo,
+                            const TensorInfo& weightInfo,
+                            const std::string& descName,
+                            bool allowQSymm16With8BitWeights = false)
+{
+    if (inputInfo.GetDataType() == DataType::QuantisedAsymm8)
+    {
+        const std::vector<DataType> validTypes =
+        {
+            DataType::QuantisedAsymm8,
+            DataType::QuantisedSymm8PerAxis
+        };
+
+        ValidateDataTypes(weightInfo, validTypes, descName);
+    }
+    else if (inputInfo.GetDataType() == DataType::QuantisedSymm16 && allowQSymm16With8BitWeights)
+    {
+        const std::vector<DataType> validTypes =
+        {
+            DataType::QuantisedSymm16,
+            DataType::QuantisedAsymm8,
+            DataType::QuantisedSymm8PerAxis
+        };
+
+        ValidateDataTypes(weightInfo, validTypes, descName);
+    }
+    else
+    {
+        ValidateTensorDataTypesMatch(inputInfo, weightInfo, descName, "input", "weight");
+    }
+
+    if (weightInfo.GetDataType() == DataType::QuantisedSymm8PerAxis)
+    {
+        const Optional<unsigned int> quantizationDim = weightInfo.GetQuantizationDim();
+        if (!quantizationDim.has_value() || quantizationDim.value() >= weightInfo.GetNumDimensions() ||
+            weightInfo.GetQuantizationScales().size() != weightInfo.GetShape()[quantizationDim.value()])
+        {
+            throw InvalidArgumentException(descName + ": Per-axis quantized weight tensor must have one "
+                                           "quantization scale per index along its quantization dimension.");
+        }
+    }
+}
+
 //---------------------------------------------------------------
 void ValidateTensorNumElementsMatch(const TensorInfo& first,
                                     const TensorInfo& second,
@@ -825,6 +915,7 @@ void FullyConnectedQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) c
 
     const TensorInfo& weightTensorInfo = m_Weight->GetTensorInfo();
     ValidateTensorNumDimensions(weightTensorInfo, descriptorName, 2, "weight");
+    ValidateWeightDataType(inputTensorInfo, weightTensorInfo, descriptorName, true);
 
     if (m_Parameters.m_BiasEnabled)
     {
@@ -841,6 +932,7 @@ void FullyConnectedQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) c
     // Check the supported data types
     std::vector<DataType> supportedTypes =
     {
+        DataType::BFloat16,
         DataType::Float32,
         DataType::Float16,
         DataType::QuantisedAsymm8,
@@ -848,7 +940,7 @@ void FullyConnectedQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) c
     };
 
     ValidateDataTypes(inputTensorInfo, supportedTypes, descriptorName);
-    ValidateTensorDataTypesMatch(inputTensorInfo, outputTensorInfo, descriptorName, "input", "output");
+    ValidateAccumulatorOutputDataType(inputTensorInfo, outputTensorInfo, descriptorName);
 }
 
 void NormalizationQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
@@ -1008,7 +1100,7 @@ void Convolution2dQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) co
     const TensorInfo& weightTensorInfo = m_Weight->GetTensorInfo();
     ValidateTensorNumDimensions(weightTensorInfo, descriptorName, 4, "weight");
 
-    ValidateTensorDataTypesMatch(inputTensorInfo, weightTensorInfo, descriptorName, "input", "weight");
+    ValidateWeightDataType(inputTensorInfo, weightTensorInfo, descriptorName, true);
 
     if (m_Parameters.m_BiasEnabled)
     {
@@ -1023,6 +1115,7 @@ void Convolution2dQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) co
 
     std::vector<DataType> supportedTypes =
     {
+        DataType::BFloat16,
         DataType::Float32,
         DataType::QuantisedAsymm8,
         DataType::QuantisedSymm16,
@@ -1030,7 +1123,7 @@ void Convolution2dQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) co
     };
 
     ValidateDataTypes(inputTensorInfo, supportedTypes, descriptorName);
-    ValidateTensorDataTypesMatch(inputTensorInfo, outputTensorInfo, descriptorName, "input", "output");
+    ValidateAccumulatorOutputDataType(inputTensorInfo, outputTensorInfo, descriptorName);
 }
 
 void DepthwiseConvolution2dQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
@@ -1075,7 +1168,7 @@ void DepthwiseConvolution2dQueueDescriptor::Validate(const WorkloadInfo& workloa
                                      numWeightInputChannels % numWeightChannelMultiplier));
     }
 
-    ValidateTensorDataTypesMatch(inputTensorInfo, weightTensorInfo, descriptorName, "input", "weight");
+    ValidateWeightDataType(inputTensorInfo, weightTensorInfo, descriptorName);
 
     if (m_Parameters.m_BiasEnabled)
     {
@@ -1787,6 +1880,29 @@ void LstmQueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
     }
 }
 
+void ConvertFp32ToBf16QueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
+{
+    const std::string descriptorName{"ConvertFp32ToBf16QueueDescriptor"};
+
+    ValidateNumInputs(workloadInfo,  descriptorName, 1);
+    ValidateNumOutputs(workloadInfo, descriptorName, 1);
+
+    const TensorInfo& inputTensorInfo  = workloadInfo.m_InputTensorInfos[0];
+    const TensorInfo& outputTensorInfo = workloadInfo.m_OutputTensorInfos[0];
+
+    if (inputTensorInfo.GetDataType() != DataType::Float32)
+    {
+        throw InvalidArgumentException(descriptorName + ": Input tensor type must be Float32.");
+    }
+
+    if (outputTensorInfo.GetDataType() != DataType::BFloat16)
+    {
+        throw InvalidArgumentException(descriptorName + ": Output tensor type must be BFloat16.");
+    }
+
+    ValidateTensorShapesMatch(inputTensorInfo, outputTensorInfo, descriptorName, "input", "output");
+}
+
 void ConvertFp32ToFp16QueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
 {
     const std::string descriptorName{"ConvertFp32ToFp16QueueDescriptor"};
@@ -1810,6 +1926,29 @@ void ConvertFp32ToFp16QueueDescriptor::Validate(const WorkloadInfo& workloadInfo
     ValidateTensorShapesMatch(inputTensorInfo, outputTensorInfo, descriptorName, "input", "output");
 }
 
+void ConvertBf16ToFp32QueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
+{
+    const std::string descriptorName{"ConvertBf16ToFp32QueueDescriptor"};
+
+    ValidateNumInputs(workloadInfo,  descriptorName, 1);
+    ValidateNumOutputs(workloadInfo, descriptorName, 1);
+
+    const TensorInfo& inputTensorInfo  = workloadInfo.m_InputTensorInfos[0];
+    const TensorInfo& outputTensorInfo = workloadInfo.m_OutputTensorInfos[0];
+
+    if (inputTensorInfo.GetDataType() != DataType::BFloat16)
+    {
+        throw InvalidArgumentException(descriptorName + ": Input tensor type must be BFloat16.");
+    }
+
+    if (outputTensorInfo.GetDataType() != DataType::Float32)
+    {
+        throw InvalidArgumentException(descriptorName + ": Output tensor type must be Float32.");
+    }
+
+    ValidateTensorShapesMatch(inputTensorInfo, outputTensorInfo, descriptorName, "input", "output");
+}
+
 void ConvertFp16ToFp32QueueDescriptor::Validate(const WorkloadInfo& workloadInfo) const
 {
     const std::string descriptorName{"ConvertFp16ToFp32QueueDescriptor"};
@@ -11,6 +11,7 @@
 #include <armnn/Deprecated.hpp>
 #include <armnn/Descriptors.hpp>
 #include <armnn/Exceptions.hpp>
+#include <armnn/Optional.hpp>
 #include <armnn/Types.hpp>
 #include <armnn/Tensor.hpp>
 
@@ -30,6 +31,10 @@ struct QueueDescriptor
     std::vector<ITensorHandle*> m_Inputs;
     std::vector<ITensorHandle*> m_Outputs;
 
+    /// Activation to apply to the output before it is written. Only set for the layers the backend
+    /// reported support for in IBackendInternal::SupportsFusedActivation().
+    Optional<ActivationDescriptor> m_FusedActivation;
+
     void ValidateInputsOutputs(const std::string& descName,
         unsigned int numExpectedIn, unsigned int numExpectedOut) const;
 
@@ -401,11 +406,21 @@ struct LstmQueueDescriptor : QueueDescriptorWithParameters<LstmDescriptor>
     void Validate(const WorkloadInfo& workloadInfo) const;
 };
 
+struct ConvertBf16ToFp32QueueDescriptor : QueueDescriptor
+{
+    void Validate(const WorkloadInfo& workloadInfo) const;
+};
+
 struct ConvertFp16ToFp32QueueDescriptor : QueueDescriptor
 {
     void Validate(const WorkloadInfo& workloadInfo) const;
 };
 
+struct ConvertFp32ToBf16QueueDescriptor : QueueDescriptor
+{
+    void Validate(const WorkloadInfo& workloadInfo) const;
+};
+
 struct ConvertFp32ToFp16QueueDescriptor : QueueDescriptor
 {
     void Validate(const WorkloadInfo& workloadInfo) const;
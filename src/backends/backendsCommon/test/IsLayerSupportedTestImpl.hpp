@@ -401,8 +401,12 @@ DECLARE_LAYER_POLICY_2_PARAM(Concat)
 
 DECLARE_LAYER_POLICY_1_PARAM(Constant)
 
+DECLARE_LAYER_POLICY_1_PARAM(ConvertBf16ToFp32)
+
 DECLARE_LAYER_POLICY_1_PARAM(ConvertFp16ToFp32)
 
+DECLARE_LAYER_POLICY_1_PARAM(ConvertFp32ToBf16)
+
 DECLARE_LAYER_POLICY_1_PARAM(ConvertFp32ToFp16)
 
 DECLARE_LAYER_POLICY_2_PARAM(Convolution2d)
@@ -128,6 +128,36 @@ BOOST_AUTO_TEST_CASE(FullyConnectedQueueDescriptor_Validate_RequiredDataMissing)
     BOOST_CHECK_THROW(RefFullyConnectedWorkload(invalidData, invalidInfo), armnn::InvalidArgumentException);
 }
 
+BOOST_AUTO_TEST_CASE(DepthwiseConvolution2dQueueDescriptor_Validate_QSymm16InputWith8BitWeights)
+{
+    unsigned int inputShape[]   = { 1, 2, 4, 4 };
+    unsigned int outputShape[]  = { 1, 2, 2, 2 };
+    unsigned int weightsShape[] = { 1, 2, 3, 3 };
+
+    armnn::TensorInfo inputTensorInfo(4, inputShape, armnn::DataType::QuantisedSymm16, 0.5f, 0);
+    armnn::TensorInfo outputTensorInfo(4, outputShape, armnn::DataType::QuantisedSymm16, 0.5f, 0);
+    armnn::TensorInfo weightsDesc(4, weightsShape, armnn::DataType::QuantisedAsymm8, 0.5f, 128);
+
+    DepthwiseConvolution2dQueueDescriptor invalidData;
+    WorkloadInfo                          invalidInfo;
+
+    ScopedCpuTensorHandle weightTensor(weightsDesc);
+
+    AddInputToWorkload(invalidData, invalidInfo, inputTensorInfo, nullptr);
+    AddOutputToWorkload(invalidData, invalidInfo, outputTensorInfo, nullptr);
+    invalidData.m_Weight = &weightTensor;
+    invalidData.m_Parameters.m_StrideX = 1;
+    invalidData.m_Parameters.m_StrideY = 1;
+
+    // Only FullyConnected and Convolution2d take 8-bit weights with QuantisedSymm16 inputs.
+    BOOST_CHECK_THROW(invalidData.Validate(invalidInfo), armnn::InvalidArgumentException);
+
+    ScopedCpuTensorHandle qSymm16WeightTensor(
+        armnn::TensorInfo(4, weightsShape, armnn::DataType::QuantisedSymm16, 0.5f, 0));
+    invalidData.m_Weight = &qSymm16WeightTensor;
+    BOOST_CHECK_NO_THROW(invalidData.Validate(invalidInfo));
+}
+
 
 BOOST_AUTO_TEST_CASE(NormalizationQueueDescriptor_Validate_WrongInputHeight)
 {
@@ -19,6 +19,7 @@
 #include <boost/multi_array.hpp>
 
 #include <algorithm>
+#include <random>
 
 template<armnn::DataType ArmnnType, typename T = armnn::ResolveType<ArmnnType>>
 LayerTestResult<T, 4> BoundedReLuTestCommon(
@@ -1138,3 +1139,76 @@ LayerTestResult<int16_t,4> CompareActivationInt16Test(
     return CompareActivationTestImpl<armnn::DataType::QuantisedSymm16>(
             workloadFactory, memoryManager, refWorkloadFactory, f, 5, 0.1f, 0);
 }
+
+LayerTestResult<int16_t, 4> ActivationRescaleInt16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    armnn::ActivationFunction f)
+{
+    const armnn::TensorShape shape({ 1, 1, 4, 250 });
+    const float inputScale  = 1.0f / 2048.0f;
+    const float outputScale = 1.0f / 4096.0f;
+
+    armnn::TensorInfo inputTensorInfo(shape, armnn::DataType::QuantisedSymm16, inputScale, 0);
+    armnn::TensorInfo outputTensorInfo(shape, armnn::DataType::QuantisedSymm16, outputScale, 0);
+    armnn::TensorInfo floatTensorInfo(shape, armnn::DataType::Float32);
+
+    // Inputs spanning the whole int16 range.
+    std::mt19937 generator(1213);
+    std::vector<int16_t> inputData(shape.GetNumElements());
+    std::generate(inputData.begin(), inputData.end(), [&]()
+    {
+        return static_cast<int16_t>(std::uniform_int_distribution<int>(-32767, 32767)(generator));
+    });
+    std::vector<float> floatInputData(inputData.size());
+    std::transform(inputData.begin(), inputData.end(), floatInputData.begin(),
+                   [&](int16_t value) { return armnn::Dequantize(value, inputScale, 0); });
+
+    LayerTestResult<int16_t, 4> result(outputTensorInfo);
+
+    std::unique_ptr<armnn::ITensorHandle> inputHandle = workloadFactory.CreateTensorHandle(inputTensorInfo);
+    std::unique_ptr<armnn::ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputTensorInfo);
+    std::unique_ptr<armnn::ITensorHandle> floatInputHandle = workloadFactory.CreateTensorHandle(floatTensorInfo);
+    std::unique_ptr<armnn::ITensorHandle> floatOutputHandle = workloadFactory.CreateTensorHandle(floatTensorInfo);
+
+    armnn::ActivationQueueDescriptor data;
+    armnn::WorkloadInfo info;
+    AddInputToWorkload(data, info, inputTensorInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputTensorInfo, outputHandle.get());
+    data.m_Parameters.m_Function = f;
+    data.m_Parameters.m_A        = 0.75f;
+    data.m_Parameters.m_B        = -0.25f;
+
+    // The same activation on the dequantized input, whose quantized output is the expected one.
+    armnn::ActivationQueueDescriptor floatData = data;
+    armnn::WorkloadInfo floatInfo = info;
+    SetWorkloadInput(floatData, floatInfo, 0, floatTensorInfo, floatInputHandle.get());
+    SetWorkloadOutput(floatData, floatInfo, 0, floatTensorInfo, floatOutputHandle.get());
+
+    std::unique_ptr<armnn::IWorkload> workload = workloadFactory.CreateActivation(data, info);
+    BOOST_ASSERT(workload != nullptr);
+    std::unique_ptr<armnn::IWorkload> floatWorkload = workloadFactory.CreateActivation(floatData, floatInfo);
+    BOOST_ASSERT(floatWorkload != nullptr);
+
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+    floatInputHandle->Allocate();
+    floatOutputHandle->Allocate();
+
+    CopyDataToITensorHandle(inputHandle.get(), inputData.data());
+    CopyDataToITensorHandle(floatInputHandle.get(), floatInputData.data());
+
+    workload->Execute();
+    floatWorkload->Execute();
+
+    std::vector<float> floatOutputData(shape.GetNumElements());
+    CopyDataFromITensorHandle(&result.output[0][0][0][0], outputHandle.get());
+    CopyDataFromITensorHandle(floatOutputData.data(), floatOutputHandle.get());
+
+    result.outputExpected = MakeTensor<int16_t, 4>(outputTensorInfo,
+                                                   QuantizedVector<int16_t>(outputScale, 0, floatOutputData));
+
+    // The table is filled by the float implementation, so its outputs must match exactly.
+    BOOST_TEST((result.output == result.outputExpected));
+    return result;
+}
@@ -222,3 +222,8 @@ LayerTestResult<int16_t, 4> CompareActivationInt16Test(
         const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
         armnn::IWorkloadFactory& refWorkloadFactory,
         armnn::ActivationFunction f);
+
+LayerTestResult<int16_t, 4> ActivationRescaleInt16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    armnn::ActivationFunction f);
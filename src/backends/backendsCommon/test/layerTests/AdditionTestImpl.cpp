@@ -546,6 +546,28 @@ LayerTestResult<float, 4> AdditionAfterMaxPoolTest(
     return addRet;
 }
 
+LayerTestResult<int16_t, 4> AdditionRescaleInt16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
+{
+    return ElementwiseQSymm16TestHelper<armnn::AdditionQueueDescriptor>(
+        workloadFactory, memoryManager, std::plus<double>(), 1.0f / 256.0f, 1.0f / 64.0f, 1.0f / 128.0f, 32767);
+}
+
+LayerTestResult<int16_t, 4> AdditionRescaleBoundedReLuInt16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
+{
+    armnn::ActivationDescriptor boundedReLu;
+    boundedReLu.m_Function = armnn::ActivationFunction::BoundedReLu;
+    boundedReLu.m_A = 100.0f;
+    boundedReLu.m_B = -50.0f;
+
+    return ElementwiseQSymm16TestHelper<armnn::AdditionQueueDescriptor>(
+        workloadFactory, memoryManager, std::plus<double>(), 1.0f / 256.0f, 1.0f / 64.0f, 1.0f / 128.0f, 32767,
+        boundedReLu);
+}
+
 LayerTestResult<float,4> CompareAdditionTest(
     armnn::IWorkloadFactory& workloadFactory,
     const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
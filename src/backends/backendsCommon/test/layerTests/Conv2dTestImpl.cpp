@@ -21,6 +21,7 @@
 
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <random>
 #include <string>
 
 //
@@ -2992,6 +2993,381 @@ LayerTestResult<uint8_t, 4> Convolution1dUint8Test(
             workloadFactory, memoryManager, 0.1f, 128, biasEnabled);
 }
 
+LayerTestResult<uint8_t, 4> Convolution2dPerAxisQuantTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
+{
+    using namespace armnn;
+
+    // A 1x1 convolution of two NHWC pixels with two channels, whose weights and biases have a scale per output
+    // channel.
+    TensorInfo inputInfo({1, 1, 2, 2}, DataType::QuantisedAsymm8, 0.5f, 128);
+    TensorInfo outputInfo({1, 1, 2, 2}, DataType::QuantisedAsymm8, 0.5f, 128);
+    TensorInfo kernelInfo({2, 1, 1, 2}, DataType::QuantisedSymm8PerAxis, {0.5f, 0.25f}, 0);
+    TensorInfo biasInfo({2}, DataType::Signed32, {0.25f, 0.125f}, 0);
+
+    // Input: {1, 2}, {3, -1}
+    std::vector<uint8_t> inputData{130, 132, 134, 126};
+    // Weights: {1, 2}, {-1, 2}
+    std::vector<int8_t> kernelData{2, 4, -4, 8};
+    // Biases: {1, -1}
+    std::vector<int32_t> biasData{4, -8};
+    // Output: {6, 2}, {2, -6}
+    std::vector<uint8_t> expectedOutputData{140, 132, 132, 116};
+
+    std::unique_ptr<ITensorHandle> inputHandle  = workloadFactory.CreateTensorHandle(inputInfo);
+    std::unique_ptr<ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputInfo);
+
+    Convolution2dQueueDescriptor data;
+    WorkloadInfo info;
+    ScopedCpuTensorHandle weightsTensor(kernelInfo);
+    ScopedCpuTensorHandle biasTensor(biasInfo);
+
+    AllocateAndCopyDataToITensorHandle(&weightsTensor, kernelData.data());
+    AllocateAndCopyDataToITensorHandle(&biasTensor, biasData.data());
+
+    AddInputToWorkload(data, info, inputInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputInfo, outputHandle.get());
+
+    data.m_Weight = &weightsTensor;
+    data.m_Bias   = &biasTensor;
+    data.m_Parameters.m_StrideX     = 1;
+    data.m_Parameters.m_StrideY     = 1;
+    data.m_Parameters.m_BiasEnabled = true;
+    data.m_Parameters.m_DataLayout  = DataLayout::NHWC;
+
+    std::unique_ptr<IWorkload> workload = workloadFactory.CreateConvolution2d(data, info);
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+
+    CopyDataToITensorHandle(inputHandle.get(), inputData.data());
+
+    ExecuteWorkload(*workload, memoryManager);
+
+    LayerTestResult<uint8_t, 4> ret(outputInfo);
+    CopyDataFromITensorHandle(&ret.output[0][0][0][0], outputHandle.get());
+    ret.outputExpected = MakeTensor<uint8_t, 4>(outputInfo, expectedOutputData);
+    return ret;
+}
+
+LayerTestResult<float, 4> Convolution2dSparseWeightsTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    float density,
+    const armnn::DataLayout layout)
+{
+    using namespace armnn;
+
+    const unsigned int batchSize      = 2;
+    const unsigned int inputChannels  = 6;
+    const unsigned int inputHeight    = 7;
+    const unsigned int inputWidth     = 9;
+    const unsigned int outputChannels = 5;
+    const unsigned int kernelSize     = 3;
+    const unsigned int strideX        = 1;
+    const unsigned int strideY        = 2;
+    const unsigned int padding        = 1;
+
+    const unsigned int outputHeight = (inputHeight + 2 * padding - kernelSize) / strideY + 1;
+    const unsigned int outputWidth  = (inputWidth + 2 * padding - kernelSize) / strideX + 1;
+
+    const armnnUtils::DataLayoutIndexed dataLayout(layout);
+    TensorInfo inputInfo = armnnUtils::GetTensorInfo(
+        batchSize, inputChannels, inputHeight, inputWidth, layout, DataType::Float32);
+    TensorInfo outputInfo = armnnUtils::GetTensorInfo(
+        batchSize, outputChannels, outputHeight, outputWidth, layout, DataType::Float32);
+    TensorInfo kernelInfo = armnnUtils::GetTensorInfo(
+        outputChannels, inputChannels, kernelSize, kernelSize, layout, DataType::Float32);
+    TensorInfo biasInfo({ outputChannels }, DataType::Float32);
+
+    // Prunes whole blocks of four consecutive weights, as BlockCsrMatrix stores them.
+    std::mt19937 generator(1234);
+    std::uniform_real_distribution<float> values(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> keep(0.0f, 1.0f);
+
+    std::vector<float> inputData(inputInfo.GetNumElements());
+    std::generate(inputData.begin(), inputData.end(), [&]() { return values(generator); });
+
+    std::vector<float> kernelData(kernelInfo.GetNumElements());
+    const unsigned int filterSize = kernelInfo.GetNumElements() / outputChannels;
+    for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+    {
+        for (unsigned int blockStart = 0; blockStart < filterSize; blockStart += 4)
+        {
+            const bool isZeroBlock = keep(generator) >= density;
+            for (unsigned int i = blockStart; i < std::min(blockStart + 4, filterSize); ++i)
+            {
+                kernelData[cOutput * filterSize + i] = isZeroBlock ? 0.0f : values(generator);
+            }
+        }
+    }
+
+    std::vector<float> biasData(outputChannels);
+    std::generate(biasData.begin(), biasData.end(), [&]() { return values(generator); });
+
+    // Computes the expected output directly.
+    std::vector<float> expectedOutputData(outputInfo.GetNumElements());
+    for (unsigned int n = 0; n < batchSize; ++n)
+    {
+        for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+        {
+            for (unsigned int yOutput = 0; yOutput < outputHeight; ++yOutput)
+            {
+                for (unsigned int xOutput = 0; xOutput < outputWidth; ++xOutput)
+                {
+                    float sum = biasData[cOutput];
+                    for (unsigned int cInput = 0; cInput < inputChannels; ++cInput)
+                    {
+                        for (unsigned int yKernel = 0; yKernel < kernelSize; ++yKernel)
+                        {
+                            for (unsigned int xKernel = 0; xKernel < kernelSize; ++xKernel)
+                            {
+                                const int yInput = static_cast<int>(yOutput * strideY + yKernel) -
+                                                   static_cast<int>(padding);
+                                const int xInput = static_cast<int>(xOutput * strideX + xKernel) -
+                                                   static_cast<int>(padding);
+                                if (yInput < 0 || yInput >= static_cast<int>(inputHeight) ||
+                                    xInput < 0 || xInput >= static_cast<int>(inputWidth))
+                                {
+                                    continue;
+                                }
+
+                                sum += kernelData[dataLayout.GetIndex(kernelInfo.GetShape(),
+                                                                      cOutput, cInput, yKernel, xKernel)] *
+                                       inputData[dataLayout.GetIndex(inputInfo.GetShape(), n, cInput,
+                                                                     static_cast<unsigned int>(yInput),
+                                                                     static_cast<unsigned int>(xInput))];
+                            }
+                        }
+                    }
+                    expectedOutputData[dataLayout.GetIndex(outputInfo.GetShape(), n, cOutput, yOutput, xOutput)] =
+                        sum;
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<ITensorHandle> inputHandle  = workloadFactory.CreateTensorHandle(inputInfo);
+    std::unique_ptr<ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputInfo);
+
+    Convolution2dQueueDescriptor data;
+    WorkloadInfo info;
+    ScopedCpuTensorHandle weightsTensor(kernelInfo);
+    ScopedCpuTensorHandle biasTensor(biasInfo);
+
+    AllocateAndCopyDataToITensorHandle(&weightsTensor, kernelData.data());
+    AllocateAndCopyDataToITensorHandle(&biasTensor, biasData.data());
+
+    AddInputToWorkload(data, info, inputInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputInfo, outputHandle.get());
+
+    data.m_Weight = &weightsTensor;
+    data.m_Bias   = &biasTensor;
+    data.m_Parameters.m_StrideX     = strideX;
+    data.m_Parameters.m_StrideY     = strideY;
+    data.m_Parameters.m_PadLeft     = padding;
+    data.m_Parameters.m_PadRight    = padding;
+    data.m_Parameters.m_PadTop      = padding;
+    data.m_Parameters.m_PadBottom   = padding;
+    data.m_Parameters.m_BiasEnabled = true;
+    data.m_Parameters.m_DataLayout  = layout;
+
+    std::unique_ptr<IWorkload> workload = workloadFactory.CreateConvolution2d(data, info);
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+
+    CopyDataToITensorHandle(inputHandle.get(), inputData.data());
+
+    ExecuteWorkload(*workload, memoryManager);
+
+    LayerTestResult<float, 4> ret(outputInfo);
+    CopyDataFromITensorHandle(&ret.output[0][0][0][0], outputHandle.get());
+    ret.outputExpected = MakeTensor<float, 4>(outputInfo, expectedOutputData);
+    return ret;
+}
+
+LayerTestResult<int16_t, 4> Convolution2dQSymm16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    armnn::DataType weightsType,
+    const armnn::DataLayout layout)
+{
+    using namespace armnn;
+
+    const unsigned int batchSize      = 2;
+    const unsigned int inputChannels  = 3;
+    const unsigned int inputHeight    = 7;
+    const unsigned int inputWidth     = 6;
+    const unsigned int outputChannels = 4;
+    const unsigned int kernelSize     = 3;
+    const unsigned int strideX        = 1;
+    const unsigned int strideY        = 2;
+    const unsigned int padding        = 1;
+
+    const unsigned int outputHeight = (inputHeight + 2 * padding - kernelSize) / strideY + 1;
+    const unsigned int outputWidth  = (inputWidth + 2 * padding - kernelSize) / strideX + 1;
+
+    const float inputScale   = 1.0f / 256.0f;
+    const float weightsScale = 1.0f / 64.0f;
+    const float outputScale  = 1.0f / 64.0f;
+
+    const armnnUtils::DataLayoutIndexed dataLayout(layout);
+    TensorInfo inputInfo = armnnUtils::GetTensorInfo(
+        batchSize, inputChannels, inputHeight, inputWidth, layout, DataType::QuantisedSymm16);
+    TensorInfo outputInfo = armnnUtils::GetTensorInfo(
+        batchSize, outputChannels, outputHeight, outputWidth, layout, DataType::QuantisedSymm16);
+    TensorInfo kernelInfo = armnnUtils::GetTensorInfo(
+        outputChannels, inputChannels, kernelSize, kernelSize, layout, weightsType);
+    TensorInfo biasInfo({ outputChannels }, DataType::Signed32, inputScale * weightsScale, 0);
+
+    inputInfo.SetQuantizationScale(inputScale);
+    outputInfo.SetQuantizationScale(outputScale);
+    kernelInfo.SetQuantizationScale(weightsScale);
+    kernelInfo.SetQuantizationOffset(weightsType == DataType::QuantisedAsymm8 ? 128 : 0);
+
+    // Per-axis kernels have their scale divided by 1, 2 or 4 for each output channel.
+    std::vector<float> kernelScales(outputChannels, weightsScale);
+    std::vector<float> biasScales(outputChannels, inputScale * weightsScale);
+    if (weightsType == DataType::QuantisedSymm8PerAxis)
+    {
+        for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+        {
+            kernelScales[cOutput] = weightsScale / static_cast<float>(1u << (cOutput % 3));
+            biasScales[cOutput] = inputScale * kernelScales[cOutput];
+        }
+        kernelInfo.SetQuantizationScales(kernelScales);
+        kernelInfo.SetQuantizationDim(Optional<unsigned int>(0));
+        biasInfo.SetQuantizationScales(biasScales);
+        biasInfo.SetQuantizationDim(Optional<unsigned int>(0));
+    }
+
+    std::mt19937 generator(5678);
+    const auto randomInt = [&](int min, int max) { return std::uniform_int_distribution<int>(min, max)(generator); };
+
+    std::vector<int16_t> inputData(inputInfo.GetNumElements());
+    std::generate(inputData.begin(), inputData.end(), [&]() { return static_cast<int16_t>(randomInt(-1000, 1000)); });
+
+    // kernel holds the dequantized kernel, in the layout of the quantized one.
+    std::vector<uint8_t> kernelData(kernelInfo.GetNumBytes());
+    std::vector<double> kernel(kernelInfo.GetNumElements());
+    const unsigned int filterSize = kernelInfo.GetNumElements() / outputChannels;
+    for (unsigned int i = 0; i < kernel.size(); ++i)
+    {
+        switch (weightsType)
+        {
+            case DataType::QuantisedAsymm8:
+            {
+                const auto value = static_cast<uint8_t>(randomInt(0, 255));
+                kernelData[i] = value;
+                kernel[i] = Dequantize(value, weightsScale, 128);
+                break;
+            }
+            case DataType::QuantisedSymm8PerAxis:
+            {
+                const auto value = static_cast<int8_t>(randomInt(-127, 127));
+                reinterpret_cast<int8_t*>(kernelData.data())[i] = value;
+                kernel[i] = Dequantize(value, kernelScales[i / filterSize], 0);
+                break;
+            }
+            default:
+            {
+                const auto value = static_cast<int16_t>(randomInt(-500, 500));
+                reinterpret_cast<int16_t*>(kernelData.data())[i] = value;
+                kernel[i] = Dequantize(value, weightsScale, 0);
+                break;
+            }
+        }
+    }
+
+    std::vector<int32_t> biasData(outputChannels);
+    std::generate(biasData.begin(), biasData.end(), [&]() { return randomInt(-20000, 20000); });
+
+    // Computes the expected output directly: the scales are powers of two, so that the products and sums of the
+    // dequantized values are exact.
+    std::vector<int16_t> expectedOutputData(outputInfo.GetNumElements());
+    for (unsigned int n = 0; n < batchSize; ++n)
+    {
+        for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+        {
+            for (unsigned int yOutput = 0; yOutput < outputHeight; ++yOutput)
+            {
+                for (unsigned int xOutput = 0; xOutput < outputWidth; ++xOutput)
+                {
+                    double sum = static_cast<double>(biasData[cOutput]) * biasScales[cOutput];
+                    for (unsigned int cInput = 0; cInput < inputChannels; ++cInput)
+                    {
+                        for (unsigned int yKernel = 0; yKernel < kernelSize; ++yKernel)
+                        {
+                            for (unsigned int xKernel = 0; xKernel < kernelSize; ++xKernel)
+                            {
+                                const int yInput = static_cast<int>(yOutput * strideY + yKernel) -
+                                                   static_cast<int>(padding);
+                                const int xInput = static_cast<int>(xOutput * strideX + xKernel) -
+                                                   static_cast<int>(padding);
+                                if (yInput < 0 || yInput >= static_cast<int>(inputHeight) ||
+                                    xInput < 0 || xInput >= static_cast<int>(inputWidth))
+                                {
+                                    continue;
+                                }
+
+                                const int16_t input = inputData[dataLayout.GetIndex(
+                                    inputInfo.GetShape(), n, cInput, static_cast<unsigned int>(yInput),
+                                    static_cast<unsigned int>(xInput))];
+                                sum += kernel[dataLayout.GetIndex(kernelInfo.GetShape(),
+                                                                  cOutput, cInput, yKernel, xKernel)] *
+                                       Dequantize(input, inputScale, 0);
+                            }
+                        }
+                    }
+                    expectedOutputData[dataLayout.GetIndex(outputInfo.GetShape(), n, cOutput, yOutput, xOutput)] =
+                        Quantize<int16_t>(static_cast<float>(sum), outputScale, 0);
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<ITensorHandle> inputHandle  = workloadFactory.CreateTensorHandle(inputInfo);
+    std::unique_ptr<ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputInfo);
+
+    Convolution2dQueueDescriptor data;
+    WorkloadInfo info;
+    ScopedCpuTensorHandle weightsTensor(kernelInfo);
+    ScopedCpuTensorHandle biasTensor(biasInfo);
+
+    AllocateAndCopyDataToITensorHandle(&weightsTensor, kernelData.data());
+    AllocateAndCopyDataToITensorHandle(&biasTensor, biasData.data());
+
+    AddInputToWorkload(data, info, inputInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputInfo, outputHandle.get());
+
+    data.m_Weight = &weightsTensor;
+    data.m_Bias   = &biasTensor;
+    data.m_Parameters.m_StrideX     = strideX;
+    data.m_Parameters.m_StrideY     = strideY;
+    data.m_Parameters.m_PadLeft     = padding;
+    data.m_Parameters.m_PadRight    = padding;
+    data.m_Parameters.m_PadTop      = padding;
+    data.m_Parameters.m_PadBottom   = padding;
+    data.m_Parameters.m_BiasEnabled = true;
+    data.m_Parameters.m_DataLayout  = layout;
+
+    std::unique_ptr<IWorkload> workload = workloadFactory.CreateConvolution2d(data, info);
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+
+    CopyDataToITensorHandle(inputHandle.get(), inputData.data());
+
+    ExecuteWorkload(*workload, memoryManager);
+
+    LayerTestResult<int16_t, 4> ret(outputInfo);
+    CopyDataFromITensorHandle(&ret.output[0][0][0][0], outputHandle.get());
+    ret.outputExpected = MakeTensor<int16_t, 4>(outputInfo, expectedOutputData);
+
+    // Exact comparison: a rounding error in the integer kernel would be within the tolerance of CompareTensors.
+    BOOST_TEST((ret.output == ret.outputExpected));
+    return ret;
+}
+
 LayerTestResult<float,4> CompareConvolution2dTest(
     armnn::IWorkloadFactory& workloadFactory,
     const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
@@ -3092,6 +3468,63 @@ LayerTestResult<uint8_t, 4> DepthwiseConvolution2dDepthMul1Uint8Test(
         workloadFactory, memoryManager, 0.5f, 50, biasEnabled, layout);
 }
 
+LayerTestResult<uint8_t, 4> DepthwiseConvolution2dPerAxisQuantTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
+{
+    using namespace armnn;
+
+    // A 1x1 depthwise convolution of two NCHW pixels with two channels and a depth multiplier of two. The weights
+    // have a scale per input channel, and the biases one per output channel i * M + m, that of input channel i.
+    TensorInfo inputInfo({1, 2, 1, 2}, DataType::QuantisedAsymm8, 0.5f, 128);
+    TensorInfo outputInfo({1, 4, 1, 2}, DataType::QuantisedAsymm8, 0.5f, 128);
+    TensorInfo kernelInfo({2, 2, 1, 1}, DataType::QuantisedSymm8PerAxis, {0.5f, 0.25f}, 1);
+    TensorInfo biasInfo({4}, DataType::Signed32, {0.25f, 0.25f, 0.125f, 0.125f}, 0);
+
+    // Input channels: {1, 2}, {3, -1}
+    std::vector<uint8_t> inputData{130, 132, 134, 126};
+    // Weights [m][i]: {1, 2}, {-1, -2}
+    std::vector<int8_t> kernelData{2, 8, -2, -8};
+    // Biases: {1, -1, 0.5, 2}
+    std::vector<int32_t> biasData{4, -4, 4, 16};
+    // Output channels: {2, 3}, {-2, -3}, {6.5, -1.5}, {-4, 4}
+    std::vector<uint8_t> expectedOutputData{132, 134, 124, 122, 141, 125, 120, 136};
+
+    std::unique_ptr<ITensorHandle> inputHandle  = workloadFactory.CreateTensorHandle(inputInfo);
+    std::unique_ptr<ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputInfo);
+
+    DepthwiseConvolution2dQueueDescriptor data;
+    WorkloadInfo info;
+    ScopedCpuTensorHandle weightsTensor(kernelInfo);
+    ScopedCpuTensorHandle biasTensor(biasInfo);
+
+    AllocateAndCopyDataToITensorHandle(&weightsTensor, kernelData.data());
+    AllocateAndCopyDataToITensorHandle(&biasTensor, biasData.data());
+
+    AddInputToWorkload(data, info, inputInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputInfo, outputHandle.get());
+
+    data.m_Weight = &weightsTensor;
+    data.m_Bias   = &biasTensor;
+    data.m_Parameters.m_StrideX     = 1;
+    data.m_Parameters.m_StrideY     = 1;
+    data.m_Parameters.m_BiasEnabled = true;
+    data.m_Parameters.m_DataLayout  = DataLayout::NCHW;
+
+    std::unique_ptr<IWorkload> workload = workloadFactory.CreateDepthwiseConvolution2d(data, info);
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+
+    CopyDataToITensorHandle(inputHandle.get(), inputData.data());
+
+    ExecuteWorkload(*workload, memoryManager);
+
+    LayerTestResult<uint8_t, 4> ret(outputInfo);
+    CopyDataFromITensorHandle(&ret.output[0][0][0][0], outputHandle.get());
+    ret.outputExpected = MakeTensor<uint8_t, 4>(outputInfo, expectedOutputData);
+    return ret;
+}
+
 LayerTestResult<float, 4> SimpleDepthwiseConvolution2d3x3Dilation3x3NhwcTest(
         armnn::IWorkloadFactory& workloadFactory,
         const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
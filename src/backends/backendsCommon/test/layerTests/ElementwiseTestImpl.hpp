@@ -21,7 +21,10 @@
 
 #include <test/TensorHelpers.hpp>
 
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <random>
 
 template<typename DescriptorType>
 std::unique_ptr<armnn::IWorkload> CreateWorkload(
@@ -52,7 +55,8 @@ LayerTestResult<TOutput, NumDims> ElementwiseTestHelper(
     const unsigned int outShape[NumDims],
     std::vector<TOutput> outValues,
     float outQuantScale,
-    int outQuantOffset)
+    int outQuantOffset,
+    const armnn::Optional<armnn::ActivationDescriptor>& fusedActivation = armnn::EmptyOptional())
 {
     armnn::TensorInfo inputTensorInfo0{NumDims, shape0, ArmnnTypeInput};
     armnn::TensorInfo inputTensorInfo1{NumDims, shape1, ArmnnTypeInput};
@@ -82,6 +86,7 @@ LayerTestResult<TOutput, NumDims> ElementwiseTestHelper(
     std::unique_ptr<armnn::ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputTensorInfo);
 
     Descriptor data;
+    data.m_FusedActivation = fusedActivation;
     armnn::WorkloadInfo info;
     AddInputToWorkload(data, info, inputTensorInfo0, inputHandle0.get());
     AddInputToWorkload(data, info, inputTensorInfo1, inputHandle1.get());
@@ -204,3 +209,68 @@ LayerTestResult<T, NumDims> ElementwiseTestHelper(
         quantScale,
         quantOffset);
 }
+
+/// Runs an elementwise operation on random QuantisedSymm16 inputs with different scales, the second one broadcast
+/// along two dimensions. The expected output is computed from the dequantized inputs by operation(x0, x1), then
+/// bounded by the fused activation, if any: the scales are powers of two, so that it is exact.
+template <typename Descriptor, typename Operation>
+LayerTestResult<int16_t, 4> ElementwiseQSymm16TestHelper(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    Operation operation,
+    float quantScale0,
+    float quantScale1,
+    float outQuantScale,
+    int limit,
+    const armnn::Optional<armnn::ActivationDescriptor>& fusedActivation = armnn::EmptyOptional())
+{
+    const unsigned int shape0[] = { 2, 3, 4, 5 };
+    const unsigned int shape1[] = { 1, 3, 1, 5 };
+
+    std::mt19937 generator(91011);
+    std::uniform_int_distribution<int> distribution(-limit, limit);
+    const auto generate = [&]() { return static_cast<int16_t>(distribution(generator)); };
+
+    std::vector<int16_t> values0(2 * 3 * 4 * 5);
+    std::vector<int16_t> values1(3 * 5);
+    std::generate(values0.begin(), values0.end(), generate);
+    std::generate(values1.begin(), values1.end(), generate);
+
+    std::vector<int16_t> outValues(values0.size());
+    for (unsigned int i = 0; i < values0.size(); ++i)
+    {
+        // Index of the element of the second input along the channels and the width
+        const unsigned int i1 = (i / (4 * 5)) % 3 * 5 + i % 5;
+        double value = operation(static_cast<double>(armnn::Dequantize(values0[i], quantScale0, 0)),
+                                 static_cast<double>(armnn::Dequantize(values1[i1], quantScale1, 0)));
+        if (fusedActivation.has_value())
+        {
+            BOOST_ASSERT(fusedActivation.value().m_Function == armnn::ActivationFunction::BoundedReLu);
+            value = std::min(std::max(value, static_cast<double>(fusedActivation.value().m_B)),
+                             static_cast<double>(fusedActivation.value().m_A));
+        }
+        outValues[i] = armnn::Quantize<int16_t>(static_cast<float>(value), outQuantScale, 0);
+    }
+
+    LayerTestResult<int16_t, 4> result =
+        ElementwiseTestHelper<4, Descriptor, armnn::DataType::QuantisedSymm16, armnn::DataType::QuantisedSymm16>(
+            workloadFactory,
+            memoryManager,
+            shape0,
+            values0,
+            quantScale0,
+            0,
+            shape1,
+            values1,
+            quantScale1,
+            0,
+            shape0,
+            outValues,
+            outQuantScale,
+            0,
+            fusedActivation);
+
+    // The fixed-point rescaling must round exactly like armnn::Quantize, which CompareTensors does not check.
+    BOOST_TEST((result.output == result.outputExpected));
+    return result;
+}
@@ -15,6 +15,10 @@
 
 #include <test/TensorHelpers.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 //
 // Implementation templates
 //
@@ -347,3 +351,357 @@ LayerTestResult<float, 2> FullyConnectedLargeTest(
 {
     return FullyConnectedLargeTestCommon<armnn::DataType::Float32>(workloadFactory, memoryManager, transposeWeights);
 }
+
+LayerTestResult<uint8_t, 2> FullyConnectedPerAxisQuantTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    bool transposeWeights)
+{
+    using namespace armnn;
+
+    // The weights are quantized along their output dimension: the second one, or the first one once transposed.
+    TensorInfo inputInfo({ 2, 2 }, DataType::QuantisedAsymm8, 0.5f, 128);
+    TensorInfo outputInfo({ 2, 2 }, DataType::QuantisedAsymm8, 0.5f, 128);
+    TensorInfo weightsInfo({ 2, 2 }, DataType::QuantisedSymm8PerAxis, { 0.5f, 0.25f }, transposeWeights ? 0 : 1);
+    TensorInfo biasInfo({ 2 }, DataType::Signed32, { 0.25f, 0.125f }, 0);
+
+    // Input: {1, 2}, {3, -1}
+    std::vector<uint8_t> inputData{ 130, 132, 134, 126 };
+    // Weights of each output: {1, -1}, {2, 2}
+    std::vector<int8_t> weightsData = transposeWeights ? std::vector<int8_t>{ 2, -2, 8, 8 }
+                                                       : std::vector<int8_t>{ 2, 8, -2, 8 };
+    // Biases: {1, -1}
+    std::vector<int32_t> biasData{ 4, -8 };
+    // Output: {0, 5}, {5, 3}
+    std::vector<uint8_t> expectedOutputData{ 128, 138, 138, 134 };
+
+    std::unique_ptr<ITensorHandle> inputHandle  = workloadFactory.CreateTensorHandle(inputInfo);
+    std::unique_ptr<ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputInfo);
+
+    FullyConnectedQueueDescriptor data;
+    WorkloadInfo info;
+    ScopedCpuTensorHandle weightsTensor(weightsInfo);
+    ScopedCpuTensorHandle biasTensor(biasInfo);
+
+    AllocateAndCopyDataToITensorHandle(&weightsTensor, weightsData.data());
+    AllocateAndCopyDataToITensorHandle(&biasTensor, biasData.data());
+
+    AddInputToWorkload(data, info, inputInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputInfo, outputHandle.get());
+    data.m_Weight = &weightsTensor;
+    data.m_Bias = &biasTensor;
+    data.m_Parameters.m_BiasEnabled = true;
+    data.m_Parameters.m_TransposeWeightMatrix = transposeWeights;
+
+    std::unique_ptr<IWorkload> workload = workloadFactory.CreateFullyConnected(data, info);
+
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+    CopyDataToITensorHandle(inputHandle.get(), inputData.data());
+
+    ExecuteWorkload(*workload, memoryManager);
+
+    LayerTestResult<uint8_t, 2> result(outputInfo);
+    CopyDataFromITensorHandle(&result.output[0][0], outputHandle.get());
+    result.outputExpected = MakeTensor<uint8_t, 2>(outputInfo, expectedOutputData);
+    return result;
+}
+
+LayerTestResult<float, 2> FullyConnectedSparseWeightsTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    float density,
+    bool transposeWeights)
+{
+    using namespace armnn;
+
+    // The input size is not a whole number of blocks, so that the last block of each output is partial.
+    const unsigned int batchSize  = 3;
+    const unsigned int inputSize  = 37;
+    const unsigned int outputSize = 9;
+
+    TensorInfo inputInfo({ batchSize, inputSize }, DataType::Float32);
+    TensorInfo outputInfo({ batchSize, outputSize }, DataType::Float32);
+    TensorInfo weightsInfo(transposeWeights ? TensorShape({ outputSize, inputSize }) :
+                                              TensorShape({ inputSize, outputSize }), DataType::Float32);
+    TensorInfo biasInfo({ outputSize }, DataType::Float32);
+
+    std::mt19937 generator(4321);
+    std::uniform_real_distribution<float> values(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> keep(0.0f, 1.0f);
+
+    std::vector<float> inputData(inputInfo.GetNumElements());
+    std::generate(inputData.begin(), inputData.end(), [&]() { return values(generator); });
+
+    // weights[o][i], pruned in blocks of four consecutive inputs.
+    std::vector<float> weights(outputSize * inputSize);
+    for (unsigned int o = 0; o < outputSize; ++o)
+    {
+        for (unsigned int blockStart = 0; blockStart < inputSize; blockStart += 4)
+        {
+            const bool isZeroBlock = keep(generator) >= density;
+            for (unsigned int i = blockStart; i < std::min(blockStart + 4, inputSize); ++i)
+            {
+                weights[o * inputSize + i] = isZeroBlock ? 0.0f : values(generator);
+            }
+        }
+    }
+
+    std::vector<float> weightsData(weights.size());
+    for (unsigned int o = 0; o < outputSize; ++o)
+    {
+        for (unsigned int i = 0; i < inputSize; ++i)
+        {
+            weightsData[transposeWeights ? o * inputSize + i : i * outputSize + o] = weights[o * inputSize + i];
+        }
+    }
+
+    std::vector<float> biasData(outputSize);
+    std::generate(biasData.begin(), biasData.end(), [&]() { return values(generator); });
+
+    std::vector<float> expectedOutputData(outputInfo.GetNumElements());
+    for (unsigned int n = 0; n < batchSize; ++n)
+    {
+        for (unsigned int o = 0; o < outputSize; ++o)
+        {
+            float sum = biasData[o];
+            for (unsigned int i = 0; i < inputSize; ++i)
+            {
+                sum += weights[o * inputSize + i] * inputData[n * inputSize + i];
+            }
+            expectedOutputData[n * outputSize + o] = sum;
+        }
+    }
+
+    std::unique_ptr<ITensorHandle> inputHandle  = workloadFactory.CreateTensorHandle(inputInfo);
+    std::unique_ptr<ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputInfo);
+
+    FullyConnectedQueueDescriptor data;
+    WorkloadInfo info;
+    ScopedCpuTensorHandle weightsTensor(weightsInfo);
+    ScopedCpuTensorHandle biasTensor(biasInfo);
+
+    AllocateAndCopyDataToITensorHandle(&weightsTensor, weightsData.data());
+    AllocateAndCopyDataToITensorHandle(&biasTensor, biasData.data());
+
+    AddInputToWorkload(data, info, inputInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputInfo, outputHandle.get());
+    data.m_Weight = &weightsTensor;
+    data.m_Bias = &biasTensor;
+    data.m_Parameters.m_BiasEnabled = true;
+    data.m_Parameters.m_TransposeWeightMatrix = transposeWeights;
+
+    std::unique_ptr<IWorkload> workload = workloadFactory.CreateFullyConnected(data, info);
+
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+    CopyDataToITensorHandle(inputHandle.get(), inputData.data());
+
+    ExecuteWorkload(*workload, memoryManager);
+
+    LayerTestResult<float, 2> result(outputInfo);
+    CopyDataFromITensorHandle(&result.output[0][0], outputHandle.get());
+    result.outputExpected = MakeTensor<float, 2>(outputInfo, expectedOutputData);
+    return result;
+}
+
+namespace
+{
+
+LayerTestResult<int16_t, 2> FullyConnectedQSymm16TestImpl(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    armnn::DataType weightsType,
+    bool transposeWeights,
+    float inputScale,
+    int inputLimit,
+    float weightsScale,
+    int weightsLimit,
+    float outputScale,
+    const armnn::Optional<armnn::ActivationDescriptor>& fusedActivation)
+{
+    using namespace armnn;
+
+    const unsigned int batchSize  = 3;
+    const unsigned int inputSize  = 19;
+    const unsigned int outputSize = 7;
+
+    TensorInfo inputInfo({ batchSize, inputSize }, DataType::QuantisedSymm16, inputScale, 0);
+    TensorInfo outputInfo({ batchSize, outputSize }, DataType::QuantisedSymm16, outputScale, 0);
+    TensorInfo weightsInfo(transposeWeights ? TensorShape({ outputSize, inputSize }) :
+                                              TensorShape({ inputSize, outputSize }),
+                           weightsType, weightsScale, weightsType == DataType::QuantisedAsymm8 ? 128 : 0);
+    TensorInfo biasInfo({ outputSize }, DataType::Signed32, inputScale * weightsScale, 0);
+
+    // Per-axis weights have their scale divided by 1, 2 or 4 for each output.
+    std::vector<float> weightsScales(outputSize, weightsScale);
+    std::vector<float> biasScales(outputSize, inputScale * weightsScale);
+    if (weightsType == DataType::QuantisedSymm8PerAxis)
+    {
+        for (unsigned int o = 0; o < outputSize; ++o)
+        {
+            weightsScales[o] = weightsScale / static_cast<float>(1u << (o % 3));
+            biasScales[o] = inputScale * weightsScales[o];
+        }
+        weightsInfo.SetQuantizationScales(weightsScales);
+        weightsInfo.SetQuantizationDim(Optional<unsigned int>(transposeWeights ? 0 : 1));
+        biasInfo.SetQuantizationScales(biasScales);
+        biasInfo.SetQuantizationDim(Optional<unsigned int>(0));
+    }
+
+    std::mt19937 generator(1234);
+    const auto randomInt = [&](int min, int max) { return std::uniform_int_distribution<int>(min, max)(generator); };
+
+    std::vector<int16_t> inputData(inputInfo.GetNumElements());
+    std::generate(inputData.begin(), inputData.end(),
+                  [&]() { return static_cast<int16_t>(randomInt(-inputLimit, inputLimit)); });
+
+    // weights[o][i] holds the dequantized weights.
+    std::vector<uint8_t> weightsData(weightsInfo.GetNumBytes());
+    std::vector<double> weights(outputSize * inputSize);
+    for (unsigned int o = 0; o < outputSize; ++o)
+    {
+        for (unsigned int i = 0; i < inputSize; ++i)
+        {
+            const unsigned int index = transposeWeights ? o * inputSize + i : i * outputSize + o;
+            switch (weightsType)
+            {
+                case DataType::QuantisedAsymm8:
+                {
+                    const auto value = static_cast<uint8_t>(randomInt(0, 255));
+                    weightsData[index] = value;
+                    weights[o * inputSize + i] = Dequantize(value, weightsScale, 128);
+                    break;
+                }
+                case DataType::QuantisedSymm8PerAxis:
+                {
+                    const auto value = static_cast<int8_t>(randomInt(-127, 127));
+                    reinterpret_cast<int8_t*>(weightsData.data())[index] = value;
+                    weights[o * inputSize + i] = Dequantize(value, weightsScales[o], 0);
+                    break;
+                }
+                default:
+                {
+                    const auto value = static_cast<int16_t>(randomInt(-weightsLimit, weightsLimit));
+                    reinterpret_cast<int16_t*>(weightsData.data())[index] = value;
+                    weights[o * inputSize + i] = Dequantize(value, weightsScale, 0);
+                    break;
+                }
+            }
+        }
+    }
+
+    std::vector<int32_t> biasData(outputSize);
+    std::generate(biasData.begin(), biasData.end(), [&]() { return randomInt(-20000, 20000); });
+
+    // Computes the expected output directly: the scales are powers of two, so that the products and sums of the
+    // dequantized values are exact.
+    std::vector<int16_t> expectedOutputData(outputInfo.GetNumElements());
+    for (unsigned int n = 0; n < batchSize; ++n)
+    {
+        for (unsigned int o = 0; o < outputSize; ++o)
+        {
+            double sum = static_cast<double>(biasData[o]) * biasScales[o];
+            for (unsigned int i = 0; i < inputSize; ++i)
+            {
+                sum += weights[o * inputSize + i] * Dequantize(inputData[n * inputSize + i], inputScale, 0);
+            }
+
+            if (fusedActivation.has_value())
+            {
+                const ActivationDescriptor& activation = fusedActivation.value();
+                switch (activation.m_Function)
+                {
+                    case ActivationFunction::ReLu:
+                        sum = std::max(sum, 0.0);
+                        break;
+                    case ActivationFunction::BoundedReLu:
+                        sum = std::min(std::max(sum, static_cast<double>(activation.m_B)),
+                                       static_cast<double>(activation.m_A));
+                        break;
+                    case ActivationFunction::Sigmoid:
+                        sum = 1.0 / (1.0 + std::exp(-sum));
+                        break;
+                    default:
+                        BOOST_ASSERT_MSG(false, "Unexpected fused activation");
+                }
+            }
+            expectedOutputData[n * outputSize + o] = Quantize<int16_t>(static_cast<float>(sum), outputScale, 0);
+        }
+    }
+
+    std::unique_ptr<ITensorHandle> inputHandle  = workloadFactory.CreateTensorHandle(inputInfo);
+    std::unique_ptr<ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputInfo);
+
+    FullyConnectedQueueDescriptor data;
+    WorkloadInfo info;
+    ScopedCpuTensorHandle weightsTensor(weightsInfo);
+    ScopedCpuTensorHandle biasTensor(biasInfo);
+
+    AllocateAndCopyDataToITensorHandle(&weightsTensor, weightsData.data());
+    AllocateAndCopyDataToITensorHandle(&biasTensor, biasData.data());
+
+    AddInputToWorkload(data, info, inputInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputInfo, outputHandle.get());
+    data.m_Weight = &weightsTensor;
+    data.m_Bias = &biasTensor;
+    data.m_Parameters.m_BiasEnabled = true;
+    data.m_Parameters.m_TransposeWeightMatrix = transposeWeights;
+    data.m_FusedActivation = fusedActivation;
+
+    std::unique_ptr<IWorkload> workload = workloadFactory.CreateFullyConnected(data, info);
+
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+    CopyDataToITensorHandle(inputHandle.get(), inputData.data());
+
+    ExecuteWorkload(*workload, memoryManager);
+
+    LayerTestResult<int16_t, 2> result(outputInfo);
+    CopyDataFromITensorHandle(&result.output[0][0], outputHandle.get());
+    result.outputExpected = MakeTensor<int16_t, 2>(outputInfo, expectedOutputData);
+
+    // The expected output is exact, so it is checked bit for bit rather than within the tolerance of one
+    // quantization step CompareTensors allows.
+    BOOST_TEST((result.output == result.outputExpected));
+    return result;
+}
+
+} // anonymous namespace
+
+LayerTestResult<int16_t, 2> FullyConnectedQSymm16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    armnn::DataType weightsType,
+    bool transposeWeights)
+{
+    const float weightsScale = weightsType == armnn::DataType::QuantisedAsymm8 ? 1.0f / 64.0f :
+                               weightsType == armnn::DataType::QuantisedSymm8PerAxis ? 1.0f / 16.0f :
+                                                                                        1.0f / 1024.0f;
+    return FullyConnectedQSymm16TestImpl(workloadFactory, memoryManager, weightsType, transposeWeights,
+                                         1.0f / 256.0f, 1000, weightsScale, 800, 1.0f / 64.0f, armnn::EmptyOptional());
+}
+
+LayerTestResult<int16_t, 2> FullyConnectedQSymm16LargeWeightsTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
+{
+    return FullyConnectedQSymm16TestImpl(workloadFactory, memoryManager, armnn::DataType::QuantisedSymm16, false,
+                                         1.0f / 16.0f, 32, 1.0f / 4096.0f, 16000, 1.0f / 64.0f, armnn::EmptyOptional());
+}
+
+LayerTestResult<int16_t, 2> FullyConnectedQSymm16FusedActivationTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    armnn::ActivationFunction function)
+{
+    armnn::ActivationDescriptor activation;
+    activation.m_Function = function;
+    activation.m_A = 20.0f;
+    activation.m_B = -10.0f;
+
+    // The sigmoid needs a finer output scale, its outputs being within [0, 1].
+    const float outputScale = function == armnn::ActivationFunction::Sigmoid ? 1.0f / 4096.0f : 1.0f / 64.0f;
+    return FullyConnectedQSymm16TestImpl(workloadFactory, memoryManager, armnn::DataType::QuantisedSymm8PerAxis,
+                                         false, 1.0f / 256.0f, 1000, 1.0f / 16.0f, 0, outputScale, activation);
+}
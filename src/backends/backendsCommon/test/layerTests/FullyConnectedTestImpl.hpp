@@ -28,3 +28,36 @@ LayerTestResult<float, 2> FullyConnectedLargeTest(
     armnn::IWorkloadFactory& workloadFactory,
     const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
     bool transposeWeights);
+
+/// Fully connected layer with QuantisedAsymm8 activations and weights with a scale per output.
+LayerTestResult<uint8_t, 2> FullyConnectedPerAxisQuantTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    bool transposeWeights);
+
+/// Fully connected layer with pruned weights, of which only a fraction (density) of the blocks of four consecutive
+/// weights of each output are not zero.
+LayerTestResult<float, 2> FullyConnectedSparseWeightsTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    float density,
+    bool transposeWeights);
+
+/// Fully connected layer with random QuantisedSymm16 activations and QuantisedAsymm8, QuantisedSymm8PerAxis or
+/// QuantisedSymm16 weights, with power-of-two scales so that the expected output is exact.
+LayerTestResult<int16_t, 2> FullyConnectedQSymm16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    armnn::DataType weightsType,
+    bool transposeWeights);
+
+/// As FullyConnectedQSymm16Test, with QuantisedSymm16 weights adding up to more than 2^16 in magnitude.
+LayerTestResult<int16_t, 2> FullyConnectedQSymm16LargeWeightsTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager);
+
+/// As FullyConnectedQSymm16Test, with a ReLu, BoundedReLu or Sigmoid activation fused into the layer.
+LayerTestResult<int16_t, 2> FullyConnectedQSymm16FusedActivationTest(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+    armnn::ActivationFunction function);
@@ -400,3 +400,17 @@ LayerTestResult<int16_t, 4> MaximumBroadcast1DVectorInt16Test(
         shape0,
         output);
 }
+
+LayerTestResult<int16_t, 4> MaximumRescaleInt16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
+{
+    return ElementwiseQSymm16TestHelper<armnn::MaximumQueueDescriptor>(
+        workloadFactory,
+        memoryManager,
+        [](double x0, double x1) { return std::max(x0, x1); },
+        1.0f / 256.0f,
+        1.0f / 64.0f,
+        1.0f / 128.0f,
+        32767);
+}
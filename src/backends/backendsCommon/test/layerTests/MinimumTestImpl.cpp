@@ -299,3 +299,17 @@ LayerTestResult<int16_t, 4> MinimumBroadcast1DVectorInt16Test(
         shape0,
         output);
 }
+
+LayerTestResult<int16_t, 4> MinimumRescaleInt16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
+{
+    return ElementwiseQSymm16TestHelper<armnn::MinimumQueueDescriptor>(
+        workloadFactory,
+        memoryManager,
+        [](double x0, double x1) { return std::min(x0, x1); },
+        1.0f / 256.0f,
+        1.0f / 64.0f,
+        1.0f / 128.0f,
+        32767);
+}
@@ -396,6 +396,14 @@ LayerTestResult<int16_t, 4> MultiplicationBroadcast1DVectorInt16Test(
         output);
 }
 
+LayerTestResult<int16_t, 4> MultiplicationRescaleInt16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
+{
+    return ElementwiseQSymm16TestHelper<armnn::MultiplicationQueueDescriptor>(
+        workloadFactory, memoryManager, std::multiplies<double>(), 1.0f / 128.0f, 1.0f / 128.0f, 1.0f / 8.0f, 4000);
+}
+
 LayerTestResult<float,4> CompareMultiplicationTest(
     armnn::IWorkloadFactory& workloadFactory,
     const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
@@ -18,6 +18,8 @@
 #include <test/TensorHelpers.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <random>
 
 namespace
 {
@@ -689,6 +691,92 @@ LayerTestResult<int16_t,4> Simple4dSoftmaxUint16Test(
                                                                      data.inputShape, data.outputData, data.inputData);
 }
 
+LayerTestResult<int16_t,3> SoftmaxRescaleUint16Test(
+        armnn::IWorkloadFactory& workloadFactory,
+        const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
+        int axis)
+{
+    const armnn::TensorShape shape({ 2, 9, 5 });
+    const float inputScale  = 1.0f / 1024.0f;
+    const float outputScale = 1.0f / 32768.0f;
+    const float beta        = 1.5f;
+
+    armnn::TensorInfo inputTensorInfo(shape, armnn::DataType::QuantisedSymm16, inputScale, 0);
+    armnn::TensorInfo outputTensorInfo(shape, armnn::DataType::QuantisedSymm16, outputScale, 0);
+
+    std::mt19937 generator(1415);
+    std::vector<int16_t> inputData(shape.GetNumElements());
+    std::generate(inputData.begin(), inputData.end(), [&]()
+    {
+        return static_cast<int16_t>(std::uniform_int_distribution<int>(-4000, 4000)(generator));
+    });
+
+    // The float implementation approximates the exponential, so the expected values are computed in double.
+    const unsigned int innerSize = axis == 1 ? shape[2] : 1;
+    const unsigned int axisSize  = axis == 1 ? shape[1] : shape[2];
+    std::vector<int16_t> expectedOutput(shape.GetNumElements());
+    for (unsigned int outer = 0; outer < shape.GetNumElements() / (axisSize * innerSize); ++outer)
+    {
+        for (unsigned int inner = 0; inner < innerSize; ++inner)
+        {
+            const unsigned int first = outer * axisSize * innerSize + inner;
+
+            int maxValue = inputData[first];
+            for (unsigned int i = 0; i < axisSize; ++i)
+            {
+                maxValue = std::max<int>(maxValue, inputData[first + i * innerSize]);
+            }
+
+            const auto getExp = [&](unsigned int i)
+            {
+                const int difference = inputData[first + i * innerSize] - maxValue;
+                return std::exp(static_cast<double>(beta) * inputScale * difference);
+            };
+
+            double sum = 0.0;
+            for (unsigned int i = 0; i < axisSize; ++i)
+            {
+                sum += getExp(i);
+            }
+            for (unsigned int i = 0; i < axisSize; ++i)
+            {
+                expectedOutput[first + i * innerSize] =
+                    static_cast<int16_t>(std::min(std::round(getExp(i) / sum / outputScale), 32767.0));
+            }
+        }
+    }
+
+    LayerTestResult<int16_t, 3> ret(outputTensorInfo);
+
+    std::unique_ptr<armnn::ITensorHandle> inputHandle = workloadFactory.CreateTensorHandle(inputTensorInfo);
+    std::unique_ptr<armnn::ITensorHandle> outputHandle = workloadFactory.CreateTensorHandle(outputTensorInfo);
+
+    armnn::SoftmaxQueueDescriptor data;
+    data.m_Parameters.m_Beta = beta;
+    data.m_Parameters.m_Axis = axis;
+
+    armnn::WorkloadInfo info;
+    AddInputToWorkload(data, info, inputTensorInfo, inputHandle.get());
+    AddOutputToWorkload(data, info, outputTensorInfo, outputHandle.get());
+
+    std::unique_ptr<armnn::IWorkload> workload = workloadFactory.CreateSoftmax(data, info);
+
+    inputHandle->Allocate();
+    outputHandle->Allocate();
+    CopyDataToITensorHandle(inputHandle.get(), inputData.data());
+
+    BOOST_ASSERT(workload);
+
+    ExecuteWorkload(*workload, memoryManager);
+
+    // The integer kernel uses fixed-point exponentials, so unlike the other QuantisedSymm16 kernel tests its output
+    // is only checked within the tolerance of CompareTensors.
+    CopyDataFromITensorHandle(ret.output.origin(), outputHandle.get());
+    ret.outputExpected = MakeTensor<int16_t, 3>(outputTensorInfo, expectedOutput);
+
+    return ret;
+}
+
 LayerTestResult<float,2> CompareSoftmaxTest(
     armnn::IWorkloadFactory& workloadFactory,
     const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager,
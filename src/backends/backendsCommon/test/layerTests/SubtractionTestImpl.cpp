@@ -324,3 +324,11 @@ LayerTestResult<int16_t, 4> SubtractionBroadcastInt16Test(
         shape0,
         output);
 }
+
+LayerTestResult<int16_t, 4> SubtractionRescaleInt16Test(
+    armnn::IWorkloadFactory& workloadFactory,
+    const armnn::IBackendInternal::IMemoryManagerSharedPtr& memoryManager)
+{
+    return ElementwiseQSymm16TestHelper<armnn::SubtractionQueueDescriptor>(
+        workloadFactory, memoryManager, std::minus<double>(), 1.0f / 64.0f, 1.0f / 256.0f, 1.0f / 32.0f, 32767);
+}
@@ -8,6 +8,7 @@
 #include "RefWorkloadFactory.hpp"
 #include "RefLayerSupport.hpp"
 #include "RefTensorHandleFactory.hpp"
+#include "workloads/ThreadPool.hpp"
 
 #include <backendsCommon/IBackendContext.hpp>
 #include <backendsCommon/IMemoryManager.hpp>
@@ -43,8 +44,13 @@ IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
     return std::make_unique<RefWorkloadFactory>(boost::polymorphic_pointer_downcast<RefMemoryManager>(memoryManager));
 }
 
-IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRuntime::CreationOptions&) const
+IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(
+    const IRuntime::CreationOptions& options) const
 {
+    if (options.m_CpuRefNumThreads.has_value())
+    {
+        ThreadPool::GetInstance().SetNumThreads(options.m_CpuRefNumThreads.value());
+    }
     return IBackendContextPtr{};
 }
 
@@ -73,6 +79,31 @@ OptimizationViews RefBackend::OptimizeSubgraphView(const SubgraphView& subgraph)
     return optimizationViews;
 }
 
+bool RefBackend::SupportsFusedActivation(LayerType layerType, const ActivationDescriptor& activation) const
+{
+    switch (layerType)
+    {
+        case LayerType::Addition:
+        case LayerType::Convolution2d:
+        case LayerType::DepthwiseConvolution2d:
+        case LayerType::FullyConnected:
+            break;
+        default:
+            return false;
+    }
+
+    switch (activation.m_Function)
+    {
+        case ActivationFunction::ReLu:
+        case ActivationFunction::BoundedReLu:
+        case ActivationFunction::Sigmoid:
+        case ActivationFunction::TanH:
+            return true;
+        default:
+            return false;
+    }
+}
+
 std::vector<ITensorHandleFactory::FactoryId> RefBackend::GetHandleFactoryPreferences() const
 {
     return std::vector<ITensorHandleFactory::FactoryId> { RefTensorHandleFactory::GetIdStatic() };
@@ -354,6 +354,21 @@ bool RefLayerSupport::IsConstantSupported(const TensorInfo& output,
                                   "Reference constant: output is not a supported type.");
 }
 
+bool RefLayerSupport::IsConvertBf16ToFp32Supported(const TensorInfo& input,
+                                                   const TensorInfo& output,
+                                                   Optional<std::string&> reasonIfUnsupported) const
+{
+    bool supported = true;
+
+    supported &= CheckSupportRule(TypeIs(input, DataType::BFloat16), reasonIfUnsupported,
+                                  "Reference ConvertBf16ToFp32: input type not supported.");
+
+    supported &= CheckSupportRule(TypeIs(output, DataType::Float32), reasonIfUnsupported,
+                                  "Reference ConvertBf16ToFp32: output type not supported.");
+
+    return supported;
+}
+
 bool RefLayerSupport::IsConvertFp16ToFp32Supported(const TensorInfo& input,
                                                    const TensorInfo& output,
                                                    Optional<std::string&> reasonIfUnsupported) const
@@ -374,6 +389,21 @@ bool RefLayerSupport::IsConvertFp16ToFp32Supported(const TensorInfo& input,
                                           &FalseFuncU8<>));
 }
 
+bool RefLayerSupport::IsConvertFp32ToBf16Supported(const TensorInfo& input,
+                                                   const TensorInfo& output,
+                                                   Optional<std::string&> reasonIfUnsupported) const
+{
+    bool supported = true;
+
+    supported &= CheckSupportRule(TypeIs(input, DataType::Float32), reasonIfUnsupported,
+                                  "Reference ConvertFp32ToBf16: input type not supported.");
+
+    supported &= CheckSupportRule(TypeIs(output, DataType::BFloat16), reasonIfUnsupported,
+                                  "Reference ConvertFp32ToBf16: output type not supported.");
+
+    return supported;
+}
+
 bool RefLayerSupport::IsConvertFp32ToFp16Supported(const TensorInfo& input,
                                                    const TensorInfo& output,
                                                    Optional<std::string&> reasonIfUnsupported) const
@@ -404,7 +434,8 @@ bool RefLayerSupport::IsConvolution2dSupported(const TensorInfo& input,
     bool supported = true;
 
     // Define supported types.
-    std::array<DataType,4> supportedTypes = {
+    std::array<DataType,5> supportedTypes = {
+            DataType::BFloat16,
             DataType::Float32,
             DataType::Float16,
             DataType::QuantisedAsymm8,
@@ -417,14 +448,45 @@ bool RefLayerSupport::IsConvolution2dSupported(const TensorInfo& input,
     supported &= CheckSupportRule(TypeAnyOf(output, supportedTypes), reasonIfUnsupported,
                                   "Reference convolution2d: output is not a supported type.");
 
-    supported &= CheckSupportRule(TypeAnyOf(weights, supportedTypes), reasonIfUnsupported,
-                                  "Reference convolution2d: weights is not a supported type.");
+    // BFloat16 inputs are accumulated in Float32, which can be stored as it is.
+    if (input.GetDataType() != DataType::BFloat16 || output.GetDataType() != DataType::Float32)
+    {
+        supported &= CheckSupportRule(TypesAreEqual(input, output), reasonIfUnsupported,
+                                      "Reference convolution2d: input and output types mismatched.");
+    }
 
-    supported &= CheckSupportRule(TypesAreEqual(input, output), reasonIfUnsupported,
-                                  "Reference convolution2d: input and output types mismatched.");
+    if (input.GetDataType() == DataType::QuantisedAsymm8)
+    {
+        std::array<DataType, 2> supportedWeightTypes =
+        {
+            DataType::QuantisedAsymm8,
+            DataType::QuantisedSymm8PerAxis
+        };
 
-    supported &= CheckSupportRule(TypesAreEqual(input, weights), reasonIfUnsupported,
-                                  "Reference convolution2d: input and weights types mismatched.");
+        supported &= CheckSupportRule(TypeAnyOf(weights, supportedWeightTypes), reasonIfUnsupported,
+                                      "Reference convolution2d: weights type not supported for quantized input.");
+    }
+    else if (input.GetDataType() == DataType::QuantisedSymm16)
+    {
+        // 16-bit activations are commonly paired with 8-bit weights
+        std::array<DataType, 3> supportedWeightTypes =
+        {
+            DataType::QuantisedSymm16,
+            DataType::QuantisedAsymm8,
+            DataType::QuantisedSymm8PerAxis
+        };
+
+        supported &= CheckSupportRule(TypeAnyOf(weights, supportedWeightTypes), reasonIfUnsupported,
+                                      "Reference convolution2d: weights type not supported for quantized input.");
+    }
+    else
+    {
+        supported &= CheckSupportRule(TypeAnyOf(weights, supportedTypes), reasonIfUnsupported,
+                                      "Reference convolution2d: weights is not a supported type.");
+
+        supported &= CheckSupportRule(TypesAreEqual(input, weights), reasonIfUnsupported,
+                                      "Reference convolution2d: input and weights types mismatched.");
+    }
 
     if (biases.has_value())
     {
@@ -518,14 +580,29 @@ bool RefLayerSupport::IsDepthwiseConvolutionSupported(const TensorInfo& input,
     supported &= CheckSupportRule(TypeAnyOf(output, supportedTypes), reasonIfUnsupported,
                                   "Reference DepthwiseConvolution2d: output is not a supported type.");
 
-    supported &= CheckSupportRule(TypeAnyOf(weights, supportedTypes), reasonIfUnsupported,
-                                  "Reference DepthwiseConvolution2d: weights is not a supported type.");
-
     supported &= CheckSupportRule(TypesAreEqual(input, output), reasonIfUnsupported,
                                   "Reference DepthwiseConvolution2d: input and output types mismatched.");
 
-    supported &= CheckSupportRule(TypesAreEqual(input, weights), reasonIfUnsupported,
-                                  "Reference DepthwiseConvolution2d: input and weights types mismatched.");
+    if (input.GetDataType() == DataType::QuantisedAsymm8)
+    {
+        std::array<DataType, 2> supportedWeightTypes =
+        {
+            DataType::QuantisedAsymm8,
+            DataType::QuantisedSymm8PerAxis
+        };
+
+        supported &= CheckSupportRule(TypeAnyOf(weights, supportedWeightTypes), reasonIfUnsupported,
+                                      "Reference DepthwiseConvolution2d: weights type not supported for "
+                                      "quantized input.");
+    }
+    else
+    {
+        supported &= CheckSupportRule(TypeAnyOf(weights, supportedTypes), reasonIfUnsupported,
+                                      "Reference DepthwiseConvolution2d: weights is not a supported type.");
+
+        supported &= CheckSupportRule(TypesAreEqual(input, weights), reasonIfUnsupported,
+                                      "Reference DepthwiseConvolution2d: input and weights types mismatched.");
+    }
 
     if (biases.has_value())
     {
@@ -720,8 +797,9 @@ bool RefLayerSupport::IsFullyConnectedSupported(const TensorInfo& input,
     bool supported = true;
 
     // Define supported types.
-    std::array<DataType,4> supportedTypes =
+    std::array<DataType,5> supportedTypes =
     {
+            DataType::BFloat16,
             DataType::Float32,
             DataType::Float16,
             DataType::QuantisedAsymm8,
@@ -734,14 +812,45 @@ bool RefLayerSupport::IsFullyConnectedSupported(const TensorInfo& input,
     supported &= CheckSupportRule(TypeAnyOf(output, supportedTypes), reasonIfUnsupported,
                                   "Reference Fully Connected: output type not supported.");
 
-    supported &= CheckSupportRule(TypesAreEqual(input, output), reasonIfUnsupported,
-                                  "Reference Fully Connected: input and output types mismatched.");
+    // BFloat16 inputs are accumulated in Float32, which can be stored as it is.
+    if (input.GetDataType() != DataType::BFloat16 || output.GetDataType() != DataType::Float32)
+    {
+        supported &= CheckSupportRule(TypesAreEqual(input, output), reasonIfUnsupported,
+                                      "Reference Fully Connected: input and output types mismatched.");
+    }
 
-    supported &= CheckSupportRule(TypeAnyOf(weights, supportedTypes), reasonIfUnsupported,
-                                  "Reference Fully Connected: weights type not supported.");
+    if (input.GetDataType() == DataType::QuantisedAsymm8)
+    {
+        std::array<DataType, 2> supportedWeightTypes =
+        {
+            DataType::QuantisedAsymm8,
+            DataType::QuantisedSymm8PerAxis
+        };
 
-    supported &= CheckSupportRule(TypesAreEqual(input, weights), reasonIfUnsupported,
-                                  "Reference Fully Connected: input and weight types mismatched.");
+        supported &= CheckSupportRule(TypeAnyOf(weights, supportedWeightTypes), reasonIfUnsupported,
+                                      "Reference Fully Connected: weights type not supported for quantized input.");
+    }
+    else if (input.GetDataType() == DataType::QuantisedSymm16)
+    {
+        // 16-bit activations are commonly paired with 8-bit weights
+        std::array<DataType, 3> supportedWeightTypes =
+        {
+            DataType::QuantisedSymm16,
+            DataType::QuantisedAsymm8,
+            DataType::QuantisedSymm8PerAxis
+        };
+
+        supported &= CheckSupportRule(TypeAnyOf(weights, supportedWeightTypes), reasonIfUnsupported,
+                                      "Reference Fully Connected: weights type not supported for quantized input.");
+    }
+    else
+    {
+        supported &= CheckSupportRule(TypeAnyOf(weights, supportedTypes), reasonIfUnsupported,
+                                      "Reference Fully Connected: weights type not supported.");
+
+        supported &= CheckSupportRule(TypesAreEqual(input, weights), reasonIfUnsupported,
+                                      "Reference Fully Connected: input and weight types mismatched.");
+    }
 
     if (descriptor.m_BiasEnabled)
     {
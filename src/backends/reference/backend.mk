@@ -26,6 +26,7 @@ BACKEND_SOURCES := \
         workloads/ArgMinMax.cpp \
         workloads/BatchNormImpl.cpp \
         workloads/BatchToSpaceNd.cpp \
+        workloads/BlockCsrMatrix.cpp \
         workloads/Broadcast.cpp \
         workloads/ConvImpl.cpp \
         workloads/Debug.cpp \
@@ -34,6 +35,7 @@ BACKEND_SOURCES := \
         workloads/ElementwiseFunction.cpp \
         workloads/FullyConnected.cpp \
         workloads/Gather.cpp \
+        workloads/Gemm.cpp \
         workloads/InstanceNorm.cpp \
         workloads/LstmUtils.cpp \
         workloads/Mean.cpp \
@@ -41,6 +43,8 @@ BACKEND_SOURCES := \
         workloads/Pad.cpp \
         workloads/Pooling2d.cpp \
         workloads/PreluImpl.cpp \
+        workloads/QSymm16Kernels.cpp \
+        workloads/Reduce.cpp \
         workloads/RefAbsWorkload.cpp \
         workloads/RefActivationWorkload.cpp \
         workloads/RefArgMinMaxWorkload.cpp \
@@ -48,7 +52,9 @@ BACKEND_SOURCES := \
         workloads/RefBatchToSpaceNdWorkload.cpp \
         workloads/RefConcatWorkload.cpp \
         workloads/RefConstantWorkload.cpp \
+        workloads/RefConvertBf16ToFp32Workload.cpp \
         workloads/RefConvertFp16ToFp32Workload.cpp \
+        workloads/RefConvertFp32ToBf16Workload.cpp \
         workloads/RefConvertFp32ToFp16Workload.cpp \
         workloads/RefConvolution2dWorkload.cpp \
         workloads/RefDebugWorkload.cpp \
@@ -93,7 +99,9 @@ BACKEND_SOURCES := \
         workloads/StringMapping.cpp \
         workloads/Softmax.cpp \
         workloads/Splitter.cpp \
-        workloads/TransposeConvolution2d.cpp
+        workloads/ThreadPool.cpp \
+        workloads/TransposeConvolution2d.cpp \
+        workloads/ViewCopy.cpp
 else
 
 # ARMNN_REF_ENABLED == 0
@@ -122,7 +130,10 @@ BACKEND_TEST_SOURCES := \
         test/RefLayerTests.cpp \
         test/RefMemoryManagerTests.cpp \
         test/RefOptimizedNetworkTests.cpp \
-        test/RefRuntimeTests.cpp
+        test/RefReduceTests.cpp \
+        test/RefRuntimeTests.cpp \
+        test/RefSoftmaxTests.cpp \
+        test/RefThreadPoolTests.cpp
 else
 
 # ARMNN_REF_ENABLED == 0
@@ -69,6 +69,24 @@ BOOST_AUTO_TEST_CASE(NmsFunction)
     BOOST_TEST(result[2] == 5);
 }
 
+BOOST_AUTO_TEST_CASE(NmsSuppressedBoxStillSuppresses)
+{
+    // Box 1 overlaps box 0 and box 2 overlaps box 1 only: box 1 is suppressed, and still suppresses box 2.
+    std::vector<float> boxCorners({
+        0.0f, 0.0f, 1.0f, 1.0f,
+        0.0f, 0.3f, 1.0f, 1.3f,
+        0.0f, 0.6f, 1.0f, 1.6f
+    });
+
+    std::vector<float> scores({ 0.9f, 0.8f, 0.7f });
+
+    std::vector<unsigned int> result =
+        armnn::NonMaxSuppression(3, boxCorners, scores, 0.0, 3, 0.5);
+
+    BOOST_TEST(result.size() == 1);
+    BOOST_TEST(result[0] == 0);
+}
+
 void DetectionPostProcessTestImpl(bool useRegularNms,
                                   const std::vector<float>& expectedDetectionBoxes,
                                   const std::vector<float>& expectedDetectionClasses,
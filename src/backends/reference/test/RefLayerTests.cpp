@@ -38,6 +38,30 @@ ARMNN_AUTO_TEST_CASE(UnbiasedConvolutionUint8Nhwc, SimpleConvolution2d3x5Uint8Te
 
 ARMNN_AUTO_TEST_CASE(SimpleConvolution1d, Convolution1dTest, true)
 ARMNN_AUTO_TEST_CASE(SimpleConvolution1dUint8, Convolution1dUint8Test, true)
+ARMNN_AUTO_TEST_CASE(Convolution2dPerAxisQuant, Convolution2dPerAxisQuantTest)
+
+// Pruned filters: below g_SparseWeightsDensityThreshold they are multiplied in block-CSR form
+ARMNN_AUTO_TEST_CASE(Convolution2dSparseWeights10Percent, Convolution2dSparseWeightsTest, 0.1f, armnn::DataLayout::NCHW)
+ARMNN_AUTO_TEST_CASE(Convolution2dSparseWeights30Percent, Convolution2dSparseWeightsTest, 0.3f, armnn::DataLayout::NCHW)
+ARMNN_AUTO_TEST_CASE(Convolution2dSparseWeights80Percent, Convolution2dSparseWeightsTest, 0.8f, armnn::DataLayout::NCHW)
+ARMNN_AUTO_TEST_CASE(Convolution2dSparseWeights10PercentNhwc,
+                     Convolution2dSparseWeightsTest, 0.1f, armnn::DataLayout::NHWC)
+ARMNN_AUTO_TEST_CASE(Convolution2dSparseWeights30PercentNhwc,
+                     Convolution2dSparseWeightsTest, 0.3f, armnn::DataLayout::NHWC)
+
+// QuantisedSymm16 activations with 8-bit or 16-bit filters, run on the integer kernels
+ARMNN_AUTO_TEST_CASE(Convolution2dRescaleQSymm16Uint8Weights,
+                     Convolution2dQSymm16Test, DataType::QuantisedAsymm8, DataLayout::NCHW)
+ARMNN_AUTO_TEST_CASE(Convolution2dRescaleQSymm16PerAxisWeights,
+                     Convolution2dQSymm16Test, DataType::QuantisedSymm8PerAxis, DataLayout::NCHW)
+ARMNN_AUTO_TEST_CASE(Convolution2dRescaleQSymm16QSymm16Weights,
+                     Convolution2dQSymm16Test, DataType::QuantisedSymm16, DataLayout::NCHW)
+ARMNN_AUTO_TEST_CASE(Convolution2dRescaleQSymm16Uint8WeightsNhwc,
+                     Convolution2dQSymm16Test, DataType::QuantisedAsymm8, DataLayout::NHWC)
+ARMNN_AUTO_TEST_CASE(Convolution2dRescaleQSymm16PerAxisWeightsNhwc,
+                     Convolution2dQSymm16Test, DataType::QuantisedSymm8PerAxis, DataLayout::NHWC)
+ARMNN_AUTO_TEST_CASE(Convolution2dRescaleQSymm16QSymm16WeightsNhwc,
+                     Convolution2dQSymm16Test, DataType::QuantisedSymm16, DataLayout::NHWC)
 
 ARMNN_AUTO_TEST_CASE(SimpleConvolution2d3x3, SimpleConvolution2d3x3Test, true, DataLayout::NCHW)
 ARMNN_AUTO_TEST_CASE(SimpleConvolution2d3x3Uint8, SimpleConvolution2d3x3Uint8Test, true, DataLayout::NCHW)
@@ -156,6 +180,7 @@ ARMNN_AUTO_TEST_CASE(UnbiasedDepthwiseConvolution2dUint8,
                      false,
                      DataLayout::NCHW)
 ARMNN_AUTO_TEST_CASE(DepthwiseConvolution2dQSymm16, DepthwiseConvolution2dInt16Test, true, DataLayout::NCHW)
+ARMNN_AUTO_TEST_CASE(DepthwiseConvolution2dPerAxisQuant, DepthwiseConvolution2dPerAxisQuantTest)
 
 // NHWC Depthwise Convolution
 ARMNN_AUTO_TEST_CASE(DepthwiseConvolution2dNhwc, DepthwiseConvolution2dTest, true, DataLayout::NHWC)
@@ -382,6 +407,8 @@ ARMNN_AUTO_TEST_CASE(Simple4dSoftmaxFloat16, Simple4dSoftmaxFloat16Test, 1.0f)
 ARMNN_AUTO_TEST_CASE(SimpleSoftmaxUint16, SimpleSoftmaxUint16Test, 1.0f)
 ARMNN_AUTO_TEST_CASE(Simple3dSoftmaxUint16, Simple3dSoftmaxUint16Test, 1.0f)
 ARMNN_AUTO_TEST_CASE(Simple4dSoftmaxUint16, Simple4dSoftmaxUint16Test, 1.0f)
+ARMNN_AUTO_TEST_CASE(SoftmaxRescaleUint16, SoftmaxRescaleUint16Test, -1)
+ARMNN_AUTO_TEST_CASE(SoftmaxRescaleAxis1Uint16, SoftmaxRescaleUint16Test, 1)
 
 ARMNN_AUTO_TEST_CASE(Simple2dAxis0Softmax, SimpleAxisSoftmaxTest, 1.0f, 0)
 ARMNN_AUTO_TEST_CASE(Simple2dAxis1Softmax, SimpleAxisSoftmaxTest, 1.0f, 1)
@@ -456,6 +483,17 @@ ARMNN_AUTO_TEST_CASE(Tanh, TanhTest)
 ARMNN_AUTO_TEST_CASE(TanhUint8, TanhUint8Test)
 ARMNN_AUTO_TEST_CASE(TanhInt16, TanhInt16Test)
 
+// Activations of QuantisedSymm16 inputs spanning the whole int16 range, with a different output scale
+ARMNN_AUTO_TEST_CASE(SigmoidRescaleInt16, ActivationRescaleInt16Test, ActivationFunction::Sigmoid)
+ARMNN_AUTO_TEST_CASE(TanhRescaleInt16, ActivationRescaleInt16Test, ActivationFunction::TanH)
+ARMNN_AUTO_TEST_CASE(LinearRescaleInt16, ActivationRescaleInt16Test, ActivationFunction::Linear)
+ARMNN_AUTO_TEST_CASE(ReLuRescaleInt16, ActivationRescaleInt16Test, ActivationFunction::ReLu)
+ARMNN_AUTO_TEST_CASE(BoundedReLuRescaleInt16, ActivationRescaleInt16Test, ActivationFunction::BoundedReLu)
+ARMNN_AUTO_TEST_CASE(SoftReLuRescaleInt16, ActivationRescaleInt16Test, ActivationFunction::SoftReLu)
+ARMNN_AUTO_TEST_CASE(LeakyReLuRescaleInt16, ActivationRescaleInt16Test, ActivationFunction::LeakyReLu)
+ARMNN_AUTO_TEST_CASE(AbsRescaleInt16, ActivationRescaleInt16Test, ActivationFunction::Abs)
+ARMNN_AUTO_TEST_CASE(SquareRescaleInt16, ActivationRescaleInt16Test, ActivationFunction::Square)
+
 
 // Fully Connected
 ARMNN_AUTO_TEST_CASE(SimpleFullyConnected, FullyConnectedFloat32Test, false, false)
@@ -468,6 +506,34 @@ ARMNN_AUTO_TEST_CASE(SimpleFullyConnectedWithTranspose, FullyConnectedFloat32Tes
 
 ARMNN_AUTO_TEST_CASE(FullyConnectedLarge, FullyConnectedLargeTest, false)
 ARMNN_AUTO_TEST_CASE(FullyConnectedLargeTransposed, FullyConnectedLargeTest, true)
+ARMNN_AUTO_TEST_CASE(FullyConnectedPerAxisQuant, FullyConnectedPerAxisQuantTest, false)
+ARMNN_AUTO_TEST_CASE(FullyConnectedPerAxisQuantTransposed, FullyConnectedPerAxisQuantTest, true)
+
+// Pruned weights: below g_SparseWeightsDensityThreshold they are multiplied in block-CSR form
+ARMNN_AUTO_TEST_CASE(FullyConnectedSparseWeights10Percent, FullyConnectedSparseWeightsTest, 0.1f, false)
+ARMNN_AUTO_TEST_CASE(FullyConnectedSparseWeights30Percent, FullyConnectedSparseWeightsTest, 0.3f, false)
+ARMNN_AUTO_TEST_CASE(FullyConnectedSparseWeights80Percent, FullyConnectedSparseWeightsTest, 0.8f, false)
+ARMNN_AUTO_TEST_CASE(FullyConnectedSparseWeights10PercentTransposed, FullyConnectedSparseWeightsTest, 0.1f, true)
+ARMNN_AUTO_TEST_CASE(FullyConnectedSparseWeights30PercentTransposed, FullyConnectedSparseWeightsTest, 0.3f, true)
+
+// QuantisedSymm16 activations with 8-bit or 16-bit weights, run on the integer kernels
+ARMNN_AUTO_TEST_CASE(FullyConnectedRescaleQSymm16Uint8Weights,
+                     FullyConnectedQSymm16Test, DataType::QuantisedAsymm8, false)
+ARMNN_AUTO_TEST_CASE(FullyConnectedRescaleQSymm16Uint8WeightsTransposed,
+                     FullyConnectedQSymm16Test, DataType::QuantisedAsymm8, true)
+ARMNN_AUTO_TEST_CASE(FullyConnectedRescaleQSymm16PerAxisWeights,
+                     FullyConnectedQSymm16Test, DataType::QuantisedSymm8PerAxis, false)
+ARMNN_AUTO_TEST_CASE(FullyConnectedRescaleQSymm16PerAxisWeightsTransposed,
+                     FullyConnectedQSymm16Test, DataType::QuantisedSymm8PerAxis, true)
+ARMNN_AUTO_TEST_CASE(FullyConnectedRescaleQSymm16QSymm16WeightsTransposed,
+                     FullyConnectedQSymm16Test, DataType::QuantisedSymm16, true)
+ARMNN_AUTO_TEST_CASE(FullyConnectedRescaleQSymm16LargeWeights, FullyConnectedQSymm16LargeWeightsTest)
+ARMNN_AUTO_TEST_CASE(FullyConnectedRescaleQSymm16ReLu,
+                     FullyConnectedQSymm16FusedActivationTest, ActivationFunction::ReLu)
+ARMNN_AUTO_TEST_CASE(FullyConnectedRescaleQSymm16BoundedReLu,
+                     FullyConnectedQSymm16FusedActivationTest, ActivationFunction::BoundedReLu)
+ARMNN_AUTO_TEST_CASE(FullyConnectedRescaleQSymm16Sigmoid,
+                     FullyConnectedQSymm16FusedActivationTest, ActivationFunction::Sigmoid)
 
 // Splitter
 ARMNN_AUTO_TEST_CASE(SimpleSplitterFloat32, SplitterFloat32Test)
@@ -504,6 +570,8 @@ ARMNN_AUTO_TEST_CASE(AddBroadcast1ElementUint8, AdditionBroadcast1ElementUint8Te
 ARMNN_AUTO_TEST_CASE(AdditionInt16, AdditionInt16Test)
 ARMNN_AUTO_TEST_CASE(AddBroadcastInt16, AdditionBroadcastInt16Test)
 ARMNN_AUTO_TEST_CASE(AddBroadcast1ElementInt16, AdditionBroadcast1ElementInt16Test)
+ARMNN_AUTO_TEST_CASE(AdditionRescaleInt16, AdditionRescaleInt16Test)
+ARMNN_AUTO_TEST_CASE(AdditionRescaleBoundedReLuInt16, AdditionRescaleBoundedReLuInt16Test)
 
 // Sub
 ARMNN_AUTO_TEST_CASE(SimpleSub, SubtractionTest)
@@ -521,6 +589,7 @@ ARMNN_AUTO_TEST_CASE(SubBroadcast1ElementUint8, SubtractionBroadcast1ElementUint
 ARMNN_AUTO_TEST_CASE(SubtractionInt16, SubtractionInt16Test)
 ARMNN_AUTO_TEST_CASE(SubBroadcastInt16, SubtractionBroadcastInt16Test)
 ARMNN_AUTO_TEST_CASE(SubBroadcast1ElementInt16, SubtractionBroadcast1ElementInt16Test)
+ARMNN_AUTO_TEST_CASE(SubtractionRescaleInt16, SubtractionRescaleInt16Test)
 
 // Div
 ARMNN_AUTO_TEST_CASE(SimpleDivision, DivisionTest)
@@ -577,6 +646,7 @@ ARMNN_AUTO_TEST_CASE(MaximumBroadcast1DVectorUint8, MaximumBroadcast1DVectorUint
 ARMNN_AUTO_TEST_CASE(MaximumInt16, MaximumInt16Test)
 ARMNN_AUTO_TEST_CASE(MaximumBroadcast1ElementInt16, MaximumBroadcast1ElementInt16Test)
 ARMNN_AUTO_TEST_CASE(MaximumBroadcast1DVectorInt16, MaximumBroadcast1DVectorInt16Test)
+ARMNN_AUTO_TEST_CASE(MaximumRescaleInt16, MaximumRescaleInt16Test)
 
 // Min
 ARMNN_AUTO_TEST_CASE(SimpleMinimum1, MinimumBroadcast1ElementTest1)
@@ -588,6 +658,7 @@ ARMNN_AUTO_TEST_CASE(MinimumBroadcast1DVectorFloat16, MinimumBroadcast1DVectorFl
 ARMNN_AUTO_TEST_CASE(MinimumInt16, MinimumInt16Test)
 ARMNN_AUTO_TEST_CASE(MinimumBroadcast1ElementInt16, MinimumBroadcast1ElementInt16Test)
 ARMNN_AUTO_TEST_CASE(MinimumBroadcast1DVectorInt16, MinimumBroadcast1DVectorInt16Test)
+ARMNN_AUTO_TEST_CASE(MinimumRescaleInt16, MinimumRescaleInt16Test)
 
 // Mul
 ARMNN_AUTO_TEST_CASE(SimpleMultiplication, MultiplicationTest)
@@ -599,6 +670,7 @@ ARMNN_AUTO_TEST_CASE(MultiplicationBroadcast1DVectorUint8, MultiplicationBroadca
 ARMNN_AUTO_TEST_CASE(MultiplicationInt16, MultiplicationInt16Test)
 ARMNN_AUTO_TEST_CASE(MultiplicationBroadcast1ElementInt16, MultiplicationBroadcast1ElementInt16Test)
 ARMNN_AUTO_TEST_CASE(MultiplicationBroadcast1DVectorInt16, MultiplicationBroadcast1DVectorInt16Test)
+ARMNN_AUTO_TEST_CASE(MultiplicationRescaleInt16, MultiplicationRescaleInt16Test)
 ARMNN_AUTO_TEST_CASE(Multiplication5d, Multiplication5dTest)
 
 // Batch Norm
@@ -4,14 +4,122 @@
 //
 
 #include <armnn/ArmNN.hpp>
+#include <DeviceSpec.hpp>
 #include <Graph.hpp>
 #include <Network.hpp>
 
+#include <backendsCommon/BackendRegistry.hpp>
+#include <backendsCommon/CpuTensorHandle.hpp>
+#include <reference/RefBackend.hpp>
+#include <reference/RefLayerSupport.hpp>
 #include <reference/RefWorkloadFactory.hpp>
 
 #include <boost/test/unit_test.hpp>
 #include <test/GraphUtils.hpp>
 
+namespace
+{
+
+// Reference layer support without any BFloat16 support, as on the backends lacking BFloat16 kernels
+class RefLayerSupportWithoutBf16 : public armnn::RefLayerSupport
+{
+public:
+    bool IsConvertBf16ToFp32Supported(const armnn::TensorInfo&,
+                                      const armnn::TensorInfo&,
+                                      armnn::Optional<std::string&>) const override
+    {
+        return false;
+    }
+
+    bool IsConvertFp32ToBf16Supported(const armnn::TensorInfo&,
+                                      const armnn::TensorInfo&,
+                                      armnn::Optional<std::string&>) const override
+    {
+        return false;
+    }
+
+    bool IsConvolution2dSupported(const armnn::TensorInfo& input,
+                                  const armnn::TensorInfo& output,
+                                  const armnn::Convolution2dDescriptor& descriptor,
+                                  const armnn::TensorInfo& weights,
+                                  const armnn::Optional<armnn::TensorInfo>& biases,
+                                  armnn::Optional<std::string&> reasonIfUnsupported) const override
+    {
+        return input.GetDataType() != armnn::DataType::BFloat16 &&
+               RefLayerSupport::IsConvolution2dSupported(input, output, descriptor, weights, biases,
+                                                         reasonIfUnsupported);
+    }
+};
+
+class RefBackendWithoutBf16 : public armnn::RefBackend
+{
+public:
+    static const armnn::BackendId& GetIdStatic()
+    {
+        static const armnn::BackendId s_Id{"CpuRefWithoutBf16"};
+        return s_Id;
+    }
+
+    const armnn::BackendId& GetId() const override { return GetIdStatic(); }
+
+    armnn::IBackendInternal::ILayerSupportSharedPtr GetLayerSupport() const override
+    {
+        return std::make_shared<RefLayerSupportWithoutBf16>();
+    }
+};
+
+// Registers RefBackendWithoutBf16 in place of the other backends for the lifetime of the object
+class RegisterRefBackendWithoutBf16 : public armnn::BackendRegistry
+{
+public:
+    RegisterRefBackendWithoutBf16()
+    {
+        Swap(armnn::BackendRegistryInstance(), m_TempStorage);
+        armnn::BackendRegistryInstance().Register(RefBackendWithoutBf16::GetIdStatic(), []()
+        {
+            return armnn::IBackendInternalUniquePtr(new RefBackendWithoutBf16);
+        });
+    }
+
+    ~RegisterRefBackendWithoutBf16()
+    {
+        Swap(armnn::BackendRegistryInstance(), m_TempStorage);
+    }
+
+private:
+    FactoryStorage m_TempStorage;
+};
+
+// Input 1x1x2x2 -> Convolution2d with a 1x1x2x2 kernel and a bias -> output 1x1x1x1
+armnn::INetworkPtr CreateConvolution2dWithBiasNetwork(std::vector<float> weightsData = { 1.f, 0.5f, 2.f, -1.f })
+{
+    armnn::INetworkPtr net = armnn::INetwork::Create();
+
+    armnn::ConstTensor weights(armnn::TensorInfo({ 1, 1, 2, 2 }, armnn::DataType::Float32), weightsData);
+    std::vector<float> biasData{ 0.25f };
+    armnn::ConstTensor bias(armnn::TensorInfo({ 1 }, armnn::DataType::Float32), biasData);
+
+    armnn::Convolution2dDescriptor descriptor;
+    descriptor.m_StrideX = 1;
+    descriptor.m_StrideY = 1;
+    descriptor.m_BiasEnabled = true;
+
+    auto input = net->AddInputLayer(0, "InputLayer");
+    auto convolution = net->AddConvolution2dLayer(descriptor, weights, armnn::Optional<armnn::ConstTensor>(bias),
+                                                  "Convolution2dLayer");
+    auto output = net->AddOutputLayer(0, "OutputLayer");
+
+    input->GetOutputSlot(0).Connect(convolution->GetInputSlot(0));
+    convolution->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(armnn::TensorInfo({ 1, 1, 2, 2 }, armnn::DataType::Float32));
+    convolution->GetOutputSlot(0).SetTensorInfo(armnn::TensorInfo({ 1, 1, 1, 1 }, armnn::DataType::Float32));
+
+    return net;
+}
+
+}
+
 BOOST_AUTO_TEST_SUITE(RefOptimizedNetwork)
 
 BOOST_AUTO_TEST_CASE(OptimizeValidateCpuRefWorkloads)
@@ -195,4 +303,242 @@ BOOST_AUTO_TEST_CASE(DebugTestOnCpuRef)
     BOOST_TEST(GraphHasNamedLayer(graph, "OutputLayer"));
 }
 
+BOOST_AUTO_TEST_CASE(FuseActivationOnCpuRef)
+{
+    armnn::Network net;
+
+    armnn::ActivationDescriptor activationDescriptor;
+    activationDescriptor.m_Function = armnn::ActivationFunction::BoundedReLu;
+    activationDescriptor.m_A = 10.f;
+    activationDescriptor.m_B = 0.f;
+
+    // Defines layers.
+    auto input0 = net.AddInputLayer(0, "InputLayer0");
+    auto input1 = net.AddInputLayer(1, "InputLayer1");
+    auto addition = net.AddAdditionLayer("AdditionLayer");
+    auto activation = net.AddActivationLayer(activationDescriptor, "ActivationLayer");
+    auto output = net.AddOutputLayer(0, "OutputLayer");
+
+    // Connects layers.
+    input0->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    armnn::TensorInfo info({ 4 }, armnn::DataType::Float32);
+    input0->GetOutputSlot(0).SetTensorInfo(info);
+    input1->GetOutputSlot(0).SetTensorInfo(info);
+    addition->GetOutputSlot(0).SetTensorInfo(info);
+    activation->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::BackendId> backends = {armnn::Compute::CpuRef};
+    armnn::IOptimizedNetworkPtr optimizedNet = armnn::Optimize(net, backends, runtime->GetDeviceSpec());
+
+    // Tests that the activation has been fused into the addition.
+    const armnn::Graph& graph = static_cast<armnn::OptimizedNetwork*>(optimizedNet.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 4);
+    BOOST_TEST(!GraphHasNamedLayer(graph, "ActivationLayer"));
+    for (auto&& layer : graph)
+    {
+        if (layer->GetType() == armnn::LayerType::Addition)
+        {
+            BOOST_TEST(layer->GetFusedActivation().has_value());
+        }
+    }
+
+    armnn::NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optimizedNet)) == armnn::Status::Success);
+
+    std::vector<float> input0Data{ -5.f, 3.f, 8.f,  1.f };
+    std::vector<float> input1Data{  1.f, 2.f, 7.f, -4.f };
+    std::vector<float> outputData(4);
+
+    armnn::InputTensors inputTensors
+    {
+        {0, armnn::ConstTensor(runtime->GetInputTensorInfo(netId, 0), input0Data.data())},
+        {1, armnn::ConstTensor(runtime->GetInputTensorInfo(netId, 1), input1Data.data())}
+    };
+    armnn::OutputTensors outputTensors
+    {
+        {0, armnn::Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data())}
+    };
+
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+
+    std::vector<float> expectedOutput{ 0.f, 5.f, 10.f, 0.f };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(ReduceFp32ToBf16OnCpuRef)
+{
+    armnn::Network net;
+
+    std::vector<float> weightsData{ 1.f, 0.5f, 2.f, -1.f };
+    armnn::ConstTensor weights(armnn::TensorInfo({ 2, 2 }, armnn::DataType::Float32), weightsData);
+
+    // Defines layers.
+    auto input = net.AddInputLayer(0, "InputLayer");
+    auto fullyConnected = net.AddFullyConnectedLayer(armnn::FullyConnectedDescriptor(), weights,
+                                                     armnn::EmptyOptional(), "FullyConnectedLayer");
+    auto output = net.AddOutputLayer(0, "OutputLayer");
+
+    // Connects layers.
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    armnn::TensorInfo info({ 1, 2 }, armnn::DataType::Float32);
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(info);
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::BackendId> backends = {armnn::Compute::CpuRef};
+
+    armnn::OptimizerOptions optimizerOptions;
+    optimizerOptions.m_ReduceFp32ToBf16 = true;
+
+    armnn::IOptimizedNetworkPtr optimizedNet = armnn::Optimize(net, backends, runtime->GetDeviceSpec(),
+                                                               optimizerOptions);
+
+    // Tests that only the input of the fully connected layer has been converted.
+    const armnn::Graph& graph = static_cast<armnn::OptimizedNetwork*>(optimizedNet.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 4);
+    BOOST_TEST(GraphHasNamedLayer(graph, "convert_fp32_to_bf16-0-FullyConnectedLayer"));
+
+    armnn::NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optimizedNet)) == armnn::Status::Success);
+
+    // 3.1 is rounded to 3.09375 in BFloat16, and the products are accumulated in Float32.
+    std::vector<float> inputData{ 1.f, 3.1f };
+    std::vector<float> outputData(2);
+
+    armnn::InputTensors inputTensors
+    {
+        {0, armnn::ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data())}
+    };
+    armnn::OutputTensors outputTensors
+    {
+        {0, armnn::Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data())}
+    };
+
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+
+    std::vector<float> expectedOutput{ 7.1875f, -2.59375f };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(ReduceFp32ToBf16Convolution2dWithBiasOnCpuRef)
+{
+    armnn::INetworkPtr net = CreateConvolution2dWithBiasNetwork();
+
+    armnn::IRuntime::CreationOptions options;
+    armnn::IRuntimePtr runtime(armnn::IRuntime::Create(options));
+
+    std::vector<armnn::BackendId> backends = {armnn::Compute::CpuRef};
+
+    armnn::OptimizerOptions optimizerOptions;
+    optimizerOptions.m_ReduceFp32ToBf16 = true;
+
+    armnn::IOptimizedNetworkPtr optimizedNet = armnn::Optimize(*net, backends, runtime->GetDeviceSpec(),
+                                                               optimizerOptions);
+
+    // Tests that only the input of the convolution has been converted: the bias stays in Float32.
+    const armnn::Graph& graph = static_cast<armnn::OptimizedNetwork*>(optimizedNet.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 4);
+    BOOST_TEST(GraphHasNamedLayer(graph, "convert_fp32_to_bf16-0-Convolution2dLayer"));
+
+    armnn::NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optimizedNet)) == armnn::Status::Success);
+
+    // 3.1 is rounded to 3.09375 in BFloat16, and the products and the bias are accumulated in Float32.
+    std::vector<float> inputData{ 1.f, 3.1f, 2.f, 1.f };
+    std::vector<float> outputData(1);
+
+    armnn::InputTensors inputTensors
+    {
+        {0, armnn::ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data())}
+    };
+    armnn::OutputTensors outputTensors
+    {
+        {0, armnn::Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data())}
+    };
+
+    runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+
+    std::vector<float> expectedOutput{ 5.796875f };
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(ReduceFp32ToBf16FallsBackToFp32WithoutBf16Support)
+{
+    RegisterRefBackendWithoutBf16 registerBackend;
+
+    armnn::INetworkPtr net = CreateConvolution2dWithBiasNetwork();
+
+    std::vector<armnn::BackendId> backends = {RefBackendWithoutBf16::GetIdStatic()};
+    armnn::DeviceSpec deviceSpec({RefBackendWithoutBf16::GetIdStatic()});
+
+    armnn::OptimizerOptions optimizerOptions;
+    optimizerOptions.m_ReduceFp32ToBf16 = true;
+
+    armnn::IOptimizedNetworkPtr optimizedNet = armnn::Optimize(*net, backends, deviceSpec, optimizerOptions);
+    BOOST_REQUIRE(optimizedNet);
+
+    // Tests that the convolution has been left in Float32, without any conversion layer.
+    const armnn::Graph& graph = static_cast<armnn::OptimizedNetwork*>(optimizedNet.get())->GetGraph();
+    BOOST_TEST(graph.GetNumLayers() == 3);
+    BOOST_TEST(!GraphHasNamedLayer(graph, "convert_fp32_to_bf16-0-Convolution2dLayer"));
+
+    for (auto&& layer : graph)
+    {
+        BOOST_TEST((layer->GetBackendId() == RefBackendWithoutBf16::GetIdStatic()));
+        if (layer->GetType() == armnn::LayerType::Convolution2d)
+        {
+            auto convolution = boost::polymorphic_downcast<const armnn::Convolution2dLayer*>(layer);
+            BOOST_TEST((convolution->GetDataType() == armnn::DataType::Float32));
+            BOOST_TEST((convolution->m_Weight->GetTensorInfo().GetDataType() == armnn::DataType::Float32));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ReduceFp32ToBf16FallbackKeepsFp32Weights)
+{
+    RegisterRefBackendWithoutBf16 registerBackend;
+
+    // 1 + 2^-10 and 3.1 are not representable in BFloat16, and would be rounded to 1 and 3.09375.
+    const std::vector<float> weightsData{ 1.0009765625f, 0.5f, 3.1f, -1.f };
+    armnn::INetworkPtr net = CreateConvolution2dWithBiasNetwork(weightsData);
+
+    std::vector<armnn::BackendId> backends = {RefBackendWithoutBf16::GetIdStatic()};
+    armnn::DeviceSpec deviceSpec({RefBackendWithoutBf16::GetIdStatic()});
+
+    armnn::OptimizerOptions optimizerOptions;
+    optimizerOptions.m_ReduceFp32ToBf16 = true;
+
+    armnn::IOptimizedNetworkPtr optimizedNet = armnn::Optimize(*net, backends, deviceSpec, optimizerOptions);
+    BOOST_REQUIRE(optimizedNet);
+
+    // Tests that the convolution runs with its original Float32 weights.
+    const armnn::Graph& graph = static_cast<armnn::OptimizedNetwork*>(optimizedNet.get())->GetGraph();
+    unsigned int numConvolutions = 0;
+    for (auto&& layer : graph)
+    {
+        if (layer->GetType() == armnn::LayerType::Convolution2d)
+        {
+            ++numConvolutions;
+            auto convolution = boost::polymorphic_downcast<const armnn::Convolution2dLayer*>(layer);
+            BOOST_REQUIRE((convolution->m_Weight->GetTensorInfo().GetDataType() == armnn::DataType::Float32));
+
+            const float* weights = convolution->m_Weight->GetConstTensor<float>();
+            BOOST_TEST(std::vector<float>(weights, weights + weightsData.size()) == weightsData,
+                       boost::test_tools::per_element());
+        }
+    }
+    BOOST_TEST(numConvolutions == 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
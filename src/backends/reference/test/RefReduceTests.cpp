@@ -0,0 +1,179 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/Mean.hpp>
+#include <reference/workloads/Reduce.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(RefReduce)
+using namespace armnn;
+
+namespace
+{
+
+std::vector<float> MakeValues(unsigned int numElements)
+{
+    std::vector<float> values(numElements);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        values[i] = static_cast<float>((i * 7) % 11);
+    }
+    return values;
+}
+
+std::vector<float> ReduceSum(const TensorShape& shape, const std::vector<unsigned int>& axis,
+                             const std::vector<float>& input, unsigned int numOutputs)
+{
+    std::vector<float> output(numOutputs, 0.0f);
+    Reduce(CanonicalizeReduction(shape, axis), input.data(), output.data(),
+           [](float sum, float value) { return sum + value; });
+    return output;
+}
+
+/// Sums the input along the axes set in reducedMask, one element at a time.
+std::vector<float> NaiveReduceSum(const TensorShape& shape, unsigned int reducedMask, const std::vector<float>& input)
+{
+    const unsigned int numDims = shape.GetNumDimensions();
+    unsigned int numOutputs = 1;
+    for (unsigned int d = 0; d < numDims; ++d)
+    {
+        numOutputs *= (reducedMask & (1u << d)) ? 1 : shape[d];
+    }
+
+    std::vector<float> output(numOutputs, 0.0f);
+    for (unsigned int i = 0; i < shape.GetNumElements(); ++i)
+    {
+        unsigned int remainder = i;
+        unsigned int outputIndex = 0;
+        unsigned int outputStride = 1;
+        for (unsigned int d = numDims; d-- > 0;)
+        {
+            const unsigned int index = remainder % shape[d];
+            remainder /= shape[d];
+            if (!(reducedMask & (1u << d)))
+            {
+                outputIndex += index * outputStride;
+                outputStride *= shape[d];
+            }
+        }
+        output[outputIndex] += input[i];
+    }
+    return output;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(ReduceMatchesNaiveSumForEveryAxisSubset)
+{
+    const TensorShape shape({ 2, 3, 1, 4, 5 });
+    const std::vector<float> input = MakeValues(shape.GetNumElements());
+
+    for (unsigned int mask = 0; mask < (1u << shape.GetNumDimensions()); ++mask)
+    {
+        std::vector<unsigned int> axis;
+        for (unsigned int d = 0; d < shape.GetNumDimensions(); ++d)
+        {
+            if (mask & (1u << d))
+            {
+                axis.push_back(d);
+            }
+        }
+        // An empty list of axes reduces every dimension.
+        const unsigned int reducedMask = axis.empty() ? (1u << shape.GetNumDimensions()) - 1 : mask;
+
+        const std::vector<float> expected = NaiveReduceSum(shape, reducedMask, input);
+        BOOST_TEST(ReduceSum(shape, axis, input, static_cast<unsigned int>(expected.size())) == expected,
+                   boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CanonicalizeReductionMergesAdjacentDimensions)
+{
+    // The size 1 dimension between the two reduced ones is dropped, so that they form a single group.
+    const ReductionShape shape = CanonicalizeReduction(TensorShape({ 2, 3, 1, 4, 5 }), { 1, 2, 3 });
+
+    BOOST_TEST(shape.m_OuterSizes == std::vector<unsigned int>({ 2, 12 }), boost::test_tools::per_element());
+    BOOST_TEST(shape.m_OuterOutputStrides == std::vector<unsigned int>({ 5, 0 }), boost::test_tools::per_element());
+    BOOST_TEST(shape.m_InnerSize == 5);
+    BOOST_TEST(!shape.m_InnerReduced);
+    BOOST_TEST(shape.m_NumReduced == 12);
+}
+
+BOOST_AUTO_TEST_CASE(CanonicalizeReductionIgnoresAxisOrderAndDuplicates)
+{
+    const TensorShape tensorShape({ 2, 3, 4, 5 });
+    const ReductionShape expected = CanonicalizeReduction(tensorShape, { 1, 3 });
+
+    for (const std::vector<unsigned int>& axis : { std::vector<unsigned int>({ 3, 1 }),
+                                                   std::vector<unsigned int>({ 1, 1, 3 }),
+                                                   std::vector<unsigned int>({ 3, 1, 3, 1 }) })
+    {
+        const ReductionShape shape = CanonicalizeReduction(tensorShape, axis);
+        BOOST_TEST(shape.m_OuterSizes == expected.m_OuterSizes, boost::test_tools::per_element());
+        BOOST_TEST(shape.m_OuterOutputStrides == expected.m_OuterOutputStrides, boost::test_tools::per_element());
+        BOOST_TEST(shape.m_InnerSize == expected.m_InnerSize);
+        BOOST_TEST(shape.m_InnerReduced == expected.m_InnerReduced);
+        BOOST_TEST(shape.m_NumReduced == 15);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ReduceAllDimensions)
+{
+    const TensorShape tensorShape({ 2, 3, 4 });
+    const std::vector<float> input = MakeValues(tensorShape.GetNumElements());
+
+    float expected = 0.0f;
+    for (float value : input)
+    {
+        expected += value;
+    }
+
+    // An empty list of axes reduces every dimension, like listing them all.
+    for (const std::vector<unsigned int>& axis : { std::vector<unsigned int>(),
+                                                   std::vector<unsigned int>({ 0, 1, 2 }) })
+    {
+        const ReductionShape shape = CanonicalizeReduction(tensorShape, axis);
+        BOOST_TEST(shape.m_OuterSizes.empty());
+        BOOST_TEST(shape.m_InnerSize == 24);
+        BOOST_TEST(shape.m_InnerReduced);
+        BOOST_TEST(shape.m_NumReduced == 24);
+
+        BOOST_TEST(ReduceSum(tensorShape, axis, input, 1)[0] == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MeanKeepDimsMatchesSqueezedOutput)
+{
+    // Keeping the reduced dimensions with size 1 only changes the output shape, not the layout of its values.
+    const TensorInfo inputInfo({ 2, 3, 4 }, DataType::Float32);
+    const TensorInfo keptOutputInfo({ 2, 1, 4 }, DataType::Float32);
+    const TensorInfo squeezedOutputInfo({ 2, 4 }, DataType::Float32);
+    const std::vector<unsigned int> axis = { 1 };
+
+    const std::vector<float> input = MakeValues(inputInfo.GetNumElements());
+    std::vector<float> keptOutput(keptOutputInfo.GetNumElements());
+    std::vector<float> squeezedOutput(squeezedOutputInfo.GetNumElements());
+
+    Float32Decoder keptDecoder(input.data());
+    Float32Encoder keptEncoder(keptOutput.data());
+    Mean(inputInfo, keptOutputInfo, axis, keptDecoder, keptEncoder);
+
+    Float32Decoder squeezedDecoder(input.data());
+    Float32Encoder squeezedEncoder(squeezedOutput.data());
+    Mean(inputInfo, squeezedOutputInfo, axis, squeezedDecoder, squeezedEncoder);
+
+    std::vector<float> expected = NaiveReduceSum(inputInfo.GetShape(), 1u << 1, input);
+    for (float& value : expected)
+    {
+        value /= 3.0f;
+    }
+    BOOST_TEST(keptOutput == expected, boost::test_tools::per_element());
+    BOOST_TEST(squeezedOutput == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
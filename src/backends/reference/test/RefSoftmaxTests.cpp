@@ -0,0 +1,53 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/Softmax.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(RefSoftmax)
+
+BOOST_AUTO_TEST_CASE(FastExpMatchesStdExp)
+{
+    // Sweeps the range in which e^x is a normal float, where FastExp keeps a relative error below 1e-6.
+    constexpr unsigned int numValues = 100001;
+    constexpr float minValue = -87.0f;
+    constexpr float maxValue = 88.0f;
+
+    std::vector<float> inputs(numValues);
+    for (unsigned int i = 0; i < numValues; ++i)
+    {
+        inputs[i] = minValue + (maxValue - minValue) * static_cast<float>(i) / static_cast<float>(numValues - 1);
+    }
+
+    std::vector<float> outputs(inputs);
+    armnn::FastExp(outputs.data(), numValues);
+
+    double maxRelativeError = 0.0;
+    for (unsigned int i = 0; i < numValues; ++i)
+    {
+        const double expected = std::exp(static_cast<double>(inputs[i]));
+        maxRelativeError = std::max(maxRelativeError, std::abs(outputs[i] - expected) / expected);
+    }
+    BOOST_TEST(maxRelativeError < 1e-6);
+}
+
+BOOST_AUTO_TEST_CASE(FastExpSaturates)
+{
+    std::vector<float> values = { -1000.0f, -89.0f, 0.0f, 89.0f, 1000.0f };
+    armnn::FastExp(values.data(), static_cast<unsigned int>(values.size()));
+
+    BOOST_TEST(values[0] == 0.0f);
+    BOOST_TEST(values[1] == 0.0f);
+    BOOST_TEST(values[2] == 1.0f);
+    BOOST_TEST(std::isfinite(values[3]));
+    BOOST_TEST(values[4] == values[3]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
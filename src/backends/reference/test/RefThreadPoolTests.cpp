@@ -0,0 +1,188 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#include <reference/workloads/ConvImpl.hpp>
+#include <reference/workloads/Pooling2d.hpp>
+#include <reference/workloads/ThreadPool.hpp>
+
+#include <armnn/IRuntime.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(RefThreadPoolTests)
+using namespace armnn;
+
+namespace
+{
+
+/// Sets the number of threads of the reference thread pool for the lifetime of the object.
+struct ScopedNumThreads
+{
+    ScopedNumThreads(unsigned int numThreads)
+    {
+        ThreadPool::GetInstance().SetNumThreads(numThreads);
+    }
+
+    ~ScopedNumThreads()
+    {
+        ThreadPool::GetInstance().SetNumThreads(1);
+    }
+};
+
+std::vector<float> MakeValues(unsigned int numElements)
+{
+    std::vector<float> values(numElements);
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        values[i] = static_cast<float>((i * 37) % 23) - 11.0f;
+    }
+    return values;
+}
+
+std::vector<float> RunConvolution(const std::vector<float>& input, const std::vector<float>& weights)
+{
+    const TensorShape inputShape({ 2, 3, 9, 7 });
+    const TensorShape weightsShape({ 5, 3, 3, 3 });
+    const TensorShape outputShape({ 2, 5, 7, 5 });
+
+    std::vector<float> output(outputShape.GetNumElements());
+    Float32Decoder inputDecoder(input.data());
+    Float32Decoder weightsDecoder(weights.data());
+    Float32Encoder outputEncoder(output.data());
+
+    Convolve(inputShape, inputDecoder, outputShape, outputEncoder, weightsShape, weightsDecoder,
+             false, nullptr, DataLayout::NCHW, 0, 0, 1, 1, 1, 1);
+    return output;
+}
+
+std::vector<float> RunPooling(const std::vector<float>& input)
+{
+    const TensorInfo inputInfo({ 1, 17, 13, 3 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 8, 6, 3 }, DataType::Float32);
+
+    Pooling2dDescriptor descriptor;
+    descriptor.m_PoolType   = PoolingAlgorithm::Average;
+    descriptor.m_PoolWidth  = 3;
+    descriptor.m_PoolHeight = 3;
+    descriptor.m_StrideX    = 2;
+    descriptor.m_StrideY    = 2;
+    descriptor.m_PadTop     = 1;
+    descriptor.m_PadLeft    = 1;
+    descriptor.m_DataLayout = DataLayout::NHWC;
+
+    std::vector<float> output(outputInfo.GetNumElements());
+    Float32Decoder inputDecoder(input.data());
+    Float32Encoder outputEncoder(output.data());
+
+    Pooling2d(inputDecoder, outputEncoder, inputInfo, outputInfo, descriptor);
+    return output;
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_CASE(ParallelForCoversRangeOnce)
+{
+    ScopedNumThreads numThreads(4);
+    BOOST_TEST(ThreadPool::GetInstance().GetNumThreads() == 4);
+
+    // The sub-ranges are only recorded on the worker threads, as Boost.Test assertions are not thread-safe.
+    std::mutex rangesMutex;
+    std::vector<std::pair<unsigned int, unsigned int>> ranges;
+    ParallelFor(0, 1000, [&](unsigned int begin, unsigned int end)
+    {
+        std::lock_guard<std::mutex> lock(rangesMutex);
+        ranges.emplace_back(begin, end);
+    }, 100);
+
+    BOOST_TEST(ranges.size() == 4);
+    std::vector<unsigned int> counts(1000, 0);
+    for (const auto& range : ranges)
+    {
+        BOOST_TEST(range.second - range.first >= 100);
+        for (unsigned int i = range.first; i < range.second; ++i)
+        {
+            ++counts[i];
+        }
+    }
+    for (unsigned int count : counts)
+    {
+        BOOST_TEST(count == 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeOnlyResizesPoolWhenNumThreadsIsSet)
+{
+    ScopedNumThreads numThreads(1);
+
+    IRuntime::CreationOptions options;
+    options.m_CpuRefNumThreads = 3;
+    IRuntimePtr runtime = IRuntime::Create(options);
+    BOOST_TEST(ThreadPool::GetInstance().GetNumThreads() == 3);
+
+    // A runtime with default options leaves the pool of the other runtimes alone.
+    IRuntimePtr defaultRuntime = IRuntime::Create(IRuntime::CreationOptions());
+    BOOST_TEST(ThreadPool::GetInstance().GetNumThreads() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(NestedParallelForRunsInline)
+{
+    ScopedNumThreads numThreads(3);
+
+    std::atomic<unsigned int> numInnerCalls(0);
+    std::atomic<unsigned int> numElements(0);
+    ParallelFor(0, 3, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            ParallelFor(0, 10, [&](unsigned int innerBegin, unsigned int innerEnd)
+            {
+                ++numInnerCalls;
+                numElements += innerEnd - innerBegin;
+            });
+        }
+    });
+
+    BOOST_TEST(numInnerCalls.load() == 3);
+    BOOST_TEST(numElements.load() == 30);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelForRethrowsExceptions)
+{
+    ScopedNumThreads numThreads(4);
+
+    BOOST_CHECK_THROW(ParallelFor(0, 8, [](unsigned int begin, unsigned int)
+    {
+        if (begin != 0)
+        {
+            throw std::runtime_error("task failed");
+        }
+    }), std::runtime_error);
+
+    // The pool is still usable afterwards.
+    std::atomic<unsigned int> numElements(0);
+    ParallelFor(0, 8, [&](unsigned int begin, unsigned int end) { numElements += end - begin; });
+    BOOST_TEST(numElements.load() == 8);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelKernelsMatchSingleThreaded)
+{
+    const std::vector<float> convInput   = MakeValues(2 * 3 * 9 * 7);
+    const std::vector<float> convWeights = MakeValues(5 * 3 * 3 * 3);
+    const std::vector<float> poolInput   = MakeValues(17 * 13 * 3);
+
+    const std::vector<float> expectedConvolution = RunConvolution(convInput, convWeights);
+    const std::vector<float> expectedPooling     = RunPooling(poolInput);
+
+    ScopedNumThreads numThreads(4);
+    BOOST_TEST(RunConvolution(convInput, convWeights) == expectedConvolution, boost::test_tools::per_element());
+    BOOST_TEST(RunPooling(poolInput) == expectedPooling, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
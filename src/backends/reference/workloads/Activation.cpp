@@ -7,6 +7,7 @@
 
 #include <boost/log/trivial.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 namespace armnn
@@ -81,6 +82,79 @@ float Activation(float in,
 }
 
 
+namespace
+{
+
+template <typename Function>
+void ApplyToChunk(const float* in, float* out, unsigned int numElements, Function function)
+{
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        out[i] = function(in[i]);
+    }
+}
+
+} // anonymous namespace
+
+/// Applies the activation function to a contiguous chunk of values. The switch on the function is hoisted out of
+/// the per-element loop so that each case compiles to a tight loop over the chunk.
+void Activation(const float* in,
+                float* out,
+                unsigned int numElements,
+                ActivationFunction function,
+                float a,
+                float b)
+{
+    switch (function)
+    {
+        case ActivationFunction::Linear:
+        {
+            ApplyToChunk(in, out, numElements, [a, b](float x) { return a * x + b; });
+            break;
+        }
+        case ActivationFunction::Sigmoid:
+        {
+            ApplyToChunk(in, out, numElements, [](float x) { return 1.f / (1.f + expf(-x)); });
+            break;
+        }
+        case ActivationFunction::ReLu:
+        {
+            ApplyToChunk(in, out, numElements, [](float x) { return std::max(0.f, x); });
+            break;
+        }
+        case ActivationFunction::BoundedReLu:
+        {
+            ApplyToChunk(in, out, numElements, [a, b](float x) { return std::min(a, std::max(b, x)); });
+            break;
+        }
+        case ActivationFunction::LeakyReLu:
+        {
+            ApplyToChunk(in, out, numElements, [a](float x) { return x > 0.0f ? x : (x * a); });
+            break;
+        }
+        case ActivationFunction::Abs:
+        {
+            ApplyToChunk(in, out, numElements, [](float x) { return x < 0 ? -x : x; });
+            break;
+        }
+        case ActivationFunction::Square:
+        {
+            ApplyToChunk(in, out, numElements, [](float x) { return x * x; });
+            break;
+        }
+        case ActivationFunction::TanH:
+        {
+            ApplyToChunk(in, out, numElements, [a, b](float x) { return a * tanhf(b * x); });
+            break;
+        }
+        default:
+        {
+            ApplyToChunk(in, out, numElements, [function, a, b](float x) { return Activation(x, function, a, b); });
+            break;
+        }
+    }
+}
+
 void Activation(Decoder<float>& in,
                 Encoder<float>& out,
                 const TensorInfo& tensorInfo,
@@ -88,13 +162,26 @@ void Activation(Decoder<float>& in,
                 float a,
                 float b)
 {
-    unsigned int numElements = tensorInfo.GetNumElements();
+    const unsigned int numElements = tensorInfo.GetNumElements();
 
-    for (unsigned int i = 0; i < numElements; i++)
+    float inputBuffer[g_IteratorChunkSize];
+    float outputBuffer[g_IteratorChunkSize];
+
+    unsigned int processed = 0;
+    while (processed < numElements)
     {
-        out.Set(Activation(in.Get(), function, a, b));
-        ++in;
-        ++out;
+        const unsigned int chunkSize = std::min(g_IteratorChunkSize, numElements - processed);
+
+        const float* inputValues = in.DecodeChunk(inputBuffer, chunkSize);
+        float* outputValues      = out.GetChunkBuffer(outputBuffer);
+
+        Activation(inputValues, outputValues, chunkSize, function, a, b);
+
+        out.EncodeChunk(outputValues, chunkSize);
+
+        in += chunkSize;
+        out += chunkSize;
+        processed += chunkSize;
     }
     in -= numElements;
     out -= numElements;
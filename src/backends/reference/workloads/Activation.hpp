@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: MIT
 //
 
+#pragma once
+
 #include "BaseIterator.hpp"
 
 #include <armnn/Tensor.hpp>
@@ -22,4 +24,11 @@ void Activation(Decoder<float>& in,
                 float a,
                 float b);
 
+void Activation(const float* in,
+                float* out,
+                unsigned int numElements,
+                ActivationFunction function,
+                float a,
+                float b);
+
 } //namespace armnn
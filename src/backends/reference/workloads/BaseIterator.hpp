@@ -6,15 +6,23 @@
 #pragma once
 
 #include "FloatingPointConverter.hpp"
+#include "QuantizedConverter.hpp"
 
 #include <armnn/ArmNN.hpp>
 #include <ResolveType.hpp>
 
 #include <boost/assert.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 namespace armnn
 {
 
+/// Number of elements workloads process at a time when using the bulk Decoder/Encoder interface.
+constexpr unsigned int g_IteratorChunkSize = 256;
+
 class BaseIterator
 {
 public:
@@ -42,6 +50,15 @@ public:
     virtual void Reset(void*) = 0;
 
     virtual IType Get() const = 0;
+
+    /// Decodes numElements consecutive elements, starting at the current position, into buffer.
+    /// Returns a pointer to the decoded values: decoders that need no conversion return their own data
+    /// and leave buffer untouched. The position of the iterator is not modified.
+    virtual const IType* DecodeChunk(IType* buffer, unsigned int numElements) const = 0;
+
+    /// Returns a copy of the decoder at its current position, so that each thread of a parallel kernel can
+    /// move its own iterator over the same data.
+    virtual std::unique_ptr<Decoder<IType>> Clone() const = 0;
 };
 
 template<typename IType>
@@ -57,6 +74,21 @@ public:
     virtual void Set(IType right) = 0;
 
     virtual IType Get() const = 0;
+
+    /// Returns the buffer values passed to EncodeChunk should be computed into: encoders that need no
+    /// conversion return their own data at the current position, all others return buffer.
+    virtual IType* GetChunkBuffer(IType* buffer)
+    {
+        return buffer;
+    }
+
+    /// Encodes numElements consecutive values, starting at the current position.
+    /// The position of the iterator is not modified.
+    virtual void EncodeChunk(const IType* values, unsigned int numElements) = 0;
+
+    /// Returns a copy of the encoder at its current position, so that each thread of a parallel kernel can
+    /// move its own iterator over the same data.
+    virtual std::unique_ptr<Encoder<IType>> Clone() const = 0;
 };
 
 template<typename T, typename Base>
@@ -120,6 +152,17 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    const float* DecodeChunk(float* buffer, unsigned int numElements) const override
+    {
+        armnnUtils::QuantizedConverter::Dequantize(m_Iterator, numElements, buffer, m_Scale, m_Offset);
+        return buffer;
+    }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<QASymm8Decoder>(*this);
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
@@ -139,11 +182,48 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    const float* DecodeChunk(float* buffer, unsigned int numElements) const override
+    {
+        armnnUtils::QuantizedConverter::Dequantize(m_Iterator, numElements, buffer, m_Scale, m_Offset);
+        return buffer;
+    }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<QSymm16Decoder>(*this);
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
 };
 
+class BFloat16Decoder : public TypedIterator<const BFloat16, Decoder<float>>
+{
+public:
+    BFloat16Decoder(const BFloat16* data)
+        : TypedIterator(data) {}
+
+    BFloat16Decoder()
+        : BFloat16Decoder(nullptr) {}
+
+    float Get() const override
+    {
+        return *m_Iterator;
+    }
+
+    const float* DecodeChunk(float* buffer, unsigned int numElements) const override
+    {
+        armnnUtils::FloatingPointConverter::ConvertBFloat16ToFloat32(m_Iterator, numElements, buffer);
+        return buffer;
+    }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<BFloat16Decoder>(*this);
+    }
+};
+
 class Float16Decoder : public TypedIterator<const Half, Decoder<float>>
 {
 public:
@@ -159,6 +239,17 @@ public:
         armnnUtils::FloatingPointConverter::ConvertFloat16To32(m_Iterator, 1, &val);
         return val;
     }
+
+    const float* DecodeChunk(float* buffer, unsigned int numElements) const override
+    {
+        armnnUtils::FloatingPointConverter::ConvertFloat16To32(m_Iterator, numElements, buffer);
+        return buffer;
+    }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<Float16Decoder>(*this);
+    }
 };
 
 class Float32Decoder : public TypedIterator<const float, Decoder<float>>
@@ -174,6 +265,16 @@ public:
     {
         return *m_Iterator;
     }
+
+    const float* DecodeChunk(float*, unsigned int) const override
+    {
+        return m_Iterator;
+    }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<Float32Decoder>(*this);
+    }
 };
 
 class ScaledInt32Decoder : public TypedIterator<const int32_t, Decoder<float>>
@@ -190,6 +291,20 @@ public:
         return static_cast<float>(*m_Iterator) * m_Scale;
     }
 
+    const float* DecodeChunk(float* buffer, unsigned int numElements) const override
+    {
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            buffer[i] = static_cast<float>(m_Iterator[i]) * m_Scale;
+        }
+        return buffer;
+    }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<ScaledInt32Decoder>(*this);
+    }
+
 private:
     const float m_Scale;
 };
@@ -207,6 +322,93 @@ public:
     {
         return static_cast<float>(*m_Iterator);
     }
+
+    const float* DecodeChunk(float* buffer, unsigned int numElements) const override
+    {
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            buffer[i] = static_cast<float>(m_Iterator[i]);
+        }
+        return buffer;
+    }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<Int32Decoder>(*this);
+    }
+};
+
+/// Base for iterators over per-axis quantized tensors: the scale of the element at the current position is that of
+/// its index along the quantization dimension, axisFactor being the number of elements after that dimension.
+template<typename T, typename Base>
+class PerAxisIterator : public TypedIterator<T, Base>
+{
+public:
+    PerAxisIterator(T* data, const std::vector<float>& scales, unsigned int axisFactor)
+        : TypedIterator<T, Base>(data), m_Scales(scales), m_AxisFactor(axisFactor) {}
+
+protected:
+    float GetScale(unsigned int offset = 0) const
+    {
+        const auto index = static_cast<unsigned int>(this->m_Iterator - this->m_Start) + offset;
+        return m_Scales[(index / m_AxisFactor) % m_Scales.size()];
+    }
+
+    std::vector<float> m_Scales;
+    unsigned int m_AxisFactor;
+};
+
+class QSymm8PerAxisDecoder : public PerAxisIterator<const int8_t, Decoder<float>>
+{
+public:
+    QSymm8PerAxisDecoder(const int8_t* data, const std::vector<float>& scales, unsigned int axisFactor)
+        : PerAxisIterator(data, scales, axisFactor) {}
+
+    float Get() const override
+    {
+        return armnn::Dequantize(*m_Iterator, GetScale(), 0);
+    }
+
+    const float* DecodeChunk(float* buffer, unsigned int numElements) const override
+    {
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            buffer[i] = armnn::Dequantize(m_Iterator[i], GetScale(i), 0);
+        }
+        return buffer;
+    }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<QSymm8PerAxisDecoder>(*this);
+    }
+};
+
+/// Used for the biases of convolutions with per-axis quantized weights, whose scales are per output channel.
+class ScaledInt32PerAxisDecoder : public PerAxisIterator<const int32_t, Decoder<float>>
+{
+public:
+    ScaledInt32PerAxisDecoder(const int32_t* data, const std::vector<float>& scales, unsigned int axisFactor)
+        : PerAxisIterator(data, scales, axisFactor) {}
+
+    float Get() const override
+    {
+        return static_cast<float>(*m_Iterator) * GetScale();
+    }
+
+    const float* DecodeChunk(float* buffer, unsigned int numElements) const override
+    {
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            buffer[i] = static_cast<float>(m_Iterator[i]) * GetScale(i);
+        }
+        return buffer;
+    }
+
+    std::unique_ptr<Decoder<float>> Clone() const override
+    {
+        return std::make_unique<ScaledInt32PerAxisDecoder>(*this);
+    }
 };
 
 class QASymm8Encoder : public TypedIterator<uint8_t, Encoder<float>>
@@ -228,6 +430,16 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    void EncodeChunk(const float* values, unsigned int numElements) override
+    {
+        armnnUtils::QuantizedConverter::Quantize(values, numElements, m_Iterator, m_Scale, m_Offset);
+    }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<QASymm8Encoder>(*this);
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
@@ -252,11 +464,81 @@ public:
         return armnn::Dequantize(*m_Iterator, m_Scale, m_Offset);
     }
 
+    void EncodeChunk(const float* values, unsigned int numElements) override
+    {
+        armnnUtils::QuantizedConverter::Quantize(values, numElements, m_Iterator, m_Scale, m_Offset);
+    }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<QSymm16Encoder>(*this);
+    }
+
 private:
     const float m_Scale;
     const int32_t m_Offset;
 };
 
+class QSymm8PerAxisEncoder : public PerAxisIterator<int8_t, Encoder<float>>
+{
+public:
+    QSymm8PerAxisEncoder(int8_t* data, const std::vector<float>& scales, unsigned int axisFactor)
+        : PerAxisIterator(data, scales, axisFactor) {}
+
+    void Set(float right) override
+    {
+        *m_Iterator = armnn::Quantize<int8_t>(right, GetScale(), 0);
+    }
+
+    float Get() const override
+    {
+        return armnn::Dequantize(*m_Iterator, GetScale(), 0);
+    }
+
+    void EncodeChunk(const float* values, unsigned int numElements) override
+    {
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            m_Iterator[i] = armnn::Quantize<int8_t>(values[i], GetScale(i), 0);
+        }
+    }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<QSymm8PerAxisEncoder>(*this);
+    }
+};
+
+class BFloat16Encoder : public TypedIterator<BFloat16, Encoder<float>>
+{
+public:
+    BFloat16Encoder(BFloat16* data)
+        : TypedIterator(data) {}
+
+    BFloat16Encoder()
+        : BFloat16Encoder(nullptr) {}
+
+    void Set(float right) override
+    {
+        *m_Iterator = right;
+    }
+
+    float Get() const override
+    {
+        return *m_Iterator;
+    }
+
+    void EncodeChunk(const float* values, unsigned int numElements) override
+    {
+        armnnUtils::FloatingPointConverter::ConvertFloat32ToBFloat16(values, numElements, m_Iterator);
+    }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<BFloat16Encoder>(*this);
+    }
+};
+
 class Float16Encoder : public TypedIterator<Half, Encoder<float>>
 {
 public:
@@ -277,6 +559,16 @@ public:
         armnnUtils::FloatingPointConverter::ConvertFloat16To32(m_Iterator, 1, &val);
         return val;
     }
+
+    void EncodeChunk(const float* values, unsigned int numElements) override
+    {
+        armnnUtils::FloatingPointConverter::ConvertFloat32To16(values, numElements, m_Iterator);
+    }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<Float16Encoder>(*this);
+    }
 };
 
 class Float32Encoder : public TypedIterator<float, Encoder<float>>
@@ -297,6 +589,24 @@ public:
     {
         return *m_Iterator;
     }
+
+    float* GetChunkBuffer(float*) override
+    {
+        return m_Iterator;
+    }
+
+    void EncodeChunk(const float* values, unsigned int numElements) override
+    {
+        if (values != m_Iterator)
+        {
+            std::copy(values, values + numElements, m_Iterator);
+        }
+    }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<Float32Encoder>(*this);
+    }
 };
 
 class Int32Encoder : public TypedIterator<int32_t, Encoder<float>>
@@ -317,6 +627,19 @@ public:
     {
         return static_cast<float>(*m_Iterator);
     }
+
+    void EncodeChunk(const float* values, unsigned int numElements) override
+    {
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            m_Iterator[i] = static_cast<int32_t>(values[i]);
+        }
+    }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<Int32Encoder>(*this);
+    }
 };
 
 class BooleanEncoder : public TypedIterator<uint8_t, Encoder<bool>>
@@ -337,6 +660,19 @@ public:
     {
         return *m_Iterator;
     }
+
+    void EncodeChunk(const bool* values, unsigned int numElements) override
+    {
+        for (unsigned int i = 0; i < numElements; ++i)
+        {
+            m_Iterator[i] = values[i];
+        }
+    }
+
+    std::unique_ptr<Encoder<bool>> Clone() const override
+    {
+        return std::make_unique<BooleanEncoder>(*this);
+    }
 };
 
 } //namespace armnn
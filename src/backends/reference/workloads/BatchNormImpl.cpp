@@ -5,12 +5,15 @@
 
 #include "BatchNormImpl.hpp"
 #include "RefWorkloadUtils.hpp"
+#include "ThreadPool.hpp"
 
 #include <armnn/Tensor.hpp>
 
 #include <DataLayoutIndexed.hpp>
 
 #include <cmath>
+#include <memory>
+#include <vector>
 
 namespace armnn
 {
@@ -33,6 +36,9 @@ void BatchNormImpl(const BatchNormalizationQueueDescriptor& data,
     unsigned int inputWidth    = inputShape[dataLayout.GetWidthIndex()];
     unsigned int inputChannels = inputShape[dataLayout.GetChannelsIndex()];
 
+    // The per-channel parameters are decoded up front, as the parameter decoders are shared by all threads.
+    std::vector<float> multipliers(inputChannels);
+    std::vector<float> addends(inputChannels);
     for (unsigned int c = 0; c < inputChannels; c++)
     {
         meanDecoder[c];
@@ -44,23 +50,35 @@ void BatchNormImpl(const BatchNormalizationQueueDescriptor& data,
         float beta  = betaDecoder.Get();
         float gamma = gammaDecoder.Get();
 
-        float mult = gamma / sqrtf(var + data.m_Parameters.m_Eps);
-        float add  = beta - mult * mean;
+        multipliers[c] = gamma / sqrtf(var + data.m_Parameters.m_Eps);
+        addends[c]     = beta - multipliers[c] * mean;
+    }
+
+    ParallelFor(0, inputChannels, [&](unsigned int begin, unsigned int end)
+    {
+        std::unique_ptr<Decoder<float>> channelInputDecoder  = inputDecoder.Clone();
+        std::unique_ptr<Encoder<float>> channelOutputEncoder = outputEncoder.Clone();
 
-        for (unsigned int n = 0; n < inputBatches; n++)
+        for (unsigned int c = begin; c < end; c++)
         {
-            for (unsigned int h = 0; h < inputHeight; h++)
+            const float mult = multipliers[c];
+            const float add  = addends[c];
+
+            for (unsigned int n = 0; n < inputBatches; n++)
             {
-                for (unsigned int w = 0; w < inputWidth; w++)
+                for (unsigned int h = 0; h < inputHeight; h++)
                 {
-                    unsigned int index = dataLayout.GetIndex(inputShape, n, c, h, w);
-                    inputDecoder[index];
-                    outputEncoder[index];
-                    outputEncoder.Set(mult * inputDecoder.Get() + add);
+                    for (unsigned int w = 0; w < inputWidth; w++)
+                    {
+                        unsigned int index = dataLayout.GetIndex(inputShape, n, c, h, w);
+                        (*channelInputDecoder)[index];
+                        (*channelOutputEncoder)[index];
+                        channelOutputEncoder->Set(mult * channelInputDecoder->Get() + add);
+                    }
                 }
             }
         }
-    }
+    });
 }
 
 } // namespace armnn
@@ -0,0 +1,125 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "BlockCsrMatrix.hpp"
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Number of rows, spread evenly over a matrix, whose blocks are checked to estimate its density.
+constexpr unsigned int g_NumDensitySampleRows = 16;
+
+/// Returns the fraction of the blocks holding a non-zero value in a sample of the rows of a matrix, read straight
+/// from the decoder. A block is known to be non-zero at its first non-zero value, so dense rows cost about one
+/// read per block.
+float EstimateBlockDensity(Decoder<float>& decoder,
+                           unsigned int numRows,
+                           unsigned int numColumns,
+                           unsigned int rowStride,
+                           unsigned int columnStride)
+{
+    const unsigned int rowStep = std::max(1u, numRows / g_NumDensitySampleRows);
+
+    // Read with DecodeChunk, as the whole matrix is below: Get also asserts on the quantization parameters.
+    float value;
+    unsigned int numBlocks = 0;
+    unsigned int numNonZeroBlocks = 0;
+    for (unsigned int row = 0; row < numRows; row += rowStep)
+    {
+        for (unsigned int column = 0; column < numColumns; column += g_SparseBlockSize)
+        {
+            const unsigned int blockEnd = std::min(column + g_SparseBlockSize, numColumns);
+            for (unsigned int i = column; i < blockEnd; ++i)
+            {
+                decoder[row * rowStride + i * columnStride];
+                if (*decoder.DecodeChunk(&value, 1) != 0.0f)
+                {
+                    ++numNonZeroBlocks;
+                    break;
+                }
+            }
+            ++numBlocks;
+        }
+    }
+
+    return numBlocks == 0 ? 1.0f : static_cast<float>(numNonZeroBlocks) / static_cast<float>(numBlocks);
+}
+
+} // anonymous namespace
+
+BlockCsrMatrix::BlockCsrMatrix(const float* values,
+                               unsigned int numRows,
+                               unsigned int numColumns,
+                               unsigned int rowStride,
+                               unsigned int columnStride)
+    : m_NumRows(numRows)
+    , m_NumColumns(numColumns)
+    , m_NumBlockColumns((numColumns + g_SparseBlockSize - 1) / g_SparseBlockSize)
+{
+    m_RowStarts.reserve(numRows + 1);
+    m_RowStarts.push_back(0);
+
+    float block[g_SparseBlockSize];
+    for (unsigned int row = 0; row < numRows; ++row)
+    {
+        const float* rowValues = values + row * rowStride;
+        for (unsigned int column = 0; column < numColumns; column += g_SparseBlockSize)
+        {
+            const unsigned int blockWidth = std::min(g_SparseBlockSize, numColumns - column);
+            bool isZero = true;
+            for (unsigned int i = 0; i < g_SparseBlockSize; ++i)
+            {
+                block[i] = i < blockWidth ? rowValues[(column + i) * columnStride] : 0.0f;
+                isZero = isZero && block[i] == 0.0f;
+            }
+
+            if (!isZero)
+            {
+                m_BlockColumns.push_back(column);
+                m_Values.insert(m_Values.end(), block, block + g_SparseBlockSize);
+            }
+        }
+        m_RowStarts.push_back(static_cast<unsigned int>(m_BlockColumns.size()));
+    }
+}
+
+float BlockCsrMatrix::GetDensity() const
+{
+    const unsigned int numBlocks = m_NumRows * m_NumBlockColumns;
+    return numBlocks == 0 ? 1.0f : static_cast<float>(m_RowStarts.back()) / static_cast<float>(numBlocks);
+}
+
+std::unique_ptr<BlockCsrMatrix> MakeBlockCsrMatrixIfSparse(Decoder<float>& decoder,
+                                                           unsigned int numRows,
+                                                           unsigned int numColumns,
+                                                           unsigned int rowStride,
+                                                           unsigned int columnStride)
+{
+    // Dense weights are ruled out from a sample of their rows, before the whole matrix is decoded and compressed.
+    if (EstimateBlockDensity(decoder, numRows, numColumns, rowStride, columnStride) >=
+        g_SparseWeightsDensityThreshold)
+    {
+        return nullptr;
+    }
+
+    const unsigned int numElements = numRows * numColumns;
+    std::vector<float> buffer(numElements);
+    decoder[0];
+    const float* values = decoder.DecodeChunk(buffer.data(), numElements);
+
+    auto matrix = std::make_unique<BlockCsrMatrix>(values, numRows, numColumns, rowStride, columnStride);
+    if (matrix->GetDensity() >= g_SparseWeightsDensityThreshold)
+    {
+        return nullptr;
+    }
+    return matrix;
+}
+
+} //namespace armnn
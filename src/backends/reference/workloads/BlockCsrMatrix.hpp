@@ -0,0 +1,84 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "BaseIterator.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+
+/// Number of consecutive columns grouped into each block of a BlockCsrMatrix.
+constexpr unsigned int g_SparseBlockSize = 4;
+
+/// Weights whose fraction of non-zero blocks is below this are multiplied in block-CSR form: under it, skipping
+/// the zero blocks saves more than the indirection costs.
+constexpr float g_SparseWeightsDensityThreshold = 0.5f;
+
+/// A matrix in block compressed sparse row form, with blocks of 1 x g_SparseBlockSize values: only the blocks
+/// holding a non-zero value are stored, row by row, along with the column they start at.
+class BlockCsrMatrix
+{
+public:
+    /// Compresses a dense matrix, whose element (row, column) is at values[row * rowStride + column * columnStride].
+    BlockCsrMatrix(const float* values,
+                   unsigned int numRows,
+                   unsigned int numColumns,
+                   unsigned int rowStride,
+                   unsigned int columnStride);
+
+    unsigned int GetNumRows() const { return m_NumRows; }
+    unsigned int GetNumColumns() const { return m_NumColumns; }
+
+    /// The number of columns rounded up to a whole number of blocks: vectors the matrix is multiplied with must be
+    /// this long, with zeros past GetNumColumns().
+    unsigned int GetNumPaddedColumns() const { return m_NumBlockColumns * g_SparseBlockSize; }
+
+    /// The fraction of the blocks that are stored.
+    float GetDensity() const;
+
+    /// Returns the dot product of a row of the matrix with a vector of GetNumPaddedColumns() values.
+    float MultiplyRow(unsigned int row, const float* vector) const
+    {
+        float sum = 0.0f;
+        const float* blockValues = m_Values.data() + m_RowStarts[row] * g_SparseBlockSize;
+        for (unsigned int block = m_RowStarts[row]; block < m_RowStarts[row + 1]; ++block)
+        {
+            const float* v = vector + m_BlockColumns[block];
+            for (unsigned int i = 0; i < g_SparseBlockSize; ++i)
+            {
+                sum += blockValues[i] * v[i];
+            }
+            blockValues += g_SparseBlockSize;
+        }
+        return sum;
+    }
+
+private:
+    unsigned int m_NumRows;
+    unsigned int m_NumColumns;
+    unsigned int m_NumBlockColumns;
+
+    /// Index of the first block of each row, followed by the total number of blocks.
+    std::vector<unsigned int> m_RowStarts;
+    /// Column the values of each block start at.
+    std::vector<unsigned int> m_BlockColumns;
+    /// Values of each block, zero-padded past the last column.
+    std::vector<float> m_Values;
+};
+
+/// Decodes a dense matrix, laid out as for the BlockCsrMatrix constructor, and returns it in block-CSR form if its
+/// density is below g_SparseWeightsDensityThreshold, or nullptr otherwise. The density is first estimated from a
+/// sample of the rows, so that dense matrices are not decoded.
+std::unique_ptr<BlockCsrMatrix> MakeBlockCsrMatrixIfSparse(Decoder<float>& decoder,
+                                                           unsigned int numRows,
+                                                           unsigned int numColumns,
+                                                           unsigned int rowStride,
+                                                           unsigned int columnStride);
+
+} //namespace armnn
@@ -9,9 +9,10 @@ namespace armnn
 {
 
 BroadcastLoop::BroadcastLoop(const TensorShape& inShape0, const TensorShape& inShape1, const TensorShape& outShape)
-: m_DimData(outShape.GetNumDimensions())
 {
-    const unsigned int numDims = GetNumDimensions();
+    const unsigned int numDims = outShape.GetNumDimensions();
+
+    std::vector<BroadcastDimensionData> dimData(numDims);
 
     unsigned int sIn0 = 1;
     unsigned int sIn1 = 1;
@@ -19,15 +20,49 @@ BroadcastLoop::BroadcastLoop(const TensorShape& inShape0, const TensorShape& inS
 
     for (unsigned int j = numDims - 1, k = 0; k < numDims ; k++, j--)
     {
-        m_DimData[j].m_DimSize = outShape[j];
-        m_DimData[j].m_Stride1 = (inShape0[j] > 1) ? sIn0 : 0;
-        m_DimData[j].m_Stride2 = (inShape1[j] > 1) ? sIn1 : 0;
-        m_DimData[j].m_StrideOut = sOut;
+        dimData[j].m_DimSize = outShape[j];
+        dimData[j].m_Stride1 = (inShape0[j] > 1) ? sIn0 : 0;
+        dimData[j].m_Stride2 = (inShape1[j] > 1) ? sIn1 : 0;
+        dimData[j].m_StrideOut = sOut;
 
         sIn0 *= inShape0[j];
         sIn1 *= inShape1[j];
         sOut *= outShape[j];
     }
+
+    // Collapse the dimensions so that the innermost loop runs over as many elements as possible. Dimensions of
+    // size 1 don't move any iterator and are dropped. Neighbouring dimensions are merged when each input is either
+    // broadcast along both or read along both, as the merged dimension is then contiguous for every tensor.
+    // This turns e.g. same-shape operations into a single flat loop and a per-channel bias into at most two loops.
+    for (const BroadcastDimensionData& dim : dimData)
+    {
+        if (dim.m_DimSize == 1)
+        {
+            continue;
+        }
+
+        if (!m_DimData.empty())
+        {
+            BroadcastDimensionData& outer = m_DimData.back();
+            if ((outer.m_Stride1 == 0) == (dim.m_Stride1 == 0) &&
+                (outer.m_Stride2 == 0) == (dim.m_Stride2 == 0))
+            {
+                outer.m_DimSize  *= dim.m_DimSize;
+                outer.m_Stride1   = dim.m_Stride1;
+                outer.m_Stride2   = dim.m_Stride2;
+                outer.m_StrideOut = dim.m_StrideOut;
+                continue;
+            }
+        }
+
+        m_DimData.push_back(dim);
+    }
+
+    if (m_DimData.empty() && numDims > 0)
+    {
+        // Single element tensors still go through the innermost loop.
+        m_DimData.push_back({ 1, 1, 0, 0 });
+    }
 }
 
 } // namespace armnn
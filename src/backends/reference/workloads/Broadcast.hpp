@@ -4,9 +4,14 @@
 //
 
 #include "BaseIterator.hpp"
+#include "ThreadPool.hpp"
+
 #include <armnn/Tensor.hpp>
 
+#include <algorithm>
 #include <functional>
+#include <memory>
+#include <type_traits>
 
 namespace armnn
 {
@@ -33,6 +38,18 @@ struct BroadcastLoop
             return;
         }
 
+        if (dimension == 0)
+        {
+            UnrollOutermost(operationFunc, inData0, inData1, outData);
+            return;
+        }
+
+        if (dimension == GetNumDimensions() - 1)
+        {
+            UnrollInnermost(operationFunc, inData0, inData1, outData, m_DimData.back().m_DimSize);
+            return;
+        }
+
         unsigned int inData0Movement = 0;
         unsigned int inData1Movement = 0;
         unsigned int outDataMovement = 0;
@@ -57,6 +74,118 @@ struct BroadcastLoop
     }
 
 private:
+    /// Splits the outermost dimension across the reference thread pool. When the innermost dimension is the only
+    /// one left after collapsing, it is split in whole chunks.
+    template <typename Func, typename DecoderOp, typename EncoderOp>
+    void UnrollOutermost(Func operationFunc,
+                         DecoderOp& inData0,
+                         DecoderOp& inData1,
+                         EncoderOp& outData)
+    {
+        const BroadcastDimensionData& dimData = m_DimData.front();
+        const bool isInnermost = GetNumDimensions() == 1;
+
+        ParallelFor(0, dimData.m_DimSize, [&](unsigned int begin, unsigned int end)
+        {
+            auto in0 = inData0.Clone();
+            auto in1 = inData1.Clone();
+            auto out = outData.Clone();
+
+            *in0 += dimData.m_Stride1 * begin;
+            *in1 += dimData.m_Stride2 * begin;
+            *out += dimData.m_StrideOut * begin;
+
+            if (isInnermost)
+            {
+                UnrollInnermost(operationFunc, *in0, *in1, *out, end - begin);
+                return;
+            }
+
+            for (unsigned int i = begin; i < end; i++)
+            {
+                Unroll(operationFunc, 1, *in0, *in1, *out);
+
+                *in0 += dimData.m_Stride1;
+                *in1 += dimData.m_Stride2;
+                *out += dimData.m_StrideOut;
+            }
+        }, isInnermost ? g_IteratorChunkSize : 1);
+    }
+
+    /// Processes the innermost dimension in chunks through the bulk Decoder/Encoder interface. The innermost
+    /// strides are always 1 (contiguous) or 0 (broadcast), so each input is either decoded as a span or read once.
+    template <typename Func, typename DecoderOp, typename EncoderOp>
+    void UnrollInnermost(Func operationFunc,
+                         DecoderOp& inData0,
+                         DecoderOp& inData1,
+                         EncoderOp& outData,
+                         unsigned int dimSize)
+    {
+        using InType  = typename std::decay<decltype(inData0.Get())>::type;
+        using OutType = typename std::decay<decltype(outData.Get())>::type;
+
+        const BroadcastDimensionData& dimData = m_DimData.back();
+
+        InType inBuffer0[g_IteratorChunkSize];
+        InType inBuffer1[g_IteratorChunkSize];
+        OutType outBuffer[g_IteratorChunkSize];
+
+        // Inputs that are broadcast along the innermost dimension are read once.
+        const InType scalar0 = dimData.m_Stride1 == 0 ? inData0.Get() : InType();
+        const InType scalar1 = dimData.m_Stride2 == 0 ? inData1.Get() : InType();
+
+        unsigned int processed = 0;
+        while (processed < dimSize)
+        {
+            const unsigned int chunkSize = std::min(g_IteratorChunkSize, dimSize - processed);
+
+            OutType* out = outData.GetChunkBuffer(outBuffer);
+
+            // Dispatch on the broadcast pattern so that each case is a plain loop over contiguous buffers.
+            if (dimData.m_Stride1 != 0 && dimData.m_Stride2 != 0)
+            {
+                const InType* in0 = inData0.DecodeChunk(inBuffer0, chunkSize);
+                const InType* in1 = inData1.DecodeChunk(inBuffer1, chunkSize);
+                for (unsigned int i = 0; i < chunkSize; ++i)
+                {
+                    out[i] = operationFunc(in0[i], in1[i]);
+                }
+            }
+            else if (dimData.m_Stride1 != 0)
+            {
+                const InType* in0 = inData0.DecodeChunk(inBuffer0, chunkSize);
+                for (unsigned int i = 0; i < chunkSize; ++i)
+                {
+                    out[i] = operationFunc(in0[i], scalar1);
+                }
+            }
+            else if (dimData.m_Stride2 != 0)
+            {
+                const InType* in1 = inData1.DecodeChunk(inBuffer1, chunkSize);
+                for (unsigned int i = 0; i < chunkSize; ++i)
+                {
+                    out[i] = operationFunc(scalar0, in1[i]);
+                }
+            }
+            else
+            {
+                std::fill_n(out, chunkSize, operationFunc(scalar0, scalar1));
+            }
+
+            outData.EncodeChunk(out, chunkSize);
+
+            inData0 += dimData.m_Stride1 * chunkSize;
+            inData1 += dimData.m_Stride2 * chunkSize;
+            outData += chunkSize;
+            processed += chunkSize;
+        }
+
+        // move iterator back to the start
+        inData0 -= dimData.m_Stride1 * dimSize;
+        inData1 -= dimData.m_Stride2 * dimSize;
+        outData -= dimSize;
+    }
+
     // Struct to hold the dimension data.
     struct BroadcastDimensionData
     {
@@ -4,11 +4,15 @@
 //
 
 #include "ConvImpl.hpp"
+#include "ThreadPool.hpp"
 
 #include <boost/assert.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <memory>
+#include <vector>
 
 namespace armnn
 {
@@ -108,10 +112,18 @@ void Convolve(const TensorShape& rInputShape,
     unsigned int filterHeight = depthwise ? rFilterShape[2] : rFilterShape[heightIndex];
     unsigned int filterWidth  = depthwise ? rFilterShape[3] : rFilterShape[widthIndex];
 
-    for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
+    ParallelFor(0, batchSize * outputChannels, [&](unsigned int begin, unsigned int end)
     {
-        for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+        std::unique_ptr<Decoder<float>> inputDecoder  = rInputDecoder.Clone();
+        std::unique_ptr<Decoder<float>> filterDecoder = rFilterDecoder.Clone();
+        std::unique_ptr<Decoder<float>> biasDecoder   = biasEnabled ? pBiasDecoder->Clone() : nullptr;
+        std::unique_ptr<Encoder<float>> outputEncoder = rOutputEncoder.Clone();
+
+        for (unsigned int index = begin; index < end; ++index)
         {
+            const unsigned int batchIdx = index / outputChannels;
+            const unsigned int cOutput  = index % outputChannels;
+
             for (unsigned int yOutput = 0; yOutput < outputHeight; yOutput++)
             {
                 for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
@@ -165,8 +177,8 @@ void Convolve(const TensorShape& rInputShape,
                                     }
                                 }
 
-                                rFilterDecoder[filterIndex];
-                                float filterValue = rFilterDecoder.Get();
+                                (*filterDecoder)[filterIndex];
+                                float filterValue = filterDecoder->Get();
 
                                 unsigned int yInput = yOutput * yStride + yFilter * yDilation;
                                 unsigned int xInput = xOutput * xStride + xFilter * xDilation;
@@ -200,8 +212,8 @@ void Convolve(const TensorShape& rInputShape,
                                                      xInput - paddingLeft;
                                     }
 
-                                    rInputDecoder[inputIndex];
-                                    inputValue = rInputDecoder.Get();
+                                    (*inputDecoder)[inputIndex];
+                                    inputValue = inputDecoder->Get();
                                 }
 
                                 sum += filterValue * inputValue;
@@ -211,17 +223,212 @@ void Convolve(const TensorShape& rInputShape,
 
                     if (biasEnabled)
                     {
-                        (*pBiasDecoder)[cOutput];
-                        sum += pBiasDecoder->Get();
+                        (*biasDecoder)[cOutput];
+                        sum += biasDecoder->Get();
                     }
 
                     unsigned int outIdx = dataLayoutIndexed.GetIndex(rOutputShape, batchIdx, cOutput, yOutput, xOutput);
 
-                    rOutputEncoder[outIdx];
-                    rOutputEncoder.Set(sum);
+                    (*outputEncoder)[outIdx];
+                    outputEncoder->Set(sum);
                 }
             }
         }
+    });
+}
+
+// Each output pixel gathers the input values under the filter window into a patch, in the order of the filter
+// tensor, which is then multiplied with the non-zero blocks of every output channel.
+void ConvolveSparse(const TensorShape& rInputShape,
+                    Decoder<float>& rInputDecoder,
+                    const TensorShape& rOutputShape,
+                    Encoder<float>& rOutputEncoder,
+                    const TensorShape& rFilterShape,
+                    const BlockCsrMatrix& filter,
+                    Decoder<float>* pBiasDecoder,
+                    DataLayout dataLayout,
+                    unsigned int paddingTop,
+                    unsigned int paddingLeft,
+                    unsigned int xStride,
+                    unsigned int yStride,
+                    unsigned int xDilation,
+                    unsigned int yDilation)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const bool isNhwc = dataLayout == DataLayout::NHWC;
+
+    const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
+    const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
+    const unsigned int widthIndex    = dataLayoutIndexed.GetWidthIndex();
+
+    const unsigned int inputChannels  = rFilterShape[channelsIndex];
+    const unsigned int outputChannels = rFilterShape[0];
+    const unsigned int filterHeight   = rFilterShape[heightIndex];
+    const unsigned int filterWidth    = rFilterShape[widthIndex];
+    BOOST_ASSERT(filter.GetNumRows() == outputChannels);
+    BOOST_ASSERT(filter.GetNumColumns() == inputChannels * filterHeight * filterWidth);
+
+    const unsigned int batchSize    = rOutputShape[0];
+    const unsigned int outputHeight = rOutputShape[heightIndex];
+    const unsigned int outputWidth  = rOutputShape[widthIndex];
+    const unsigned int inputHeight  = rInputShape[heightIndex];
+    const unsigned int inputWidth   = rInputShape[widthIndex];
+
+    const unsigned int inputBatchSize  = inputHeight * inputWidth * inputChannels;
+    const unsigned int outputPlaneSize = outputHeight * outputWidth;
+    const unsigned int outputBatchSize = outputPlaneSize * outputChannels;
+
+    std::vector<float> bias(outputChannels, 0.0f);
+    if (pBiasDecoder)
+    {
+        (*pBiasDecoder)[0];
+        const float* biasValues = pBiasDecoder->DecodeChunk(bias.data(), outputChannels);
+        if (biasValues != bias.data())
+        {
+            std::copy(biasValues, biasValues + outputChannels, bias.begin());
+        }
+    }
+
+    std::vector<float> inputBuffer(inputBatchSize);
+    std::vector<float> outputBuffer(outputBatchSize);
+
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    {
+        rInputDecoder[batchIdx * inputBatchSize];
+        rOutputEncoder[batchIdx * outputBatchSize];
+        const float* inputValues = rInputDecoder.DecodeChunk(inputBuffer.data(), inputBatchSize);
+        float* outputValues = rOutputEncoder.GetChunkBuffer(outputBuffer.data());
+
+        // Each thread gathers into its own patch, whose padding past the last column stays zero.
+        ParallelFor(0, outputPlaneSize, [&](unsigned int begin, unsigned int end)
+        {
+            std::vector<float> patch(filter.GetNumPaddedColumns(), 0.0f);
+
+            for (unsigned int pixel = begin; pixel < end; ++pixel)
+            {
+                const unsigned int yOutput = pixel / outputWidth;
+                const unsigned int xOutput = pixel % outputWidth;
+
+                for (unsigned int yFilter = 0; yFilter < filterHeight; ++yFilter)
+                {
+                    // Unsigned arithmetic: positions in the top or left padding wrap around and fail the checks.
+                    const unsigned int yInput = yOutput * yStride + yFilter * yDilation - paddingTop;
+                    for (unsigned int xFilter = 0; xFilter < filterWidth; ++xFilter)
+                    {
+                        const unsigned int xInput = xOutput * xStride + xFilter * xDilation - paddingLeft;
+                        const bool inPadding = yInput >= inputHeight || xInput >= inputWidth;
+
+                        for (unsigned int cInput = 0; cInput < inputChannels; ++cInput)
+                        {
+                            const unsigned int patchIndex = isNhwc ?
+                                (yFilter * filterWidth + xFilter) * inputChannels + cInput :
+                                (cInput * filterHeight + yFilter) * filterWidth + xFilter;
+                            const unsigned int inputIndex = isNhwc ?
+                                (yInput * inputWidth + xInput) * inputChannels + cInput :
+                                (cInput * inputHeight + yInput) * inputWidth + xInput;
+                            patch[patchIndex] = inPadding ? 0.0f : inputValues[inputIndex];
+                        }
+                    }
+                }
+
+                for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+                {
+                    const unsigned int outputIndex = isNhwc ?
+                        pixel * outputChannels + cOutput :
+                        cOutput * outputPlaneSize + pixel;
+                    outputValues[outputIndex] = filter.MultiplyRow(cOutput, patch.data()) + bias[cOutput];
+                }
+            }
+        });
+
+        rOutputEncoder.EncodeChunk(outputValues, outputBatchSize);
+    }
+}
+
+void ConvolveQSymm16(const TensorShape& rInputShape,
+                     const int16_t* pInput,
+                     const TensorShape& rOutputShape,
+                     int16_t* pOutput,
+                     const TensorShape& rFilterShape,
+                     const QSymm16MatrixMultiplier& filter,
+                     DataLayout dataLayout,
+                     unsigned int paddingTop,
+                     unsigned int paddingLeft,
+                     unsigned int xStride,
+                     unsigned int yStride,
+                     unsigned int xDilation,
+                     unsigned int yDilation)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const bool isNhwc = dataLayout == DataLayout::NHWC;
+
+    const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
+    const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
+    const unsigned int widthIndex    = dataLayoutIndexed.GetWidthIndex();
+
+    const unsigned int inputChannels  = rFilterShape[channelsIndex];
+    const unsigned int outputChannels = rFilterShape[0];
+    const unsigned int filterHeight   = rFilterShape[heightIndex];
+    const unsigned int filterWidth    = rFilterShape[widthIndex];
+    BOOST_ASSERT(filter.GetNumRows() == outputChannels);
+    BOOST_ASSERT(filter.GetNumColumns() == inputChannels * filterHeight * filterWidth);
+
+    const unsigned int batchSize    = rOutputShape[0];
+    const unsigned int outputHeight = rOutputShape[heightIndex];
+    const unsigned int outputWidth  = rOutputShape[widthIndex];
+    const unsigned int inputHeight  = rInputShape[heightIndex];
+    const unsigned int inputWidth   = rInputShape[widthIndex];
+
+    const unsigned int inputBatchSize  = inputHeight * inputWidth * inputChannels;
+    const unsigned int outputPlaneSize = outputHeight * outputWidth;
+    const unsigned int outputBatchSize = outputPlaneSize * outputChannels;
+
+    for (unsigned int batchIdx = 0; batchIdx < batchSize; ++batchIdx)
+    {
+        const int16_t* inputValues = pInput + batchIdx * inputBatchSize;
+        int16_t* outputValues = pOutput + batchIdx * outputBatchSize;
+
+        // As in ConvolveSparse, each thread gathers the input of its output pixels into its own patch.
+        ParallelFor(0, outputPlaneSize, [&](unsigned int begin, unsigned int end)
+        {
+            std::vector<int16_t> patch(filter.GetNumColumns());
+
+            for (unsigned int pixel = begin; pixel < end; ++pixel)
+            {
+                const unsigned int yOutput = pixel / outputWidth;
+                const unsigned int xOutput = pixel % outputWidth;
+
+                for (unsigned int yFilter = 0; yFilter < filterHeight; ++yFilter)
+                {
+                    // Unsigned arithmetic: positions in the top or left padding wrap around and fail the checks.
+                    const unsigned int yInput = yOutput * yStride + yFilter * yDilation - paddingTop;
+                    for (unsigned int xFilter = 0; xFilter < filterWidth; ++xFilter)
+                    {
+                        const unsigned int xInput = xOutput * xStride + xFilter * xDilation - paddingLeft;
+                        const bool inPadding = yInput >= inputHeight || xInput >= inputWidth;
+
+                        for (unsigned int cInput = 0; cInput < inputChannels; ++cInput)
+                        {
+                            const unsigned int patchIndex = isNhwc ?
+                                (yFilter * filterWidth + xFilter) * inputChannels + cInput :
+                                (cInput * filterHeight + yFilter) * filterWidth + xFilter;
+                            const unsigned int inputIndex = isNhwc ?
+                                (yInput * inputWidth + xInput) * inputChannels + cInput :
+                                (cInput * inputHeight + yInput) * inputWidth + xInput;
+                            patch[patchIndex] = inPadding ? int16_t(0) : inputValues[inputIndex];
+                        }
+                    }
+                }
+
+                for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+                {
+                    const unsigned int outputIndex = isNhwc ?
+                        pixel * outputChannels + cOutput :
+                        cOutput * outputPlaneSize + pixel;
+                    outputValues[outputIndex] = filter.MultiplyRow(cOutput, patch.data());
+                }
+            }
+        });
     }
 }
 
@@ -8,8 +8,10 @@
 #include "RefWorkloadUtils.hpp"
 #include "TensorBufferArrayView.hpp"
 #include "BaseIterator.hpp"
+#include "BlockCsrMatrix.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "QSymm16Kernels.hpp"
 
 #include <armnn/Tensor.hpp>
 
@@ -243,4 +245,37 @@ void Convolve(const TensorShape& rInputShape,
               unsigned int xDilation,
               unsigned int yDilation,
               bool depthwise = false);
+
+/// Performs a (non-depthwise) convolution with a filter in block-CSR form, one row per output channel holding its
+/// weights in the order of the filter tensor, and optionally adds a bias (if pBiasDecoder is not null).
+void ConvolveSparse(const TensorShape& rInputShape,
+                    Decoder<float>& rInputDecoder,
+                    const TensorShape& rOutputShape,
+                    Encoder<float>& rOutputEncoder,
+                    const TensorShape& rFilterShape,
+                    const BlockCsrMatrix& filter,
+                    Decoder<float>* pBiasDecoder,
+                    DataLayout dataLayout,
+                    unsigned int paddingTop,
+                    unsigned int paddingLeft,
+                    unsigned int xStride,
+                    unsigned int yStride,
+                    unsigned int xDilation,
+                    unsigned int yDilation);
+
+/// Performs a (non-depthwise) convolution of QuantisedSymm16 values in integer arithmetic, with a filter prepared
+/// by MakeQSymm16MatrixMultiplier, one row per output channel holding its weights in the order of the filter tensor.
+void ConvolveQSymm16(const TensorShape& rInputShape,
+                     const int16_t* pInput,
+                     const TensorShape& rOutputShape,
+                     int16_t* pOutput,
+                     const TensorShape& rFilterShape,
+                     const QSymm16MatrixMultiplier& filter,
+                     DataLayout dataLayout,
+                     unsigned int paddingTop,
+                     unsigned int paddingLeft,
+                     unsigned int xStride,
+                     unsigned int yStride,
+                     unsigned int xDilation,
+                     unsigned int yDilation);
 } //namespace armnn
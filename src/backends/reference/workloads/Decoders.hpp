@@ -8,6 +8,8 @@
 #include "BaseIterator.hpp"
 #include "FloatingPointConverter.hpp"
 
+#include <TensorUtils.hpp>
+
 #include <boost/assert.hpp>
 
 namespace armnn
@@ -35,6 +37,18 @@ inline std::unique_ptr<Decoder<float>> MakeDecoder(const TensorInfo& info, const
                 info.GetQuantizationScale(),
                 info.GetQuantizationOffset());
         }
+        case DataType::QuantisedSymm8PerAxis:
+        {
+            std::pair<unsigned int, std::vector<float>> params = armnnUtils::GetPerAxisParams(info);
+            return std::make_unique<QSymm8PerAxisDecoder>(
+                static_cast<const int8_t*>(data),
+                params.second,
+                params.first);
+        }
+        case DataType::BFloat16:
+        {
+            return std::make_unique<BFloat16Decoder>(static_cast<const BFloat16*>(data));
+        }
         case DataType::Float16:
         {
             return std::make_unique<Float16Decoder>(static_cast<const Half*>(data));
@@ -45,6 +59,15 @@ inline std::unique_ptr<Decoder<float>> MakeDecoder(const TensorInfo& info, const
         }
         case DataType::Signed32:
         {
+            if (info.HasPerAxisQuantization())
+            {
+                // NOTE: ScaledInt32PerAxisDecoder is used for the biases of convolutions with per-axis weights
+                std::pair<unsigned int, std::vector<float>> params = armnnUtils::GetPerAxisParams(info);
+                return std::make_unique<ScaledInt32PerAxisDecoder>(
+                    static_cast<const int32_t*>(data),
+                    params.second,
+                    params.first);
+            }
             const float scale = info.GetQuantizationScale();
             if (scale == 0.f)
             {
@@ -4,6 +4,7 @@
 //
 
 #include "DetectionPostProcess.hpp"
+#include "ThreadPool.hpp"
 
 #include <armnn/ArmNN.hpp>
 
@@ -48,6 +49,29 @@ float IntersectionOverUnion(const float* boxI, const float* boxJ)
     return areaIntersection / areaUnion;
 }
 
+namespace
+{
+
+/// Same as IntersectionOverUnion, with the areas of the two boxes computed up front.
+float IntersectionOverUnion(const float* boxI, float areaI, const float* boxJ, float areaJ)
+{
+    // Box-corner format: ymin, xmin, ymax, xmax.
+    const int yMin = 0;
+    const int xMin = 1;
+    const int yMax = 2;
+    const int xMax = 3;
+    float yMinIntersection = std::max(boxI[yMin], boxJ[yMin]);
+    float xMinIntersection = std::max(boxI[xMin], boxJ[xMin]);
+    float yMaxIntersection = std::min(boxI[yMax], boxJ[yMax]);
+    float xMaxIntersection = std::min(boxI[xMax], boxJ[xMax]);
+    float areaIntersection = std::max(yMaxIntersection - yMinIntersection, 0.0f) *
+                                std::max(xMaxIntersection - xMinIntersection, 0.0f);
+    float areaUnion = areaI + areaJ - areaIntersection;
+    return areaIntersection / areaUnion;
+}
+
+} // anonymous namespace
+
 std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
                                             const std::vector<float>& boxCorners,
                                             const std::vector<float>& scores,
@@ -75,28 +99,36 @@ std::vector<unsigned int> NonMaxSuppression(unsigned int numBoxes,
     // Number of output cannot be more than max detections specified in the option.
     unsigned int numOutput = std::min(maxDetection, numAboveThreshold);
     std::vector<unsigned int> outputIndices;
-    std::vector<bool> visited(numAboveThreshold, false);
 
-    // Prune out the boxes with high intersection over union by keeping the box with higher score.
+    // Gathers the candidates in score order, with their areas.
+    std::vector<const float*> sortedBoxes(numAboveThreshold);
+    std::vector<float> sortedAreas(numAboveThreshold);
     for (unsigned int i = 0; i < numAboveThreshold; ++i)
     {
-        if (outputIndices.size() >= numOutput)
-        {
-            break;
-        }
-        if (!visited[sortedIndices[i]])
-        {
-            outputIndices.push_back(indicesAboveThreshold[sortedIndices[i]]);
-        }
-        for (unsigned int j = i + 1; j < numAboveThreshold; ++j)
+        const float* box = &boxCorners[indicesAboveThreshold[sortedIndices[i]] * 4];
+        sortedBoxes[i] = box;
+        sortedAreas[i] = (box[2] - box[0]) * (box[3] - box[1]);
+    }
+
+    // Prune out the boxes with high intersection over union by keeping the box with higher score.
+    // Every box with a higher score suppresses, whether or not it was suppressed itself, so a box is kept
+    // unless any of the boxes before it overlaps it: the search stops at the first one that does.
+    for (unsigned int j = 0; j < numAboveThreshold && outputIndices.size() < numOutput; ++j)
+    {
+        bool suppressed = false;
+        for (unsigned int i = 0; i < j; ++i)
         {
-            unsigned int iIndex = indicesAboveThreshold[sortedIndices[i]] * 4;
-            unsigned int jIndex = indicesAboveThreshold[sortedIndices[j]] * 4;
-            if (IntersectionOverUnion(&boxCorners[iIndex], &boxCorners[jIndex]) > nmsIouThreshold)
+            if (IntersectionOverUnion(sortedBoxes[i], sortedAreas[i], sortedBoxes[j], sortedAreas[j]) >
+                nmsIouThreshold)
             {
-                visited[sortedIndices[j]] = true;
+                suppressed = true;
+                break;
             }
         }
+        if (!suppressed)
+        {
+            outputIndices.push_back(indicesAboveThreshold[sortedIndices[j]]);
+        }
     }
     return outputIndices;
 }
@@ -155,54 +187,97 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
                           float* detectionScores,
                           float* numDetections)
 {
-    // Transform center-size format which is (ycenter, xcenter, height, width) to box-corner format,
-    // which represents the lower left corner and the upper right corner (ymin, xmin, ymax, xmax)
-    std::vector<float> boxCorners(boxEncodingsInfo.GetNumElements());
-
     const unsigned int numBoxes  = boxEncodingsInfo.GetShape()[1];
     const unsigned int numScores = scoresInfo.GetNumElements();
 
-    for (unsigned int i = 0; i < numBoxes; ++i)
+    unsigned int numClassesWithBg = desc.m_NumClasses + 1;
+
+    // Decode scores
+    std::vector<float> decodedScores(numScores);
+    const float* scoresValues = scores.DecodeChunk(decodedScores.data(), numScores);
+    if (scoresValues != decodedScores.data())
     {
-        // Y
-        float boxEncodingY = boxEncodings.Get();
-        float anchorY      = anchors.Get();
+        std::copy(scoresValues, scoresValues + numScores, decodedScores.begin());
+    }
 
-        ++boxEncodings;
-        ++anchors;
+    // Only the boxes that NMS can select are decoded, that is the ones with a score above the threshold.
+    std::vector<bool> boxIsCandidate(numBoxes, false);
 
-        // X
-        float boxEncodingX = boxEncodings.Get();
-        float anchorX      = anchors.Get();
+    // Fast NMS works on the max scores of the boxes, computed before the boxes are decoded.
+    unsigned int numClassesPerBox = std::min(desc.m_MaxClassesPerDetection, desc.m_NumClasses);
+    std::vector<float> maxScores;
+    std::vector<unsigned int> boxIndices;
+    std::vector<unsigned int> maxScoreClasses;
 
-        ++boxEncodings;
-        ++anchors;
+    if (desc.m_UseRegularNms)
+    {
+        for (unsigned int box = 0; box < numBoxes; ++box)
+        {
+            const float* boxScores = decodedScores.data() + box * numClassesWithBg + 1;
+            boxIsCandidate[box] = std::any_of(boxScores, boxScores + desc.m_NumClasses,
+                                              [&desc](float score) { return score >= desc.m_NmsScoreThreshold; });
+        }
+    }
+    else
+    {
+        // Select max scores of boxes.
+        std::vector<unsigned int> maxScoreIndices(desc.m_NumClasses);
+        for (unsigned int box = 0; box < numBoxes; ++box)
+        {
+            unsigned int scoreIndex = box * numClassesWithBg + 1;
 
-        // H
-        float boxEncodingH = boxEncodings.Get();
-        float anchorH      = anchors.Get();
+            // Get the max scores of the box.
+            std::iota(maxScoreIndices.begin(), maxScoreIndices.end(), 0);
+            TopKSort(numClassesPerBox, maxScoreIndices.data(),
+                decodedScores.data() + scoreIndex, desc.m_NumClasses);
 
-        ++boxEncodings;
-        ++anchors;
+            for (unsigned int i = 0; i < numClassesPerBox; ++i)
+            {
+                maxScores.push_back(decodedScores[scoreIndex + maxScoreIndices[i]]);
+                maxScoreClasses.push_back(maxScoreIndices[i]);
+                boxIndices.push_back(box);
+            }
+        }
 
-        // W
-        float boxEncodingW = boxEncodings.Get();
-        float anchorW      = anchors.Get();
+        // NMS compares the boxes at the first numBoxes indices of maxScores and outputs the boxes they map to.
+        for (unsigned int i = 0; i < numBoxes && i < maxScores.size(); ++i)
+        {
+            if (maxScores[i] >= desc.m_NmsScoreThreshold)
+            {
+                boxIsCandidate[i] = true;
+                boxIsCandidate[boxIndices[i]] = true;
+            }
+        }
+    }
 
-        ++boxEncodings;
-        ++anchors;
+    // Transform center-size format which is (ycenter, xcenter, height, width) to box-corner format,
+    // which represents the lower left corner and the upper right corner (ymin, xmin, ymax, xmax)
+    const unsigned int numBoxElements = numBoxes * 4;
+    std::vector<float> boxEncodingsBuffer(numBoxElements);
+    std::vector<float> anchorsBuffer(numBoxElements);
+    const float* boxEncodingsValues = boxEncodings.DecodeChunk(boxEncodingsBuffer.data(), numBoxElements);
+    const float* anchorsValues = anchors.DecodeChunk(anchorsBuffer.data(), numBoxElements);
 
-        float yCentre = boxEncodingY / desc.m_ScaleY * anchorH + anchorY;
-        float xCentre = boxEncodingX / desc.m_ScaleX * anchorW + anchorX;
+    std::vector<float> boxCorners(boxEncodingsInfo.GetNumElements(), 0.0f);
 
-        float halfH = 0.5f * expf(boxEncodingH / desc.m_ScaleH) * anchorH;
-        float halfW = 0.5f * expf(boxEncodingW / desc.m_ScaleW) * anchorW;
+    for (unsigned int i = 0; i < numBoxes; ++i)
+    {
+        if (!boxIsCandidate[i])
+        {
+            continue;
+        }
 
         unsigned int indexY = i * 4;
         unsigned int indexX = indexY + 1;
         unsigned int indexH = indexX + 1;
         unsigned int indexW = indexH + 1;
 
+        float yCentre = boxEncodingsValues[indexY] / desc.m_ScaleY * anchorsValues[indexH] + anchorsValues[indexY];
+        float xCentre = boxEncodingsValues[indexX] / desc.m_ScaleX * anchorsValues[indexW] + anchorsValues[indexX];
+
+        float halfH = 0.5f * expf(boxEncodingsValues[indexH] / desc.m_ScaleH) * anchorsValues[indexH];
+        float halfW = 0.5f * expf(boxEncodingsValues[indexW] / desc.m_ScaleW) * anchorsValues[indexW];
+
         // ymin
         boxCorners[indexY] = yCentre - halfH;
         // xmin
@@ -216,51 +291,45 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
         BOOST_ASSERT(boxCorners[indexX] < boxCorners[indexW]);
     }
 
-    unsigned int numClassesWithBg = desc.m_NumClasses + 1;
-
-    // Decode scores
-    std::vector<float> decodedScores;
-    decodedScores.reserve(numScores);
-
-    for (unsigned int i = 0u; i < numScores; ++i)
-    {
-        decodedScores.emplace_back(scores.Get());
-        ++scores;
-    }
-
     // Perform Non Max Suppression.
     if (desc.m_UseRegularNms)
     {
         // Perform Regular NMS.
         // For each class, perform NMS and select max detection numbers of the highest score across all classes.
-        std::vector<float> classScores(numBoxes);
+        std::vector<std::vector<unsigned int>> selectedIndicesPerClass(desc.m_NumClasses);
+        ParallelFor(0, desc.m_NumClasses, [&](unsigned int begin, unsigned int end)
+        {
+            std::vector<float> classScores(numBoxes);
+            for (unsigned int c = begin; c < end; ++c)
+            {
+                // For each boxes, get scores of the boxes for the class c.
+                for (unsigned int i = 0; i < numBoxes; ++i)
+                {
+                    classScores[i] = decodedScores[i * numClassesWithBg + c + 1];
+                }
+                selectedIndicesPerClass[c] = NonMaxSuppression(numBoxes,
+                                                               boxCorners,
+                                                               classScores,
+                                                               desc.m_NmsScoreThreshold,
+                                                               desc.m_DetectionsPerClass,
+                                                               desc.m_NmsIouThreshold);
+            }
+        });
 
         std::vector<unsigned int> selectedBoxesAfterNms;
         selectedBoxesAfterNms.reserve(numBoxes);
 
         std::vector<float> selectedScoresAfterNms;
-        selectedBoxesAfterNms.reserve(numScores);
+        selectedScoresAfterNms.reserve(numBoxes);
 
         std::vector<unsigned int> selectedClasses;
 
         for (unsigned int c = 0; c < desc.m_NumClasses; ++c)
         {
-            // For each boxes, get scores of the boxes for the class c.
-            for (unsigned int i = 0; i < numBoxes; ++i)
+            for (unsigned int selectedIndex : selectedIndicesPerClass[c])
             {
-                classScores[i] = decodedScores[i * numClassesWithBg + c + 1];
-            }
-            std::vector<unsigned int> selectedIndices = NonMaxSuppression(numBoxes,
-                                                                          boxCorners,
-                                                                          classScores,
-                                                                          desc.m_NmsScoreThreshold,
-                                                                          desc.m_DetectionsPerClass,
-                                                                          desc.m_NmsIouThreshold);
-
-            for (unsigned int i = 0; i < selectedIndices.size(); ++i)
-            {
-                selectedBoxesAfterNms.push_back(selectedIndices[i]);
-                selectedScoresAfterNms.push_back(classScores[selectedIndices[i]]);
+                selectedBoxesAfterNms.push_back(selectedIndex);
+                selectedScoresAfterNms.push_back(decodedScores[selectedIndex * numClassesWithBg + c + 1]);
                 selectedClasses.push_back(c);
             }
         }
@@ -280,31 +349,8 @@ void DetectionPostProcess(const TensorInfo& boxEncodingsInfo,
     else
     {
         // Perform Fast NMS.
-        // Select max scores of boxes and perform NMS on max scores,
+        // Perform NMS on the max scores of the boxes selected above,
         // select max detection numbers of the highest score
-        unsigned int numClassesPerBox = std::min(desc.m_MaxClassesPerDetection, desc.m_NumClasses);
-        std::vector<float> maxScores;
-        std::vector<unsigned int>boxIndices;
-        std::vector<unsigned int>maxScoreClasses;
-
-        for (unsigned int box = 0; box < numBoxes; ++box)
-        {
-            unsigned int scoreIndex = box * numClassesWithBg + 1;
-
-            // Get the max scores of the box.
-            std::vector<unsigned int> maxScoreIndices = GenerateRangeK(desc.m_NumClasses);
-            TopKSort(numClassesPerBox, maxScoreIndices.data(),
-                decodedScores.data() + scoreIndex, desc.m_NumClasses);
-
-            for (unsigned int i = 0; i < numClassesPerBox; ++i)
-            {
-                maxScores.push_back(decodedScores[scoreIndex + maxScoreIndices[i]]);
-                maxScoreClasses.push_back(maxScoreIndices[i]);
-                boxIndices.push_back(box);
-            }
-        }
-
-        // Perform NMS on max scores
         std::vector<unsigned int> selectedIndices = NonMaxSuppression(numBoxes, boxCorners, maxScores,
                                                                       desc.m_NmsScoreThreshold,
                                                                       desc.m_MaxDetections,
@@ -7,6 +7,8 @@
 
 #include "BaseIterator.hpp"
 
+#include <TensorUtils.hpp>
+
 #include <boost/assert.hpp>
 
 namespace armnn
@@ -34,10 +36,22 @@ inline std::unique_ptr<Encoder<float>> MakeEncoder(const TensorInfo& info, void*
                 info.GetQuantizationScale(),
                 info.GetQuantizationOffset());
         }
+        case armnn::DataType::QuantisedSymm8PerAxis:
+        {
+            std::pair<unsigned int, std::vector<float>> params = armnnUtils::GetPerAxisParams(info);
+            return std::make_unique<QSymm8PerAxisEncoder>(
+                static_cast<int8_t*>(data),
+                params.second,
+                params.first);
+        }
         case armnn::DataType::Signed32:
         {
             return std::make_unique<Int32Encoder>(static_cast<int32_t*>(data));
         }
+        case armnn::DataType::BFloat16:
+        {
+            return std::make_unique<BFloat16Encoder>(static_cast<BFloat16*>(data));
+        }
         case armnn::DataType::Float16:
         {
             return std::make_unique<Float16Encoder>(static_cast<Half*>(data));
@@ -6,9 +6,14 @@
 #include "FullyConnected.hpp"
 
 #include "RefWorkloadUtils.hpp"
+#include "ThreadPool.hpp"
 
 #include <boost/assert.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 namespace armnn
 {
 
@@ -25,10 +30,18 @@ void FullyConnected(const TensorShape& rInputShape,
     // Perform FullyConnected implementation
     unsigned int outputSize = rOutputShape[1];
 
-    for (unsigned int n = 0; n < rInputShape[0]; n++)
+    ParallelFor(0, rInputShape[0] * outputSize, [&](unsigned int begin, unsigned int end)
     {
-        for (unsigned int channelOutput = 0; channelOutput < outputSize; channelOutput++)
+        std::unique_ptr<Decoder<float>> inputDecoder  = rInputDecoder.Clone();
+        std::unique_ptr<Decoder<float>> weightDecoder = rWeightDecoder.Clone();
+        std::unique_ptr<Decoder<float>> biasDecoder   = biasEnabled ? rBiasDecoder.Clone() : nullptr;
+        std::unique_ptr<Encoder<float>> outputEncoder = rOutputEncoder.Clone();
+
+        for (unsigned int index = begin; index < end; ++index)
         {
+            const unsigned int n             = index / outputSize;
+            const unsigned int channelOutput = index % outputSize;
+
             float outval = 0.f;
 
             for (unsigned int channelInput = 0; channelInput < K; channelInput++)
@@ -36,29 +49,104 @@ void FullyConnected(const TensorShape& rInputShape,
                 float weight;
                 if (transposeWeights)
                 {
-                    rWeightDecoder[channelOutput * K + channelInput];
-                    weight = rWeightDecoder.Get();
+                    (*weightDecoder)[channelOutput * K + channelInput];
+                    weight = weightDecoder->Get();
                 }
                 else
                 {
-                    rWeightDecoder[channelInput * outputSize + channelOutput];
-                    weight = rWeightDecoder.Get();
+                    (*weightDecoder)[channelInput * outputSize + channelOutput];
+                    weight = weightDecoder->Get();
                 }
 
-                rInputDecoder[n * K + channelInput];
-                outval += weight * rInputDecoder.Get();
+                (*inputDecoder)[n * K + channelInput];
+                outval += weight * inputDecoder->Get();
             }
 
             if (biasEnabled)
             {
-                rBiasDecoder[channelOutput];
-                outval += rBiasDecoder.Get();
+                (*biasDecoder)[channelOutput];
+                outval += biasDecoder->Get();
             }
 
-            rOutputEncoder[n * outputSize + channelOutput];
-            rOutputEncoder.Set(outval);
+            (*outputEncoder)[n * outputSize + channelOutput];
+            outputEncoder->Set(outval);
+        }
+    });
+}
+
+void FullyConnectedSparse(const TensorShape& rInputShape,
+                          Decoder<float>& rInputDecoder,
+                          const TensorShape& rOutputShape,
+                          Encoder<float>& rOutputEncoder,
+                          const BlockCsrMatrix& weights,
+                          Decoder<float>* pBiasDecoder)
+{
+    const unsigned int numBatches = rInputShape[0];
+    const unsigned int outputSize = rOutputShape[1];
+    const unsigned int K          = weights.GetNumColumns();
+    const unsigned int paddedK    = weights.GetNumPaddedColumns();
+    BOOST_ASSERT(weights.GetNumRows() == outputSize);
+
+    // Decodes the whole input up front, each row zero-padded to a whole number of blocks.
+    std::vector<float> inputBuffer(numBatches * K);
+    rInputDecoder[0];
+    const float* inputValues = rInputDecoder.DecodeChunk(inputBuffer.data(), numBatches * K);
+
+    std::vector<float> input(numBatches * paddedK, 0.0f);
+    for (unsigned int n = 0; n < numBatches; ++n)
+    {
+        std::copy(inputValues + n * K, inputValues + (n + 1) * K, input.begin() + n * paddedK);
+    }
+
+    std::vector<float> bias(outputSize, 0.0f);
+    if (pBiasDecoder)
+    {
+        (*pBiasDecoder)[0];
+        const float* biasValues = pBiasDecoder->DecodeChunk(bias.data(), outputSize);
+        if (biasValues != bias.data())
+        {
+            std::copy(biasValues, biasValues + outputSize, bias.begin());
         }
     }
+
+    const unsigned int numOutputs = numBatches * outputSize;
+    std::vector<float> outputBuffer(numOutputs);
+    rOutputEncoder[0];
+    float* outputValues = rOutputEncoder.GetChunkBuffer(outputBuffer.data());
+
+    ParallelFor(0, numOutputs, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int index = begin; index < end; ++index)
+        {
+            const unsigned int n             = index / outputSize;
+            const unsigned int channelOutput = index % outputSize;
+            outputValues[index] = weights.MultiplyRow(channelOutput, input.data() + n * paddedK) + bias[channelOutput];
+        }
+    });
+
+    rOutputEncoder.EncodeChunk(outputValues, numOutputs);
+}
+
+void FullyConnectedQSymm16(const TensorShape& rInputShape,
+                           const int16_t* pInput,
+                           const TensorShape& rOutputShape,
+                           int16_t* pOutput,
+                           const QSymm16MatrixMultiplier& weights)
+{
+    const unsigned int numBatches = rInputShape[0];
+    const unsigned int outputSize = rOutputShape[1];
+    const unsigned int K          = weights.GetNumColumns();
+    BOOST_ASSERT(weights.GetNumRows() == outputSize);
+
+    ParallelFor(0, numBatches * outputSize, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int index = begin; index < end; ++index)
+        {
+            const unsigned int n             = index / outputSize;
+            const unsigned int channelOutput = index % outputSize;
+            pOutput[index] = weights.MultiplyRow(channelOutput, pInput + n * K);
+        }
+    });
 }
 
 } //namespace armnn
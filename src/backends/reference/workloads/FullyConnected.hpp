@@ -6,8 +6,10 @@
 #pragma once
 
 #include "BaseIterator.hpp"
+#include "BlockCsrMatrix.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "QSymm16Kernels.hpp"
 #include <armnn/Tensor.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
@@ -25,4 +27,21 @@ void FullyConnected(const TensorShape& rInputShape,
                     unsigned int K,
                     bool transposeWeights);
 
+/// Performs a matrix multiplication with weights in block-CSR form, one row per output channel, and optionally
+/// adds a bias (if pBiasDecoder is not null).
+void FullyConnectedSparse(const TensorShape& rInputShape,
+                          Decoder<float>& rInputDecoder,
+                          const TensorShape& rOutputShape,
+                          Encoder<float>& rOutputEncoder,
+                          const BlockCsrMatrix& weights,
+                          Decoder<float>* pBiasDecoder);
+
+/// Performs a matrix multiplication of QuantisedSymm16 values in integer arithmetic, with weights prepared by
+/// MakeQSymm16MatrixMultiplier, one row per output channel.
+void FullyConnectedQSymm16(const TensorShape& rInputShape,
+                           const int16_t* pInput,
+                           const TensorShape& rOutputShape,
+                           int16_t* pOutput,
+                           const QSymm16MatrixMultiplier& weights);
+
 } //namespace armnn
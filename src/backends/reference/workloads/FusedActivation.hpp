@@ -0,0 +1,126 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Activation.hpp"
+#include "BaseIterator.hpp"
+
+#include <backendsCommon/WorkloadData.hpp>
+
+#include <boost/assert.hpp>
+#include <boost/core/ignore_unused.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+namespace armnn
+{
+
+/// Encoder applying an activation fused into the workload to every value before passing it on to the
+/// wrapped encoder. With a Float32 output the values are computed straight into the output tensor and
+/// activated in place, while still in cache.
+class FusedActivationEncoder : public Encoder<float>
+{
+public:
+    FusedActivationEncoder(std::unique_ptr<Encoder<float>> encoder, const ActivationDescriptor& activation)
+        : m_Encoder(std::move(encoder)), m_Activation(activation) {}
+
+    void Reset(void* data) override
+    {
+        m_Encoder->Reset(data);
+    }
+
+    FusedActivationEncoder& operator++() override
+    {
+        ++(*m_Encoder);
+        return *this;
+    }
+
+    FusedActivationEncoder& operator+=(const unsigned int increment) override
+    {
+        *m_Encoder += increment;
+        return *this;
+    }
+
+    FusedActivationEncoder& operator-=(const unsigned int increment) override
+    {
+        *m_Encoder -= increment;
+        return *this;
+    }
+
+    FusedActivationEncoder& operator[](const unsigned int index) override
+    {
+        (*m_Encoder)[index];
+        return *this;
+    }
+
+    void Set(float right) override
+    {
+        m_Encoder->Set(Activation(right, m_Activation.m_Function, m_Activation.m_A, m_Activation.m_B));
+    }
+
+    float Get() const override
+    {
+        return m_Encoder->Get();
+    }
+
+    float* GetChunkBuffer(float* buffer) override
+    {
+        return m_Encoder->GetChunkBuffer(buffer);
+    }
+
+    void EncodeChunk(const float* values, unsigned int numElements) override
+    {
+        unsigned int done = 0;
+        while (done < numElements)
+        {
+            const unsigned int chunkSize = std::min(numElements - done, g_IteratorChunkSize);
+            float* activated = m_Encoder->GetChunkBuffer(m_Buffer.data());
+
+            Activation(values + done, activated, chunkSize,
+                       m_Activation.m_Function, m_Activation.m_A, m_Activation.m_B);
+            m_Encoder->EncodeChunk(activated, chunkSize);
+
+            *m_Encoder += chunkSize;
+            done += chunkSize;
+        }
+        *m_Encoder -= numElements;
+    }
+
+    std::unique_ptr<Encoder<float>> Clone() const override
+    {
+        return std::make_unique<FusedActivationEncoder>(m_Encoder->Clone(), m_Activation);
+    }
+
+private:
+    std::unique_ptr<Encoder<float>> m_Encoder;
+    const ActivationDescriptor m_Activation;
+    std::array<float, g_IteratorChunkSize> m_Buffer;
+};
+
+/// Returns the encoder for the output of a workload, wrapped so that it applies the activation fused
+/// into the workload if there is one.
+inline std::unique_ptr<Encoder<float>> MakeFusedActivationEncoder(std::unique_ptr<Encoder<float>> encoder,
+                                                                  const QueueDescriptor& descriptor)
+{
+    if (!descriptor.m_FusedActivation.has_value())
+    {
+        return encoder;
+    }
+    return std::make_unique<FusedActivationEncoder>(std::move(encoder), descriptor.m_FusedActivation.value());
+}
+
+/// Activations are never fused into workloads producing booleans.
+inline std::unique_ptr<Encoder<bool>> MakeFusedActivationEncoder(std::unique_ptr<Encoder<bool>> encoder,
+                                                                 const QueueDescriptor& descriptor)
+{
+    BOOST_ASSERT(!descriptor.m_FusedActivation.has_value());
+    boost::ignore_unused(descriptor);
+    return encoder;
+}
+
+} //namespace armnn
@@ -9,8 +9,11 @@
 
 #include <backendsCommon/WorkloadData.hpp>
 
+#include <boost/core/ignore_unused.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <cstring>
+
 namespace armnn
 {
 
@@ -52,4 +55,37 @@ void Gather(const TensorInfo& paramsInfo,
     BOOST_ASSERT(outIndex == outputInfo.GetNumElements());
 }
 
+void Gather(const TensorInfo& paramsInfo,
+            const TensorInfo& indicesInfo,
+            const TensorInfo& outputInfo,
+            const void* params,
+            const int32_t* indices,
+            void* output)
+{
+    BOOST_ASSERT(paramsInfo.IsTypeSpaceMatch(outputInfo));
+    const TensorShape& paramsShape = paramsInfo.GetShape();
+
+    unsigned int paramsProduct = 1;
+    for (unsigned int i = 1; i < paramsInfo.GetNumDimensions(); ++i)
+    {
+        paramsProduct = paramsProduct * paramsShape[i];
+    }
+
+    const size_t sliceSize = paramsProduct * GetDataTypeSize(paramsInfo.GetDataType());
+    const unsigned char* paramsBytes = static_cast<const unsigned char*>(params);
+    unsigned char* outputBytes = static_cast<unsigned char*>(output);
+
+    for (unsigned int i = 0; i < indicesInfo.GetNumElements(); ++i)
+    {
+        unsigned int indx = boost::numeric_cast<unsigned int>(indices[i]);
+
+        BOOST_ASSERT(indices[i] >= 0 && indx < paramsShape[0]);
+
+        std::memcpy(outputBytes + i * sliceSize, paramsBytes + indx * sliceSize, sliceSize);
+    }
+
+    BOOST_ASSERT(indicesInfo.GetNumElements() * paramsProduct == outputInfo.GetNumElements());
+    boost::ignore_unused(outputInfo);
+}
+
 } //namespace armnn
@@ -21,4 +21,12 @@ void Gather(const TensorInfo& paramsInfo,
             const int32_t* indices,
             Encoder<float>& output);
 
+/// Gathers whole slices with memcpy. The params and output tensors must have the same data type and quantization.
+void Gather(const TensorInfo& paramsInfo,
+            const TensorInfo& indicesInfo,
+            const TensorInfo& outputInfo,
+            const void* params,
+            const int32_t* indices,
+            void* output);
+
 } //namespace armnn
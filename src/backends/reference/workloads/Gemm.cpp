@@ -0,0 +1,109 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Gemm.hpp"
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Size of the panels of B the product is computed over: 128 rows of 256 floats fit in a typical L2 cache,
+/// and a single row fits in L1 alongside the rows of C being updated.
+constexpr unsigned int g_GemmBlockK = 128;
+constexpr unsigned int g_GemmBlockN = 256;
+
+/// Updates four rows of C from a panel of B. Each row of B is loaded once for the four rows, and the inner loop
+/// over the columns is what the compiler vectorizes.
+void MicroKernel4(unsigned int numColumns,
+                  unsigned int depth,
+                  const float* A,
+                  unsigned int lda,
+                  const float* B,
+                  unsigned int ldb,
+                  float* C,
+                  unsigned int ldc)
+{
+    float* c0 = C;
+    float* c1 = C + ldc;
+    float* c2 = C + 2 * ldc;
+    float* c3 = C + 3 * ldc;
+
+    for (unsigned int k = 0; k < depth; ++k)
+    {
+        const float a0 = A[k];
+        const float a1 = A[lda + k];
+        const float a2 = A[2 * lda + k];
+        const float a3 = A[3 * lda + k];
+        const float* b = B + k * ldb;
+
+        for (unsigned int j = 0; j < numColumns; ++j)
+        {
+            const float bj = b[j];
+            c0[j] += a0 * bj;
+            c1[j] += a1 * bj;
+            c2[j] += a2 * bj;
+            c3[j] += a3 * bj;
+        }
+    }
+}
+
+void MicroKernel1(unsigned int numColumns,
+                  unsigned int depth,
+                  const float* A,
+                  const float* B,
+                  unsigned int ldb,
+                  float* C)
+{
+    for (unsigned int k = 0; k < depth; ++k)
+    {
+        const float a = A[k];
+        const float* b = B + k * ldb;
+
+        for (unsigned int j = 0; j < numColumns; ++j)
+        {
+            C[j] += a * b[j];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void Gemm(unsigned int M,
+          unsigned int N,
+          unsigned int K,
+          const float* A,
+          unsigned int lda,
+          const float* B,
+          unsigned int ldb,
+          float* C,
+          unsigned int ldc)
+{
+    for (unsigned int n0 = 0; n0 < N; n0 += g_GemmBlockN)
+    {
+        const unsigned int numColumns = std::min(g_GemmBlockN, N - n0);
+
+        for (unsigned int k0 = 0; k0 < K; k0 += g_GemmBlockK)
+        {
+            const unsigned int depth = std::min(g_GemmBlockK, K - k0);
+            const float* panel = B + k0 * ldb + n0;
+
+            unsigned int m = 0;
+            for (; m + 4 <= M; m += 4)
+            {
+                MicroKernel4(numColumns, depth, A + m * lda + k0, lda, panel, ldb, C + m * ldc + n0, ldc);
+            }
+            for (; m < M; ++m)
+            {
+                MicroKernel1(numColumns, depth, A + m * lda + k0, panel, ldb, C + m * ldc + n0);
+            }
+        }
+    }
+}
+
+} //namespace armnn
@@ -0,0 +1,24 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+namespace armnn
+{
+
+/// Accumulates the product of two row-major matrices: C[M x N] += A[M x K] * B[K x N].
+/// lda, ldb and ldc are the distances, in elements, between consecutive rows of A, B and C.
+/// The work is blocked so that a panel of B stays in cache while four rows of C are updated from it.
+void Gemm(unsigned int M,
+          unsigned int N,
+          unsigned int K,
+          const float* A,
+          unsigned int lda,
+          const float* B,
+          unsigned int ldb,
+          float* C,
+          unsigned int ldc);
+
+} //namespace armnn
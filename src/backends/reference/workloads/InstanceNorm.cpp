@@ -10,7 +10,9 @@
 
 #include <DataLayoutIndexed.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 namespace armnn
 {
@@ -33,54 +35,74 @@ void InstanceNorm(const InstanceNormalizationQueueDescriptor& data,
     float eps   = data.m_Parameters.m_Eps;
     float gamma = data.m_Parameters.m_Gamma;
 
+    const unsigned int planeSize = inputHeight * inputWidth;
+    const unsigned int numElements = inputInfo.GetNumElements();
+
+    // NCHW holds the values of a channel next to each other, NHWC holds them inputChannels apart.
+    const bool isNchw = data.m_Parameters.m_DataLayout == DataLayout::NCHW;
+    const unsigned int channelStride = isNchw ? planeSize : 1;
+    const unsigned int pixelStride   = isNchw ? 1 : inputChannels;
+
+    std::vector<float> inputBuffer(numElements);
+    std::vector<float> outputBuffer(numElements);
+    inputDecoder[0];
+    outputEncoder[0];
+    const float* input = inputDecoder.DecodeChunk(inputBuffer.data(), numElements);
+    float* output = outputEncoder.GetChunkBuffer(outputBuffer.data());
+
+    std::vector<float> mean(inputChannels);
+    std::vector<float> m2(inputChannels);
     for (unsigned int n = 0; n < inputBatches; ++n)
     {
-        for (unsigned int c = 0; c < inputChannels; ++c)
+        const float* batchInput = input + n * planeSize * inputChannels;
+        float* batchOutput = output + n * planeSize * inputChannels;
+
+        // Calculate Mean and Variance in a single pass with Welford's algorithm. The values are visited in memory
+        // order: one channel at a time for NCHW, all channels of a pixel at a time for NHWC.
+        std::fill(mean.begin(), mean.end(), 0.0f);
+        std::fill(m2.begin(), m2.end(), 0.0f);
+        auto accumulate = [&](unsigned int c, unsigned int p)
         {
-            float mean = 0, var = 0;
-
-            //Calculate Mean
-            for (unsigned int h = 0; h < inputHeight; h++)
+            const float value = batchInput[p * pixelStride + c * channelStride];
+            const float delta = value - mean[c];
+            mean[c] += delta / static_cast<float>(p + 1);
+            m2[c] += delta * (value - mean[c]);
+        };
+        if (isNchw)
+        {
+            for (unsigned int c = 0; c < inputChannels; ++c)
             {
-                for (unsigned int w = 0; w < inputWidth; w++)
+                for (unsigned int p = 0; p < planeSize; ++p)
                 {
-                    unsigned int index = dataLayout.GetIndex(inputShape, n, c, h, w);
-
-                    inputDecoder[index];
-                    float value = inputDecoder.Get();
-                    mean += value;
+                    accumulate(c, p);
                 }
             }
-            mean /= static_cast<float>(inputHeight * inputWidth);
-
-            //Calculate Variance
-            for (unsigned int h = 0; h < inputHeight; h++)
+        }
+        else
+        {
+            for (unsigned int p = 0; p < planeSize; ++p)
             {
-                for (unsigned int w = 0; w < inputWidth; w++)
+                for (unsigned int c = 0; c < inputChannels; ++c)
                 {
-                    unsigned int index = dataLayout.GetIndex(inputShape, n, c, h, w);
-
-                    inputDecoder[index];
-                    float value = inputDecoder.Get();
-                    var += (value - mean) * (value - mean);
+                    accumulate(c, p);
                 }
             }
-            var /= static_cast<float>(inputHeight * inputWidth);
+        }
 
-            // Apply Instance Normalisation
-            for (unsigned int h = 0; h < inputHeight; ++h)
+        // Apply Instance Normalisation
+        for (unsigned int c = 0; c < inputChannels; ++c)
+        {
+            const float var = m2[c] / static_cast<float>(planeSize);
+            const float scale = gamma / std::sqrt(var + eps);
+            for (unsigned int p = 0; p < planeSize; ++p)
             {
-                for (unsigned int w = 0; w < inputWidth; ++w)
-                {
-                    unsigned int index = dataLayout.GetIndex(inputShape, n, c, h, w);
-                    inputDecoder[index];
-                    outputEncoder[index];
-                    outputEncoder.Set((inputDecoder.Get() - mean) * gamma /  std::sqrt ( var + eps) + beta);
-                }
-
+                const unsigned int index = p * pixelStride + c * channelStride;
+                batchOutput[index] = (batchInput[index] - mean[c]) * scale + beta;
             }
         }
     }
+
+    outputEncoder.EncodeChunk(output, numElements);
 }
 
 } // namespace armnn
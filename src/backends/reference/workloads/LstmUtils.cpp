@@ -9,6 +9,9 @@
 #include "BaseIterator.hpp"
 #include <backendsCommon/CpuTensorHandle.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 
 // Helper functions ported from the Android code base
 // Refer to: android/external/tensorflow/tensorflow/contrib/lite/kernels/internal/reference/portable_tensor_utils.cc
@@ -296,6 +299,128 @@ void SetActivationParameters(uint32_t activation,
     }
 }
 
+void PackedMatrixBatchVectorMultiplyAccumulate(const float* packedMatrix,
+                                               uint32_t mRows,
+                                               uint32_t mCols,
+                                               const float* vector,
+                                               uint32_t nBatch,
+                                               float* outResult)
+{
+    for (uint32_t b = 0; b < nBatch; b++)
+    {
+        const float* batchVector = vector + b * mCols;
+        float* batchResult = outResult + b * mRows;
+        for (uint32_t c = 0; c < mCols; c++)
+        {
+            const float value = batchVector[c];
+            const float* column = packedMatrix + c * mRows;
+            for (uint32_t r = 0; r < mRows; r++)
+            {
+                batchResult[r] += column[r] * value;
+            }
+        }
+    }
+}
+
+void MeanStddevNormalization(const float* inputVector,
+                             float* outputVector,
+                             uint32_t vSize,
+                             uint32_t nBatch,
+                             float normalizationEpsilon)
+{
+    for (uint32_t batch = 0; batch < nBatch; ++batch)
+    {
+        const float* input = inputVector + batch * vSize;
+        float* output = outputVector + batch * vSize;
+
+        float sum = 0.0f;
+        float sumSq = 0.0f;
+        for (uint32_t i = 0; i < vSize; ++i)
+        {
+            sum += input[i];
+            sumSq += input[i] * input[i];
+        }
+
+        const float mean = sum / static_cast<float>(vSize);
+        const float variance = sumSq / static_cast<float>(vSize) - mean * mean;
+        const float stddevInv = 1.0f / std::sqrt(variance == 0 ? normalizationEpsilon : variance);
+
+        for (uint32_t i = 0; i < vSize; ++i)
+        {
+            output[i] = (input[i] - mean) * stddevInv;
+        }
+    }
+}
+
+void VectorBatchVectorAssign(const float* vector,
+                             uint32_t vSize,
+                             uint32_t nBatch,
+                             float* outBatchVector)
+{
+    for (uint32_t b = 0; b < nBatch; b++)
+    {
+        std::copy(vector, vector + vSize, outBatchVector + b * vSize);
+    }
+}
+
+void VectorBatchVectorAdd(const float* vector,
+                          uint32_t vSize,
+                          const float* batchVector,
+                          uint32_t nBatch,
+                          float* outResult)
+{
+    for (uint32_t b = 0; b < nBatch; b++)
+    {
+        for (uint32_t v = 0; v < vSize; v++)
+        {
+            outResult[b * vSize + v] = batchVector[b * vSize + v] + vector[v];
+        }
+    }
+}
+
+void VectorVectorCwiseProduct(const float* vector1,
+                              const float* vector2,
+                              uint32_t vSize,
+                              float* outResult)
+{
+    for (uint32_t v = 0; v < vSize; v++)
+    {
+        outResult[v] = vector1[v] * vector2[v];
+    }
+}
+
+void VectorVectorCwiseProductAccumulate(const float* vector1,
+                                        const float* vector2,
+                                        uint32_t vSize,
+                                        float* outResult)
+{
+    for (uint32_t v = 0; v < vSize; v++)
+    {
+        outResult[v] += vector1[v] * vector2[v];
+    }
+}
+
+void Sub1Vector(const float* vector,
+                uint32_t vSize,
+                float* outResult)
+{
+    for (uint32_t v = 0; v < vSize; v++)
+    {
+        outResult[v] = 1.0f - vector[v];
+    }
+}
+
+void ClipVector(const float* vector,
+                uint32_t vSize,
+                float absLimit,
+                float* outResult)
+{
+    for (uint32_t v = 0; v < vSize; v++)
+    {
+        outResult[v] = Clip(vector[v], absLimit);
+    }
+}
+
 std::unique_ptr<armnn::ScopedCpuTensorHandle> AssignScopedCpuTensorHandle(const armnn::ConstCpuTensorHandle* ptr)
 {
     if (!ptr)
@@ -85,4 +85,52 @@ void SetActivationParameters(uint32_t activation,
                              float& outA,
                              float& outB);
 
+// Overloads operating on contiguous, already decoded float data. The loops carry no iterator bookkeeping so the
+// compiler is free to vectorise them.
+
+// packedMatrix holds an mRows x mCols matrix in column-major order, so that each input value is accumulated into
+// all rows of a batch with one contiguous multiply-add.
+void PackedMatrixBatchVectorMultiplyAccumulate(const float* packedMatrix,
+                                               uint32_t mRows,
+                                               uint32_t mCols,
+                                               const float* vector,
+                                               uint32_t nBatch,
+                                               float* outResult);
+
+void MeanStddevNormalization(const float* inputVector,
+                             float* outputVector,
+                             uint32_t vSize,
+                             uint32_t nBatch,
+                             float normalizationEpsilon);
+
+void VectorBatchVectorAssign(const float* vector,
+                             uint32_t vSize,
+                             uint32_t nBatch,
+                             float* outBatchVector);
+
+void VectorBatchVectorAdd(const float* vector,
+                          uint32_t vSize,
+                          const float* batchVector,
+                          uint32_t nBatch,
+                          float* outResult);
+
+void VectorVectorCwiseProduct(const float* vector1,
+                              const float* vector2,
+                              uint32_t vSize,
+                              float* outResult);
+
+void VectorVectorCwiseProductAccumulate(const float* vector1,
+                                        const float* vector2,
+                                        uint32_t vSize,
+                                        float* outResult);
+
+void Sub1Vector(const float* vector,
+                uint32_t vSize,
+                float* outResult);
+
+void ClipVector(const float* vector,
+                uint32_t vSize,
+                float absLimit,
+                float* outResult);
+
 std::unique_ptr<armnn::ScopedCpuTensorHandle> AssignScopedCpuTensorHandle(const armnn::ConstCpuTensorHandle* ptr);
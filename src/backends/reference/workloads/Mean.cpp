@@ -4,67 +4,12 @@
 //
 
 #include "Mean.hpp"
-#include "backendsCommon/WorkloadData.hpp"
+#include "Reduce.hpp"
 
+#include <boost/assert.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
-#include <cmath>
-#include <cstddef>
-#include <functional>
-#include <limits>
-
-namespace armnn
-{
-bool NextIndex(const unsigned int numDims, const armnn::TensorShape& dims, std::vector<unsigned int>& current)
-{
-    unsigned int carry = 1;
-
-    for (unsigned int idx = numDims; idx-- > 0; )
-    {
-        unsigned int current_val = current[idx] + carry;
-        if (dims[idx] == current_val)
-        {
-            current[idx] = 0;
-        }
-        else
-        {
-            current[idx] = current_val;
-            carry = 0;
-            break;
-        }
-    }
-    return (carry == 0);
-}
-
-unsigned int ReducedOutputOffset(const unsigned int numDims,
-                                 const armnn::TensorShape& dims,
-                                 std::vector<unsigned int>& index,
-                                 const unsigned int numAxis,
-                                 const std::vector<unsigned int>& axis)
-{
-    unsigned int offset = 0;
-    for (unsigned int idx = 0; idx < numDims; ++idx)
-    {
-        bool isAxis = false;
-        if (!axis.empty())
-        {
-            for (unsigned int axisIdx = 0; axisIdx < numAxis; ++axisIdx)
-            {
-                if (idx == axis[axisIdx])
-                {
-                    isAxis = true;
-                    break;
-                }
-            }
-        }
-        if (!isAxis)
-        {
-            offset = offset * dims[idx] + index[idx];
-        }
-    }
-    return offset;
-}
-} // namespace
+#include <algorithm>
 
 namespace armnn
 {
@@ -74,70 +19,33 @@ void Mean(const armnn::TensorInfo& inputInfo,
           Decoder<float>& input,
           Encoder<float>& output)
 {
+    const unsigned int numInputs = inputInfo.GetNumElements();
+    const unsigned int numOutputs = outputInfo.GetNumElements();
 
-    unsigned int inputNumDims = inputInfo.GetNumDimensions();
-    unsigned int outputNumDims = outputInfo.GetNumDimensions();
+    const ReductionShape shape = CanonicalizeReduction(inputInfo.GetShape(), axis);
+    BOOST_ASSERT(numInputs == 0 || numOutputs * shape.m_NumReduced == numInputs);
 
-    armnn::TensorShape outputDims = outputInfo.GetShape();
-    armnn::TensorShape inputDims = inputInfo.GetShape();
+    std::vector<float> inputBuffer(numInputs);
+    std::vector<float> outputBuffer(numOutputs);
 
-    // Initialise output data.
-    unsigned int numOutputs = 1;
-    for (unsigned int idx = 0; idx < outputNumDims; ++idx)
-    {
-        numOutputs *= outputDims[idx];
-    }
+    input[0];
+    output[0];
+    const float* inputValues = input.DecodeChunk(inputBuffer.data(), numInputs);
+    float* outputValues = output.GetChunkBuffer(outputBuffer.data());
 
-    std::vector<float> tempSum(numOutputs);
-    for (unsigned int idx = 0; idx < numOutputs; ++idx)
-    {
-        output[idx];
-        output.Set(0.0f);
-        tempSum[idx] = 0.0f;
-    }
-
-    // Initialise temp index.
-    std::vector<unsigned int> tempIndex(inputNumDims);
-    for (unsigned int idx = 0; idx < inputNumDims; ++idx)
-    {
-        tempIndex[idx] = 0;
-    }
-
-    std::vector<unsigned int> resolvedAxis = axis;
-    if (resolvedAxis.empty())
-    {
-      for (unsigned int idx = 0; idx < inputNumDims; ++idx)
-      {
-          resolvedAxis.push_back(idx);
-      }
-    }
-    auto numResolvedAxis = boost::numeric_cast<unsigned int>(resolvedAxis.size());
-
-    // Iterates through input_data and sum up the reduced axis.
-    for (bool hasNext = true; hasNext; hasNext = NextIndex(inputNumDims, inputDims, tempIndex))
-    {
-        unsigned int inputOffset = ReducedOutputOffset(inputNumDims, inputDims, tempIndex, 0, {});
-        unsigned int outputOffset = ReducedOutputOffset(inputNumDims, inputDims, tempIndex,
-                                                        numResolvedAxis, resolvedAxis);
-        input[inputOffset];
-        tempSum[outputOffset] += input.Get();
-    }
+    // Sums up the reduced axes.
+    std::fill(outputValues, outputValues + numOutputs, 0.0f);
+    Reduce(shape, inputValues, outputValues, [](float sum, float value) { return sum + value; });
 
     // Takes average by num of elements added to get mean.
-    size_t numElementsInAxis = 1;
-    for (unsigned int idx = 0; idx < numResolvedAxis; ++idx)
+    if (shape.m_NumReduced > 0)
     {
-        unsigned int current = inputDims[resolvedAxis[idx]];
-        BOOST_ASSERT(boost::numeric_cast<float>(current) <
-              (std::numeric_limits<float>::max() / boost::numeric_cast<float>(numElementsInAxis)));
-        numElementsInAxis *= current;
-    }
-    if (numElementsInAxis > 0) {
+        const float numElementsInAxis = boost::numeric_cast<float>(shape.m_NumReduced);
         for (unsigned int idx = 0; idx < numOutputs; ++idx)
         {
-            output[idx];
-            output.Set(tempSum[idx] / boost::numeric_cast<float>(numElementsInAxis));
+            outputValues[idx] = outputValues[idx] / numElementsInAxis;
         }
     }
+    output.EncodeChunk(outputValues, numOutputs);
 }
 } //namespace armnn
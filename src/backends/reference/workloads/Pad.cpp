@@ -9,6 +9,7 @@
 #include "Encoders.hpp"
 
 #include <boost/numeric/conversion/cast.hpp>
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <functional>
@@ -51,10 +52,7 @@ void Pad(const TensorInfo& inputInfo,
 
     T convertedPadValue = static_cast<T>(padValue);
 
-    for (unsigned int i = 0; i < numOutputElements; ++i)
-    {
-       outData[i] = convertedPadValue;
-    }
+    std::fill(outData, outData + numOutputElements, convertedPadValue);
 
     switch(numInputDimensions) {
 
@@ -62,10 +60,7 @@ void Pad(const TensorInfo& inputInfo,
 
             inputWidth = inputShape[0];
 
-            for (unsigned int w = 0; w < inputWidth ; w++)
-            {
-                outData[w+std::get<0>(m_padList[0])] = inputData[w];
-            }
+            std::copy(inputData, inputData + inputWidth, outData + std::get<0>(m_padList[0]));
 
             break;
 
@@ -78,11 +73,9 @@ void Pad(const TensorInfo& inputInfo,
 
             for (unsigned int h = 0; h < inputHeight; h++)
             {
-                for (unsigned int w = 0; w < inputWidth ; w++)
-                {
-                    outData[(h+std::get<0>(m_padList[0]))*outputWidth
-                    + (w+std::get<0>(m_padList[1]))] = inputData[h * inputWidth + w];
-                }
+                const T* inputRow = inputData + h * inputWidth;
+                std::copy(inputRow, inputRow + inputWidth,
+                          outData + (h+std::get<0>(m_padList[0]))*outputWidth + std::get<0>(m_padList[1]));
             }
 
             break;
@@ -100,14 +93,11 @@ void Pad(const TensorInfo& inputInfo,
             {
                 for (unsigned int h = 0; h < inputHeight; h++)
                 {
-                    for (unsigned int w = 0; w < inputWidth ; w++)
-                    {
-                        outData[(c+std::get<0>(m_padList[0]))*outputHeight*outputWidth
-                        + (h+std::get<0>(m_padList[1]))*outputWidth
-                        + (w+std::get<0>(m_padList[2]))] = inputData[c * inputHeight * inputWidth
-                                                                      + h * inputWidth
-                                                                      + w];
-                    }
+                    const T* inputRow = inputData + c * inputHeight * inputWidth + h * inputWidth;
+                    std::copy(inputRow, inputRow + inputWidth,
+                              outData + (c+std::get<0>(m_padList[0]))*outputHeight*outputWidth
+                                      + (h+std::get<0>(m_padList[1]))*outputWidth
+                                      + std::get<0>(m_padList[2]));
                 }
             }
 
@@ -129,17 +119,14 @@ void Pad(const TensorInfo& inputInfo,
                 {
                     for (unsigned int h = 0; h < inputHeight; h++)
                     {
-                        for (unsigned int w = 0; w < inputWidth ; w++)
-                        {
-                            outData[(b+std::get<0>(m_padList[0])) * outputChannels * outputHeight * outputWidth
-                                   + (c+std::get<0>(m_padList[1])) * outputHeight * outputWidth
-                                   + (h+std::get<0>(m_padList[2])) * outputWidth
-                                   + (w+std::get<0>(m_padList[3]))] = inputData[b * inputChannels * inputHeight
-                                                                                * inputWidth
-                                                                             + c * inputHeight * inputWidth
-                                                                             + h * inputWidth
-                                                                             + w];
-                        }
+                        const T* inputRow = inputData + b * inputChannels * inputHeight * inputWidth
+                                                      + c * inputHeight * inputWidth
+                                                      + h * inputWidth;
+                        std::copy(inputRow, inputRow + inputWidth,
+                                  outData + (b+std::get<0>(m_padList[0])) * outputChannels * outputHeight * outputWidth
+                                          + (c+std::get<0>(m_padList[1])) * outputHeight * outputWidth
+                                          + (h+std::get<0>(m_padList[2])) * outputWidth
+                                          + std::get<0>(m_padList[3]));
                     }
                 }
             }
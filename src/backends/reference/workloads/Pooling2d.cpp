@@ -5,107 +5,50 @@
 
 #include "Pooling2d.hpp"
 #include "DataLayoutIndexed.hpp"
+#include "ThreadPool.hpp"
+
+#include <TensorUtils.hpp>
 
 #include <armnn/Exceptions.hpp>
 #include <armnn/Types.hpp>
 
 #include <boost/numeric/conversion/cast.hpp>
 
-#include <limits>
 #include <algorithm>
-#include <functional>
+#include <cmath>
+#include <limits>
+#include <vector>
 
 namespace
 {
-    using PoolingAlgorithm = armnn::PoolingAlgorithm;
+    using PaddingMethod = armnn::PaddingMethod;
 
-    float DefaultInitializer(PoolingAlgorithm algorithm)
+    // Each pooling algorithm reduces input values into an accumulator (Accumulate), merges partial accumulators
+    // (Combine) and turns the final accumulator into the output value (Execute). Keeping these as static members
+    // of small structs lets the pooling loops below be instantiated once per algorithm without indirect calls.
+    struct MaxPooling
     {
-        switch (algorithm)
-        {
-            case PoolingAlgorithm::Max:
-            {
-                return std::numeric_limits<float>::lowest();
-            }
-            case PoolingAlgorithm::Average:
-            case PoolingAlgorithm::L2:
-            {
-                return 0.0f;
-            }
-            default:
-            {
-                throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
-            }
-        }
-    }
-
-    using Accumulator = std::function<void(float & accu, float value)>;
+        static float DefaultInitializer() { return std::numeric_limits<float>::lowest(); }
+        static float Accumulate(float accu, float value) { return std::max(accu, value); }
+        static float Combine(float accu, float partial) { return std::max(accu, partial); }
+        static float Execute(float accumulated, float) { return accumulated; }
+    };
 
-    Accumulator GetAccumulator(PoolingAlgorithm algorithm)
+    struct AveragePooling
     {
-        switch (algorithm)
-        {
-            case PoolingAlgorithm::Max:
-            {
-                return [](float & accu, float value) {
-                    if (value > accu) {
-                        accu = value;
-                    }
-                };
-            }
+        static float DefaultInitializer() { return 0.0f; }
+        static float Accumulate(float accu, float value) { return accu + value; }
+        static float Combine(float accu, float partial) { return accu + partial; }
+        static float Execute(float accumulated, float kernelSize) { return accumulated / kernelSize; }
+    };
 
-            case PoolingAlgorithm::Average:
-            {
-                return [](float & accu, float value) {
-                    accu += value;
-                };
-            }
-
-            case PoolingAlgorithm::L2:
-            {
-                return [](float & accu, float value) {
-                    accu += (value*value);
-                };
-            }
-
-            default:
-            {
-                throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
-            }
-        }
-    }
-
-    using Executor = std::function<void(float & accumulated, float kernelSize)>;
-
-    Executor GetExecutor(PoolingAlgorithm algorithm)
+    struct L2Pooling
     {
-        switch (algorithm)
-        {
-            case PoolingAlgorithm::Max:
-            {
-                return [](float & accumulated, float kernelSize) {};
-            }
-
-            case PoolingAlgorithm::Average:
-            {
-                return [](float & accumulated, float kernelSize) {
-                    accumulated /= kernelSize;
-                };
-            }
-
-            case PoolingAlgorithm::L2:
-            {
-                return [](float & accumulated, float kernelSize) {
-                    accumulated = sqrtf(accumulated / kernelSize);
-                };
-            }
-
-            default:
-            {
-                throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
-            }
-        }
-    }
+        static float DefaultInitializer() { return 0.0f; }
+        static float Accumulate(float accu, float value) { return accu + value * value; }
+        static float Combine(float accu, float partial) { return accu + partial; }
+        static float Execute(float accumulated, float kernelSize) { return sqrtf(accumulated / kernelSize); }
+    };
 
     bool OnPaddingOnly(int start, int end, int maxRange, int padding)
     {
@@ -133,6 +76,143 @@ namespace
             return false;
         }
     }
+
+    /// The pooling window along one spatial dimension for a given output coordinate.
+    struct PoolingWindow
+    {
+        unsigned int m_Start;     ///< First input coordinate inside the tensor.
+        unsigned int m_End;       ///< One past the last input coordinate inside the tensor.
+        int m_Size;               ///< Window size including padding, before clamping to the tensor.
+        bool m_Clamped;           ///< Whether the window had to be clamped to the tensor.
+        bool m_OnPaddingOnly;     ///< Whether the window is considered to cover padding only.
+    };
+
+    /// Precomputes the windows for every output coordinate along one dimension, so that the padding handling is
+    /// done once per row/column instead of once per output element.
+    std::vector<PoolingWindow> ComputeWindows(int outputSize, int inputSize, int poolSize, int stride,
+                                              int padBefore, int padAfter)
+    {
+        std::vector<PoolingWindow> windows(boost::numeric_cast<unsigned int>(outputSize));
+        for (int i = 0; i < outputSize; ++i)
+        {
+            int start = (i * stride) - padBefore;
+            int end   = start + poolSize;
+
+            // Clamp the pooling region inside the valid input area (which includes the padding).
+            // This is necessary because the final pooling in a row may overlap beyond the padding.
+            end = std::min(end, inputSize + padAfter);
+
+            PoolingWindow& window  = windows[boost::numeric_cast<unsigned int>(i)];
+            window.m_Size          = end - start;
+            window.m_OnPaddingOnly = OnPaddingOnly(start, end, inputSize, padAfter);
+            window.m_Clamped       = ClampRange(start, end, inputSize);
+            window.m_Start         = boost::numeric_cast<unsigned int>(start);
+            window.m_End           = boost::numeric_cast<unsigned int>(end);
+        }
+        return windows;
+    }
+
+    /// Pools one batch. The data is viewed as numPlanes planes of [height][width][numInner] values: NCHW has one
+    /// plane per channel and numInner = 1, NHWC has a single plane with numInner = channels, so that for NHWC
+    /// the innermost loops run contiguously across channels.
+    /// The window is separable: each input row is first reduced horizontally for every output column into
+    /// rowBuffer, then those partial results are reduced vertically, which costs poolHeight + poolWidth
+    /// operations per output instead of poolHeight * poolWidth.
+    /// Only the output rows [rowBegin, rowEnd) of each plane are computed, reading the input rows they cover.
+    template <typename Pooling>
+    void PoolBatch(const float* input,
+                   float* output,
+                   std::vector<float>& rowBuffer,
+                   unsigned int numPlanes,
+                   unsigned int numInner,
+                   unsigned int heightInput,
+                   unsigned int widthInput,
+                   const std::vector<PoolingWindow>& rowWindows,
+                   const std::vector<PoolingWindow>& columnWindows,
+                   unsigned int rowBegin,
+                   unsigned int rowEnd,
+                   PaddingMethod paddingMethod)
+    {
+        const unsigned int heightOutput = boost::numeric_cast<unsigned int>(rowWindows.size());
+        const unsigned int widthOutput  = boost::numeric_cast<unsigned int>(columnWindows.size());
+
+        rowBuffer.resize(heightInput * widthOutput * numInner);
+
+        // The windows only move forward as the output row grows.
+        const unsigned int yBegin = rowWindows[rowBegin].m_Start;
+        const unsigned int yEnd   = rowWindows[rowEnd - 1].m_End;
+
+        for (unsigned int plane = 0; plane < numPlanes; ++plane)
+        {
+            const float* inputPlane = input + plane * heightInput * widthInput * numInner;
+            float* outputPlane      = output + plane * heightOutput * widthOutput * numInner;
+
+            // Horizontal pass.
+            for (unsigned int y = yBegin; y < yEnd; ++y)
+            {
+                for (unsigned int xOutput = 0; xOutput < widthOutput; ++xOutput)
+                {
+                    const PoolingWindow& window = columnWindows[xOutput];
+                    float* partial = rowBuffer.data() + (y * widthOutput + xOutput) * numInner;
+
+                    std::fill_n(partial, numInner, Pooling::DefaultInitializer());
+                    for (unsigned int x = window.m_Start; x < window.m_End; ++x)
+                    {
+                        const float* values = inputPlane + (y * widthInput + x) * numInner;
+                        for (unsigned int i = 0; i < numInner; ++i)
+                        {
+                            partial[i] = Pooling::Accumulate(partial[i], values[i]);
+                        }
+                    }
+                }
+            }
+
+            // Vertical pass.
+            for (unsigned int yOutput = rowBegin; yOutput < rowEnd; ++yOutput)
+            {
+                const PoolingWindow& rowWindow = rowWindows[yOutput];
+                for (unsigned int xOutput = 0; xOutput < widthOutput; ++xOutput)
+                {
+                    const PoolingWindow& columnWindow = columnWindows[xOutput];
+                    float* result = outputPlane + (yOutput * widthOutput + xOutput) * numInner;
+
+                    std::fill_n(result, numInner, Pooling::DefaultInitializer());
+                    for (unsigned int y = rowWindow.m_Start; y < rowWindow.m_End; ++y)
+                    {
+                        const float* partial = rowBuffer.data() + (y * widthOutput + xOutput) * numInner;
+                        for (unsigned int i = 0; i < numInner; ++i)
+                        {
+                            result[i] = Pooling::Combine(result[i], partial[i]);
+                        }
+                    }
+
+                    // Special case: when the pooling kernel is over a padding region and the padding
+                    //               size is larger or equal to the kernel and the kernel only covers
+                    //               padding and no real values, then we initialize the result as zero
+                    //               by convention. This is because we need to choose a value here and
+                    //               all values we have are padding, which we ignore.
+                    const float initialValue = (rowWindow.m_OnPaddingOnly || columnWindow.m_OnPaddingOnly) ?
+                                               0.0f : Pooling::DefaultInitializer();
+
+                    float poolAreaSize = boost::numeric_cast<float>(rowWindow.m_Size * columnWindow.m_Size);
+                    if ((rowWindow.m_Clamped || columnWindow.m_Clamped) && paddingMethod == PaddingMethod::Exclude)
+                    {
+                        // When we exclude the padding, it means we calculate with a smaller
+                        // kernel size, so I changed the divisor here.
+                        poolAreaSize = boost::numeric_cast<float>(
+                            (boost::numeric_cast<int>(rowWindow.m_End) - boost::numeric_cast<int>(rowWindow.m_Start)) *
+                            (boost::numeric_cast<int>(columnWindow.m_End) -
+                             boost::numeric_cast<int>(columnWindow.m_Start)));
+                    }
+
+                    for (unsigned int i = 0; i < numInner; ++i)
+                    {
+                        result[i] = Pooling::Execute(Pooling::Combine(initialValue, result[i]), poolAreaSize);
+                    }
+                }
+            }
+        }
+    }
 }
 
 using namespace armnnUtils;
@@ -165,11 +245,6 @@ void Pooling2d(Decoder<float>& rInputDecoder,
     const int poolHeight   = boost::numeric_cast<int>(params.m_PoolHeight);
     const int poolWidth    = boost::numeric_cast<int>(params.m_PoolWidth);
 
-    float defaultInitializer = DefaultInitializer(params.m_PoolType);
-
-    Accumulator accumulate = GetAccumulator(params.m_PoolType);
-    Executor execute       = GetExecutor(params.m_PoolType);
-
     TensorShape outputShape = outputInfo.GetShape();
     TensorShape inputShape =  inputInfo.GetShape();
 
@@ -181,78 +256,76 @@ void Pooling2d(Decoder<float>& rInputDecoder,
         throw armnn::InvalidArgumentException("Unsupported padding type");
     }
 
-    for (int n = 0; n < batchSize; n++)
+    using PoolBatchFunction = void (*)(const float*, float*, std::vector<float>&, unsigned int, unsigned int,
+                                       unsigned int, unsigned int, const std::vector<PoolingWindow>&,
+                                       const std::vector<PoolingWindow>&, unsigned int, unsigned int,
+                                       PaddingMethod);
+    PoolBatchFunction poolBatch = nullptr;
+    switch (params.m_PoolType)
     {
-        for (int c = 0; c < channels; c++)
+        case PoolingAlgorithm::Max:
         {
-            for (int yOutput = 0; yOutput < heightOutput; yOutput++)
-            {
-                for (int xOutput = 0; xOutput < widthOutput; xOutput++)
-                {
-                    int hstart = (yOutput * strideY) - padTop;
-                    int wstart = (xOutput * strideX) - padLeft;
-                    int hend = hstart + poolHeight;
-                    int wend = wstart + poolWidth;
-
-                    // Clamp the pooling region inside the valid input area (which includes the padding).
-                    // This is necessary because the final pooling in a row may overlap beyond the padding.
-                    hend = std::min(hend, heightInput + padBottom);
-                    wend = std::min(wend, widthInput + padRight);
-
-                    float result = defaultInitializer;
-                    float poolAreaSize = boost::numeric_cast<float>((hend - hstart) * (wend - wstart));
-
-                    // Special case: when the pooling kernel is over a padding region and the padding
-                    //               size is larger or equal to the kernel and the kernel only covers
-                    //               padding and no real values, then we initialize the result as zero
-                    //               by convention. This is because we need to choose a value here and
-                    //               all values we have are padding, which we ignore.
-                    if (OnPaddingOnly(hstart, hend, heightInput, padBottom) ||
-                        OnPaddingOnly(wstart, wend, widthInput, padRight))
-                    {
-                        result = 0.0f;
-                    }
-
-                    bool clamped = ClampRange(wstart, wend, widthInput);
-                    clamped |= ClampRange(hstart, hend, heightInput);
+            poolBatch = &PoolBatch<MaxPooling>;
+            break;
+        }
+        case PoolingAlgorithm::Average:
+        {
+            poolBatch = &PoolBatch<AveragePooling>;
+            break;
+        }
+        case PoolingAlgorithm::L2:
+        {
+            poolBatch = &PoolBatch<L2Pooling>;
+            break;
+        }
+        default:
+        {
+            throw armnn::InvalidArgumentException("Unsupported pooling algorithm");
+        }
+    }
 
-                    if (clamped && params.m_PaddingMethod == PaddingMethod::Exclude)
-                    {
-                        // When we exclude the padding, it means we calculate with a smaller
-                        // kernel size, so I changed the divisor here.
-                        poolAreaSize = boost::numeric_cast<float>((hend - hstart) * (wend - wstart));
-                    }
+    const std::vector<PoolingWindow> rowWindows =
+        ComputeWindows(heightOutput, heightInput, poolHeight, strideY, padTop, padBottom);
+    const std::vector<PoolingWindow> columnWindows =
+        ComputeWindows(widthOutput, widthInput, poolWidth, strideX, padLeft, padRight);
 
-                    for (auto yInput = hstart; yInput < hend; yInput++)
-                    {
-                        for (auto xInput = wstart; xInput < wend; xInput++)
-                        {
-                            unsigned int inputIndex = dataLayout.GetIndex(inputShape,
-                                                                          boost::numeric_cast<unsigned int>(n),
-                                                                          boost::numeric_cast<unsigned int>(c),
-                                                                          boost::numeric_cast<unsigned int>(yInput),
-                                                                          boost::numeric_cast<unsigned int>(xInput));
+    const bool isNhwc = params.m_DataLayout == DataLayout::NHWC;
+    const unsigned int numPlanes = isNhwc ? 1u : boost::numeric_cast<unsigned int>(channels);
+    const unsigned int numInner  = isNhwc ? boost::numeric_cast<unsigned int>(channels) : 1u;
 
-                            rInputDecoder[inputIndex];
-                            float inval = rInputDecoder.Get();
+    // Each batch is decoded and encoded in one go, so the pooling loops below work on plain float buffers.
+    const unsigned int inputBatchSize  = GetNumElementsBetween(inputShape, 1, inputShape.GetNumDimensions());
+    const unsigned int outputBatchSize = GetNumElementsBetween(outputShape, 1, outputShape.GetNumDimensions());
 
-                            accumulate(result, inval);
-                        }
-                    }
+    std::vector<float> inputBuffer(inputBatchSize);
+    std::vector<float> outputBuffer(outputBatchSize);
 
-                    execute(result, poolAreaSize);
+    for (int n = 0; n < batchSize; n++)
+    {
+        rInputDecoder[boost::numeric_cast<unsigned int>(n) * inputBatchSize];
+        rOutputEncoder[boost::numeric_cast<unsigned int>(n) * outputBatchSize];
 
-                    unsigned int outputIndex = dataLayout.GetIndex(outputShape,
-                                                                   boost::numeric_cast<unsigned int>(n),
-                                                                   boost::numeric_cast<unsigned int>(c),
-                                                                   boost::numeric_cast<unsigned int>(yOutput),
-                                                                   boost::numeric_cast<unsigned int>(xOutput));
+        const float* inputValues = rInputDecoder.DecodeChunk(inputBuffer.data(), inputBatchSize);
+        float* outputValues      = rOutputEncoder.GetChunkBuffer(outputBuffer.data());
 
-                    rOutputEncoder[outputIndex];
-                    rOutputEncoder.Set(result);
-                }
-            }
-        }
+        ParallelFor(0, boost::numeric_cast<unsigned int>(heightOutput), [&](unsigned int rowBegin, unsigned int rowEnd)
+        {
+            std::vector<float> rowBuffer;
+            poolBatch(inputValues,
+                      outputValues,
+                      rowBuffer,
+                      numPlanes,
+                      numInner,
+                      boost::numeric_cast<unsigned int>(heightInput),
+                      boost::numeric_cast<unsigned int>(widthInput),
+                      rowWindows,
+                      columnWindows,
+                      rowBegin,
+                      rowEnd,
+                      params.m_PaddingMethod);
+        });
+
+        rOutputEncoder.EncodeChunk(outputValues, outputBatchSize);
     }
 }
 
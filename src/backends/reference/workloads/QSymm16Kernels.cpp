@@ -0,0 +1,541 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "QSymm16Kernels.hpp"
+
+#include "Activation.hpp"
+#include "BaseIterator.hpp"
+#include "Broadcast.hpp"
+#include "ThreadPool.hpp"
+
+#include <TensorUtils.hpp>
+
+#include <boost/assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+namespace armnn
+{
+
+namespace
+{
+
+constexpr int32_t g_Int16Min = std::numeric_limits<int16_t>::lowest();
+
+/// Number of distinct int16 values, and so of entries in the tables indexed by them.
+constexpr unsigned int g_NumInt16Values = 1u << 16;
+
+/// Largest shift of the fixed-point multipliers of QSymm16Elementwise: the products they multiply hold up to 30
+/// bits, so larger ones could overflow int64.
+constexpr int g_MaxElementwiseShift = 62;
+
+int16_t ClampToInt16(double value, int16_t min, int16_t max)
+{
+    return static_cast<int16_t>(std::min(std::max(value, static_cast<double>(min)), static_cast<double>(max)));
+}
+
+int16_t ClampToInt16(int64_t value, int16_t min, int16_t max)
+{
+    return static_cast<int16_t>(std::min<int64_t>(std::max<int64_t>(value, min), max));
+}
+
+/// Divides by 2^shift, rounding half away from zero like std::round.
+int64_t RoundingShiftRight(int64_t value, int shift)
+{
+    if (shift == 0)
+    {
+        return value;
+    }
+    const int64_t half = int64_t(1) << (shift - 1);
+    return value >= 0 ? (value + half) >> shift : -((half - value) >> shift);
+}
+
+template <typename Accumulator>
+Accumulator DotProduct(const int16_t* lhs, const int16_t* rhs, unsigned int numElements)
+{
+    Accumulator sum = 0;
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        sum += static_cast<Accumulator>(lhs[i]) * static_cast<Accumulator>(rhs[i]);
+    }
+    return sum;
+}
+
+/// Decoder and encoder of int16 values, as they are: the integer kernels read and write the quantized values.
+class Int16Decoder : public TypedIterator<const int16_t, Decoder<int16_t>>
+{
+public:
+    Int16Decoder(const int16_t* data)
+        : TypedIterator(data) {}
+
+    int16_t Get() const override
+    {
+        return *m_Iterator;
+    }
+
+    const int16_t* DecodeChunk(int16_t*, unsigned int) const override
+    {
+        return m_Iterator;
+    }
+
+    std::unique_ptr<Decoder<int16_t>> Clone() const override
+    {
+        return std::make_unique<Int16Decoder>(*this);
+    }
+};
+
+class Int16Encoder : public TypedIterator<int16_t, Encoder<int16_t>>
+{
+public:
+    Int16Encoder(int16_t* data)
+        : TypedIterator(data) {}
+
+    void Set(int16_t right) override
+    {
+        *m_Iterator = right;
+    }
+
+    int16_t Get() const override
+    {
+        return *m_Iterator;
+    }
+
+    int16_t* GetChunkBuffer(int16_t*) override
+    {
+        return m_Iterator;
+    }
+
+    void EncodeChunk(const int16_t* values, unsigned int numElements) override
+    {
+        if (values != m_Iterator)
+        {
+            std::copy(values, values + numElements, m_Iterator);
+        }
+    }
+
+    std::unique_ptr<Encoder<int16_t>> Clone() const override
+    {
+        return std::make_unique<Int16Encoder>(*this);
+    }
+};
+
+/// Returns whether a tensor is quantized per tensor, or per axis with one scale for each of numRows rows along
+/// outputChannelDim.
+bool HasRowScales(const TensorInfo& info, unsigned int numRows, unsigned int outputChannelDim)
+{
+    return !info.HasPerAxisQuantization() ||
+           (info.GetQuantizationDim().value() == outputChannelDim && info.GetQuantizationScales().size() == numRows);
+}
+
+} // anonymous namespace
+
+bool IsQSymm16Tensor(const TensorInfo& info)
+{
+    return info.GetDataType() == DataType::QuantisedSymm16 && info.GetQuantizationOffset() == 0 &&
+           !info.HasPerAxisQuantization() && info.GetQuantizationScale() > 0.0f;
+}
+
+bool GetQSymm16OutputBounds(const Optional<ActivationDescriptor>& fusedActivation,
+                            const TensorInfo& outputInfo,
+                            int16_t& min,
+                            int16_t& max)
+{
+    const float scale = outputInfo.GetQuantizationScale();
+    const int32_t offset = outputInfo.GetQuantizationOffset();
+
+    min = std::numeric_limits<int16_t>::lowest();
+    max = std::numeric_limits<int16_t>::max();
+    if (!fusedActivation.has_value())
+    {
+        return true;
+    }
+
+    const ActivationDescriptor& activation = fusedActivation.value();
+    switch (activation.m_Function)
+    {
+        case ActivationFunction::ReLu:
+            min = Quantize<int16_t>(0.0f, scale, offset);
+            return true;
+        case ActivationFunction::BoundedReLu:
+            min = Quantize<int16_t>(activation.m_B, scale, offset);
+            max = Quantize<int16_t>(activation.m_A, scale, offset);
+            return min <= max;
+        default:
+            return false;
+    }
+}
+
+QSymm16MatrixMultiplier::QSymm16MatrixMultiplier(const ConstCpuTensorHandle& weights,
+                                                 unsigned int numRows,
+                                                 unsigned int numColumns,
+                                                 unsigned int rowStride,
+                                                 unsigned int columnStride,
+                                                 const ConstCpuTensorHandle* pBias,
+                                                 const TensorInfo& inputInfo,
+                                                 const TensorInfo& outputInfo,
+                                                 int16_t outputMin,
+                                                 int16_t outputMax)
+    : m_NumRows(numRows)
+    , m_NumColumns(numColumns)
+    , m_Weights(numRows * numColumns)
+    , m_UseInt32Accumulators(true)
+    , m_Multipliers(numRows)
+    , m_Biases(numRows, 0.0)
+    , m_OutputMin(outputMin)
+    , m_OutputMax(outputMax)
+{
+    const TensorInfo& weightInfo = weights.GetTensorInfo();
+    const void* weightData = weights.GetConstTensor<void>();
+
+    // Weights are stored without their zero point, which only QuantisedAsymm8 ones have
+    const int32_t weightOffset = weightInfo.GetDataType() == DataType::QuantisedAsymm8 ?
+                                 weightInfo.GetQuantizationOffset() : 0;
+    const auto getWeight = [&](unsigned int index) -> int32_t
+    {
+        switch (weightInfo.GetDataType())
+        {
+            case DataType::QuantisedAsymm8:
+                return static_cast<const uint8_t*>(weightData)[index];
+            case DataType::QuantisedSymm8PerAxis:
+                return static_cast<const int8_t*>(weightData)[index];
+            default:
+                return static_cast<const int16_t*>(weightData)[index];
+        }
+    };
+
+    // The largest input magnitude is 2^15, so a row whose weights add up to at most 2^16 in magnitude cannot
+    // overflow an int32 accumulator
+    constexpr int64_t maxInt32AbsWeightSum = std::numeric_limits<int32_t>::max() / (int64_t(1) << 15);
+
+    for (unsigned int row = 0; row < numRows; ++row)
+    {
+        int64_t absWeightSum = 0;
+        for (unsigned int column = 0; column < numColumns; ++column)
+        {
+            const int32_t weight = getWeight(row * rowStride + column * columnStride) - weightOffset;
+            m_Weights[row * numColumns + column] = static_cast<int16_t>(weight);
+            absWeightSum += std::abs(weight);
+        }
+        m_UseInt32Accumulators = m_UseInt32Accumulators && absWeightSum <= maxInt32AbsWeightSum;
+    }
+
+    const double inputScale = inputInfo.GetQuantizationScale();
+    const double outputScale = outputInfo.GetQuantizationScale();
+    for (unsigned int row = 0; row < numRows; ++row)
+    {
+        const float weightScale = weightInfo.HasPerAxisQuantization() ? weightInfo.GetQuantizationScales()[row] :
+                                                                        weightInfo.GetQuantizationScale();
+        m_Multipliers[row] = inputScale * weightScale / outputScale;
+    }
+
+    if (pBias)
+    {
+        const TensorInfo& biasInfo = pBias->GetTensorInfo();
+        const int32_t* biasData = pBias->GetConstTensor<int32_t>();
+        for (unsigned int row = 0; row < numRows; ++row)
+        {
+            const float biasScale = biasInfo.HasPerAxisQuantization() ? biasInfo.GetQuantizationScales()[row] :
+                                                                        biasInfo.GetQuantizationScale();
+            m_Biases[row] = biasData[row] * static_cast<double>(biasScale) / outputScale;
+        }
+    }
+}
+
+int16_t QSymm16MatrixMultiplier::MultiplyRow(unsigned int row, const int16_t* input) const
+{
+    const int16_t* weights = m_Weights.data() + row * m_NumColumns;
+    const double sum = m_UseInt32Accumulators ?
+                       static_cast<double>(DotProduct<int32_t>(weights, input, m_NumColumns)) :
+                       static_cast<double>(DotProduct<int64_t>(weights, input, m_NumColumns));
+    return ClampToInt16(std::round(sum * m_Multipliers[row] + m_Biases[row]), m_OutputMin, m_OutputMax);
+}
+
+std::unique_ptr<QSymm16MatrixMultiplier> MakeQSymm16MatrixMultiplier(
+    const TensorInfo& inputInfo,
+    const TensorInfo& outputInfo,
+    const ConstCpuTensorHandle& weights,
+    unsigned int numRows,
+    unsigned int numColumns,
+    unsigned int rowStride,
+    unsigned int columnStride,
+    unsigned int outputChannelDim,
+    const ConstCpuTensorHandle* pBias,
+    const Optional<ActivationDescriptor>& fusedActivation)
+{
+    if (!IsQSymm16Tensor(inputInfo) || !IsQSymm16Tensor(outputInfo) || weights.GetConstTensor<void>() == nullptr)
+    {
+        return nullptr;
+    }
+
+    const TensorInfo& weightInfo = weights.GetTensorInfo();
+    switch (weightInfo.GetDataType())
+    {
+        case DataType::QuantisedAsymm8:
+            break;
+        case DataType::QuantisedSymm8PerAxis:
+            if (!HasRowScales(weightInfo, numRows, outputChannelDim))
+            {
+                return nullptr;
+            }
+            break;
+        case DataType::QuantisedSymm16:
+            if (weightInfo.GetQuantizationOffset() != 0 || weightInfo.HasPerAxisQuantization())
+            {
+                return nullptr;
+            }
+            break;
+        default:
+            return nullptr;
+    }
+
+    if (pBias)
+    {
+        const TensorInfo& biasInfo = pBias->GetTensorInfo();
+        if (biasInfo.GetDataType() != DataType::Signed32 || pBias->GetConstTensor<void>() == nullptr ||
+            biasInfo.GetNumElements() != numRows ||
+            !HasRowScales(biasInfo, numRows, 0))
+        {
+            return nullptr;
+        }
+    }
+
+    int16_t outputMin;
+    int16_t outputMax;
+    if (!GetQSymm16OutputBounds(fusedActivation, outputInfo, outputMin, outputMax))
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<QSymm16MatrixMultiplier>(weights, numRows, numColumns, rowStride, columnStride, pBias,
+                                                     inputInfo, outputInfo, outputMin, outputMax);
+}
+
+bool QSymm16ActivationTable::IsSupported(const TensorInfo& inputInfo, const TensorInfo& outputInfo)
+{
+    return inputInfo.GetDataType() == DataType::QuantisedSymm16 && !inputInfo.HasPerAxisQuantization() &&
+           outputInfo.GetDataType() == DataType::QuantisedSymm16 && !outputInfo.HasPerAxisQuantization() &&
+           outputInfo.GetQuantizationScale() > 0.0f;
+}
+
+QSymm16ActivationTable::QSymm16ActivationTable(const TensorInfo& inputInfo,
+                                               const TensorInfo& outputInfo,
+                                               const ActivationDescriptor& descriptor)
+    : m_Table(g_NumInt16Values)
+{
+    BOOST_ASSERT(IsSupported(inputInfo, outputInfo));
+
+    std::vector<int16_t> inputs(g_NumInt16Values);
+    for (unsigned int i = 0; i < g_NumInt16Values; ++i)
+    {
+        inputs[i] = static_cast<int16_t>(g_Int16Min + static_cast<int32_t>(i));
+    }
+
+    QSymm16Decoder decoder(inputs.data(), inputInfo.GetQuantizationScale(), inputInfo.GetQuantizationOffset());
+    QSymm16Encoder encoder(m_Table.data(), outputInfo.GetQuantizationScale(), outputInfo.GetQuantizationOffset());
+    Activation(decoder,
+               encoder,
+               TensorInfo({ g_NumInt16Values }, DataType::QuantisedSymm16),
+               descriptor.m_Function,
+               descriptor.m_A,
+               descriptor.m_B);
+}
+
+void QSymm16ActivationTable::Execute(const int16_t* input, int16_t* output, unsigned int numElements) const
+{
+    ParallelFor(0, numElements, [&](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            output[i] = m_Table[static_cast<unsigned int>(input[i] - g_Int16Min)];
+        }
+    }, g_IteratorChunkSize);
+}
+
+bool QSymm16Softmax::IsSupported(const TensorInfo& inputInfo, const TensorInfo& outputInfo, float beta)
+{
+    return inputInfo.GetDataType() == DataType::QuantisedSymm16 && !inputInfo.HasPerAxisQuantization() &&
+           outputInfo.GetDataType() == DataType::QuantisedSymm16 && !outputInfo.HasPerAxisQuantization() &&
+           outputInfo.GetQuantizationScale() > 0.0f && beta > 0.0f;
+}
+
+QSymm16Softmax::QSymm16Softmax(const TensorInfo& inputInfo, const TensorInfo& outputInfo, float beta, int axis)
+    : m_OutputScale(outputInfo.GetQuantizationScale())
+    , m_OutputOffset(outputInfo.GetQuantizationOffset())
+{
+    BOOST_ASSERT(IsSupported(inputInfo, outputInfo, beta));
+
+    const unsigned int numDimensions = inputInfo.GetNumDimensions();
+    const unsigned int uAxis = axis < 0 ? numDimensions - static_cast<unsigned int>(std::abs(axis))
+                                        : static_cast<unsigned int>(axis);
+
+    const TensorShape& inputShape = inputInfo.GetShape();
+    m_OuterSize = armnnUtils::GetNumElementsBetween(inputShape, 0, uAxis);
+    m_AxisSize  = inputShape[uAxis];
+    m_InnerSize = armnnUtils::GetNumElementsBetween(inputShape, uAxis + 1, numDimensions);
+
+    // The table stops at the first difference whose exponential rounds to zero, as do all the following ones
+    const double step = static_cast<double>(beta) * inputInfo.GetQuantizationScale();
+    for (unsigned int d = 0; d < g_NumInt16Values; ++d)
+    {
+        const double value = std::round(std::exp(-step * d) * 2147483648.0);
+        if (value == 0.0)
+        {
+            break;
+        }
+        m_ExpTable.push_back(static_cast<uint32_t>(value));
+    }
+}
+
+void QSymm16Softmax::Execute(const int16_t* input, int16_t* output) const
+{
+    const unsigned int numRows = m_OuterSize * m_InnerSize;
+    const auto tableSize = static_cast<unsigned int>(m_ExpTable.size());
+
+    ParallelFor(0, numRows, [&](unsigned int begin, unsigned int end)
+    {
+        std::vector<uint32_t> exps(m_AxisSize);
+
+        for (unsigned int row = begin; row < end; ++row)
+        {
+            const unsigned int outer = row / m_InnerSize;
+            const unsigned int inner = row % m_InnerSize;
+            const int16_t* in = input + outer * m_AxisSize * m_InnerSize + inner;
+            int16_t* out = output + outer * m_AxisSize * m_InnerSize + inner;
+
+            int16_t maxValue = g_Int16Min;
+            for (unsigned int i = 0; i < m_AxisSize; ++i)
+            {
+                maxValue = std::max(maxValue, in[i * m_InnerSize]);
+            }
+
+            uint64_t sum = 0;
+            for (unsigned int i = 0; i < m_AxisSize; ++i)
+            {
+                const auto difference = static_cast<unsigned int>(maxValue - in[i * m_InnerSize]);
+                exps[i] = difference < tableSize ? m_ExpTable[difference] : 0u;
+                sum += exps[i];
+            }
+
+            // The maximum contributes 2^31 to the sum, which is never zero
+            const double factor = 1.0 / (static_cast<double>(sum) * m_OutputScale);
+            for (unsigned int i = 0; i < m_AxisSize; ++i)
+            {
+                out[i * m_InnerSize] = ClampToInt16(std::round(exps[i] * factor) + m_OutputOffset,
+                                                    std::numeric_limits<int16_t>::lowest(),
+                                                    std::numeric_limits<int16_t>::max());
+            }
+        }
+    });
+}
+
+bool QSymm16Elementwise::IsSupported(QSymm16ElementwiseOperation operation,
+                                     const TensorInfo& inputInfo0,
+                                     const TensorInfo& inputInfo1,
+                                     const TensorInfo& outputInfo)
+{
+    if (!IsQSymm16Tensor(inputInfo0) || !IsQSymm16Tensor(inputInfo1) || !IsQSymm16Tensor(outputInfo))
+    {
+        return false;
+    }
+
+    // The multipliers hold 31 bits, so the largest factor must be below 2^31
+    const double outputScale = outputInfo.GetQuantizationScale();
+    const double maxFactor = operation == QSymm16ElementwiseOperation::Multiplication ?
+        static_cast<double>(inputInfo0.GetQuantizationScale()) * inputInfo1.GetQuantizationScale() / outputScale :
+        std::max(inputInfo0.GetQuantizationScale(), inputInfo1.GetQuantizationScale()) / outputScale;
+    int exponent;
+    std::frexp(maxFactor, &exponent);
+    return exponent <= 31;
+}
+
+QSymm16Elementwise::QSymm16Elementwise(QSymm16ElementwiseOperation operation,
+                                       const TensorInfo& inputInfo0,
+                                       const TensorInfo& inputInfo1,
+                                       const TensorInfo& outputInfo,
+                                       int16_t outputMin,
+                                       int16_t outputMax)
+    : m_Operation(operation)
+    , m_OutputMin(outputMin)
+    , m_OutputMax(outputMax)
+{
+    BOOST_ASSERT(IsSupported(operation, inputInfo0, inputInfo1, outputInfo));
+
+    const double scale0 = inputInfo0.GetQuantizationScale();
+    const double scale1 = inputInfo1.GetQuantizationScale();
+    const double outputScale = outputInfo.GetQuantizationScale();
+
+    const bool isMultiplication = operation == QSymm16ElementwiseOperation::Multiplication;
+    const double factor0 = isMultiplication ? scale0 * scale1 / outputScale : scale0 / outputScale;
+    const double factor1 = isMultiplication ? 0.0 : scale1 / outputScale;
+
+    // The shift gives the largest factor 31 significant bits
+    int exponent;
+    std::frexp(std::max(factor0, factor1), &exponent);
+    m_Shift = std::min(31 - exponent, g_MaxElementwiseShift);
+
+    m_Multiplier0 = static_cast<int64_t>(std::round(std::ldexp(factor0, m_Shift)));
+    m_Multiplier1 = static_cast<int64_t>(std::round(std::ldexp(factor1, m_Shift)));
+}
+
+void QSymm16Elementwise::Execute(const TensorShape& inShape0,
+                                 const TensorShape& inShape1,
+                                 const TensorShape& outShape,
+                                 const int16_t* inData0,
+                                 const int16_t* inData1,
+                                 int16_t* outData) const
+{
+    Int16Decoder input0(inData0);
+    Int16Decoder input1(inData1);
+    Int16Encoder output(outData);
+
+    const int64_t multiplier0 = m_Multiplier0;
+    const int64_t multiplier1 = m_Multiplier1;
+    const int shift = m_Shift;
+    const int16_t outputMin = m_OutputMin;
+    const int16_t outputMax = m_OutputMax;
+
+    const auto run = [&](auto operation)
+    {
+        BroadcastLoop(inShape0, inShape1, outShape).Unroll(
+            [&](int16_t a, int16_t b)
+            {
+                return ClampToInt16(operation(a, b), outputMin, outputMax);
+            },
+            0, input0, input1, output);
+    };
+
+    switch (m_Operation)
+    {
+        case QSymm16ElementwiseOperation::Addition:
+            run([&](int16_t a, int16_t b) { return RoundingShiftRight(a * multiplier0 + b * multiplier1, shift); });
+            break;
+        case QSymm16ElementwiseOperation::Subtraction:
+            run([&](int16_t a, int16_t b) { return RoundingShiftRight(a * multiplier0 - b * multiplier1, shift); });
+            break;
+        case QSymm16ElementwiseOperation::Multiplication:
+            run([&](int16_t a, int16_t b)
+            {
+                return RoundingShiftRight(static_cast<int64_t>(a * b) * multiplier0, shift);
+            });
+            break;
+        case QSymm16ElementwiseOperation::Maximum:
+            run([&](int16_t a, int16_t b)
+            {
+                return std::max(RoundingShiftRight(a * multiplier0, shift), RoundingShiftRight(b * multiplier1, shift));
+            });
+            break;
+        case QSymm16ElementwiseOperation::Minimum:
+            run([&](int16_t a, int16_t b)
+            {
+                return std::min(RoundingShiftRight(a * multiplier0, shift), RoundingShiftRight(b * multiplier1, shift));
+            });
+            break;
+    }
+}
+
+} //namespace armnn
@@ -0,0 +1,190 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Descriptors.hpp>
+#include <armnn/Optional.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace armnn
+{
+
+// Kernels running workloads with QuantisedSymm16 inputs and outputs on the int16 values themselves, rather than
+// dequantizing them to float and quantizing the results back. Products are accumulated exactly in integers and
+// the results are rounded half away from zero like armnn::Quantize, so they match the float implementation
+// wherever the latter does not lose precision.
+
+/// Returns whether a tensor holds QuantisedSymm16 values with a zero offset, as the integer kernels take.
+bool IsQSymm16Tensor(const TensorInfo& info);
+
+/// Returns, in min and max, the range of the quantized output left by an activation fused into a workload: ReLu
+/// and BoundedReLu clamp the output, which commutes with quantization as the latter preserves the order of values.
+/// Returns false for the other activations, which are left to the float implementation.
+bool GetQSymm16OutputBounds(const Optional<ActivationDescriptor>& fusedActivation,
+                            const TensorInfo& outputInfo,
+                            int16_t& min,
+                            int16_t& max);
+
+/// The weights of a FullyConnected or Convolution2d workload with QuantisedSymm16 inputs and outputs, prepared for
+/// integer arithmetic: one row of int16 values per output channel, without their zero point. Each row is multiplied
+/// with the input into int32 accumulators when the row cannot overflow them, and into int64 ones otherwise. The bias
+/// and the requantization to the output are applied once per output value.
+class QSymm16MatrixMultiplier
+{
+public:
+    /// The element (row, column) of the weights is at index row * rowStride + column * columnStride of their data.
+    /// pBias is null when there is no bias.
+    QSymm16MatrixMultiplier(const ConstCpuTensorHandle& weights,
+                            unsigned int numRows,
+                            unsigned int numColumns,
+                            unsigned int rowStride,
+                            unsigned int columnStride,
+                            const ConstCpuTensorHandle* pBias,
+                            const TensorInfo& inputInfo,
+                            const TensorInfo& outputInfo,
+                            int16_t outputMin,
+                            int16_t outputMax);
+
+    unsigned int GetNumRows() const { return m_NumRows; }
+    unsigned int GetNumColumns() const { return m_NumColumns; }
+
+    /// Returns the quantized output of a row for an input vector of GetNumColumns() values.
+    int16_t MultiplyRow(unsigned int row, const int16_t* input) const;
+
+private:
+    unsigned int m_NumRows;
+    unsigned int m_NumColumns;
+
+    /// The weights, row by row.
+    std::vector<int16_t> m_Weights;
+    bool m_UseInt32Accumulators;
+
+    /// Factor from the accumulator of each row to the output: the input scale times the scale of the row's weights,
+    /// over the output scale.
+    std::vector<double> m_Multipliers;
+    /// Bias of each row, in units of the output.
+    std::vector<double> m_Biases;
+
+    int16_t m_OutputMin;
+    int16_t m_OutputMax;
+};
+
+/// Returns the weights of a FullyConnected or Convolution2d workload prepared for the integer kernels, laid out as
+/// for the QSymm16MatrixMultiplier constructor, or nullptr if the workload needs the float implementation. The
+/// integer kernels take QuantisedAsymm8, QuantisedSymm8PerAxis (along outputChannelDim) and zero-offset
+/// QuantisedSymm16 weights, with a Signed32 bias.
+std::unique_ptr<QSymm16MatrixMultiplier> MakeQSymm16MatrixMultiplier(
+    const TensorInfo& inputInfo,
+    const TensorInfo& outputInfo,
+    const ConstCpuTensorHandle& weights,
+    unsigned int numRows,
+    unsigned int numColumns,
+    unsigned int rowStride,
+    unsigned int columnStride,
+    unsigned int outputChannelDim,
+    const ConstCpuTensorHandle* pBias,
+    const Optional<ActivationDescriptor>& fusedActivation);
+
+/// Activation of QuantisedSymm16 values, read from a table of the output for each of the 65536 possible inputs.
+/// The table is computed by the float implementation, so the results are the same.
+class QSymm16ActivationTable
+{
+public:
+    QSymm16ActivationTable(const TensorInfo& inputInfo,
+                           const TensorInfo& outputInfo,
+                           const ActivationDescriptor& descriptor);
+
+    /// Returns whether an activation can be read from a table: both tensors must be quantized per tensor.
+    static bool IsSupported(const TensorInfo& inputInfo, const TensorInfo& outputInfo);
+
+    void Execute(const int16_t* input, int16_t* output, unsigned int numElements) const;
+
+private:
+    /// Output for each input, indexed by the input minus the lowest int16 value.
+    std::vector<int16_t> m_Table;
+};
+
+/// Softmax of QuantisedSymm16 values along an axis. The exponential of beta * scale * (x - max) only depends on
+/// max - x, so it is read from a table of fixed-point values indexed by it. The sums of the exponentials are exact
+/// integer ones, and each output takes a single multiplication by the inverse of its sum.
+class QSymm16Softmax
+{
+public:
+    QSymm16Softmax(const TensorInfo& inputInfo, const TensorInfo& outputInfo, float beta, int axis);
+
+    /// Returns whether a softmax can run on the integer kernel: beta must be positive, so that the exponentials
+    /// are at most one.
+    static bool IsSupported(const TensorInfo& inputInfo, const TensorInfo& outputInfo, float beta);
+
+    void Execute(const int16_t* input, int16_t* output) const;
+
+private:
+    /// e^(-beta * scale * d) in units of 2^-31, for every difference d between the maximum and an input value.
+    std::vector<uint32_t> m_ExpTable;
+
+    unsigned int m_OuterSize;
+    unsigned int m_AxisSize;
+    unsigned int m_InnerSize;
+    float m_OutputScale;
+    int32_t m_OutputOffset;
+};
+
+enum class QSymm16ElementwiseOperation
+{
+    Addition,
+    Subtraction,
+    Multiplication,
+    Maximum,
+    Minimum
+};
+
+/// Elementwise operation on QuantisedSymm16 tensors, with broadcasting. The inputs are rescaled to the output
+/// quantization by fixed-point multipliers sharing a power-of-two divisor, so that the whole operation is
+/// computed in int64 and rounded once.
+class QSymm16Elementwise
+{
+public:
+    QSymm16Elementwise(QSymm16ElementwiseOperation operation,
+                       const TensorInfo& inputInfo0,
+                       const TensorInfo& inputInfo1,
+                       const TensorInfo& outputInfo,
+                       int16_t outputMin,
+                       int16_t outputMax);
+
+    /// Returns whether an operation can run on the integer kernel: the factors from the inputs to the output
+    /// must be representable by the fixed-point multipliers.
+    static bool IsSupported(QSymm16ElementwiseOperation operation,
+                            const TensorInfo& inputInfo0,
+                            const TensorInfo& inputInfo1,
+                            const TensorInfo& outputInfo);
+
+    void Execute(const TensorShape& inShape0,
+                 const TensorShape& inShape1,
+                 const TensorShape& outShape,
+                 const int16_t* inData0,
+                 const int16_t* inData1,
+                 int16_t* outData) const;
+
+private:
+    QSymm16ElementwiseOperation m_Operation;
+
+    /// The factors from each input to the output (from the product of the inputs for a multiplication) are
+    /// m_Multiplier / 2^m_Shift.
+    int64_t m_Multiplier0;
+    int64_t m_Multiplier1;
+    int m_Shift;
+
+    int16_t m_OutputMin;
+    int16_t m_OutputMax;
+};
+
+} //namespace armnn
@@ -0,0 +1,74 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "Reduce.hpp"
+
+#include <algorithm>
+
+namespace armnn
+{
+
+ReductionShape CanonicalizeReduction(const TensorShape& inputShape, const std::vector<unsigned int>& axis)
+{
+    const unsigned int numDims = inputShape.GetNumDimensions();
+
+    // Merges adjacent dimensions of the same kind, skipping those of size 1 which affect neither the input nor
+    // the output layout.
+    std::vector<unsigned int> groupSizes;
+    std::vector<bool> groupReduced;
+    unsigned int numReduced = 1;
+    for (unsigned int d = 0; d < numDims; ++d)
+    {
+        const bool reduced = axis.empty() || std::find(axis.begin(), axis.end(), d) != axis.end();
+        if (reduced)
+        {
+            numReduced *= inputShape[d];
+        }
+        if (inputShape[d] == 1)
+        {
+            continue;
+        }
+        if (!groupSizes.empty() && groupReduced.back() == reduced)
+        {
+            groupSizes.back() *= inputShape[d];
+        }
+        else
+        {
+            groupSizes.push_back(inputShape[d]);
+            groupReduced.push_back(reduced);
+        }
+    }
+
+    ReductionShape shape;
+    shape.m_NumReduced = numReduced;
+    if (groupSizes.empty())
+    {
+        return shape;
+    }
+
+    shape.m_InnerSize = groupSizes.back();
+    shape.m_InnerReduced = groupReduced.back();
+
+    const unsigned int numOuterGroups = static_cast<unsigned int>(groupSizes.size()) - 1;
+    shape.m_OuterSizes.assign(groupSizes.begin(), groupSizes.begin() + numOuterGroups);
+    shape.m_OuterOutputStrides.resize(numOuterGroups);
+
+    unsigned int outputStride = shape.m_InnerReduced ? 1 : shape.m_InnerSize;
+    for (unsigned int g = numOuterGroups; g-- > 0;)
+    {
+        if (groupReduced[g])
+        {
+            shape.m_OuterOutputStrides[g] = 0;
+        }
+        else
+        {
+            shape.m_OuterOutputStrides[g] = outputStride;
+            outputStride *= groupSizes[g];
+        }
+    }
+    return shape;
+}
+
+} //namespace armnn
@@ -0,0 +1,88 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// The shape of a reduction, canonicalized into groups of adjacent dimensions that are either all reduced or all
+/// kept, with dimensions of size 1 dropped. The innermost group is contiguous in the input; the other groups are
+/// walked one span of it at a time.
+struct ReductionShape
+{
+    /// Sizes of the groups other than the innermost, outermost first.
+    std::vector<unsigned int> m_OuterSizes;
+    /// Distance in the output between consecutive indices of each outer group: 0 for reduced groups.
+    std::vector<unsigned int> m_OuterOutputStrides;
+    /// Number of elements in the innermost group.
+    unsigned int m_InnerSize = 1;
+    /// Whether the innermost group is reduced (each span sums into one output) or kept (each span is added
+    /// element-wise into a span of the output).
+    bool m_InnerReduced = true;
+    /// Number of input elements reduced into each output element.
+    unsigned int m_NumReduced = 1;
+};
+
+/// Canonicalizes the reduction of a tensor of the given shape along the given axes (all of them if empty).
+ReductionShape CanonicalizeReduction(const TensorShape& inputShape, const std::vector<unsigned int>& axis);
+
+/// Reduces the dense input along the dimensions described by shape, combining each input element into its output
+/// element with output = accumulate(output, input). The output, dense over the kept dimensions, must be initialised
+/// by the caller (e.g. to 0 for a sum, or to the lowest value for a max). The input is read once, in order, and
+/// the innermost loops run over contiguous spans so that the compiler can vectorize them.
+template<typename Accumulate>
+void Reduce(const ReductionShape& shape, const float* input, float* output, Accumulate accumulate)
+{
+    const unsigned int numOuterGroups = static_cast<unsigned int>(shape.m_OuterSizes.size());
+    const unsigned int innerSize = shape.m_InnerSize;
+
+    unsigned int numSpans = 1;
+    for (unsigned int size : shape.m_OuterSizes)
+    {
+        numSpans *= size;
+    }
+
+    std::vector<unsigned int> indices(numOuterGroups, 0);
+    unsigned int outputOffset = 0;
+    for (unsigned int span = 0; span < numSpans; ++span, input += innerSize)
+    {
+        if (shape.m_InnerReduced)
+        {
+            float value = output[outputOffset];
+            for (unsigned int i = 0; i < innerSize; ++i)
+            {
+                value = accumulate(value, input[i]);
+            }
+            output[outputOffset] = value;
+        }
+        else
+        {
+            float* outputSpan = output + outputOffset;
+            for (unsigned int i = 0; i < innerSize; ++i)
+            {
+                outputSpan[i] = accumulate(outputSpan[i], input[i]);
+            }
+        }
+
+        // Advances the outer indices, last group fastest.
+        for (unsigned int g = numOuterGroups; g-- > 0;)
+        {
+            if (++indices[g] < shape.m_OuterSizes[g])
+            {
+                outputOffset += shape.m_OuterOutputStrides[g];
+                break;
+            }
+            indices[g] = 0;
+            outputOffset -= (shape.m_OuterSizes[g] - 1) * shape.m_OuterOutputStrides[g];
+        }
+    }
+}
+
+} //namespace armnn
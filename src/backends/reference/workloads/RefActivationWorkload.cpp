@@ -15,6 +15,18 @@
 namespace armnn
 {
 
+RefActivationWorkload::RefActivationWorkload(const ActivationQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : BaseWorkload<ActivationQueueDescriptor>(descriptor, info)
+{
+    // QuantisedSymm16 values are looked up in a table of the outputs for each of their 65536 values.
+    const TensorInfo& inputInfo = info.m_InputTensorInfos[0];
+    const TensorInfo& outputInfo = info.m_OutputTensorInfos[0];
+    if (QSymm16ActivationTable::IsSupported(inputInfo, outputInfo))
+    {
+        m_QSymm16Table = std::make_unique<QSymm16ActivationTable>(inputInfo, outputInfo, descriptor.m_Parameters);
+    }
+}
+
 void RefActivationWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefActivationWorkload_Execute");
@@ -22,6 +34,14 @@ void RefActivationWorkload::Execute() const
     const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
+    if (m_QSymm16Table)
+    {
+        m_QSymm16Table->Execute(GetInputTensorData<int16_t>(0, m_Data),
+                                GetOutputTensorData<int16_t>(0, m_Data),
+                                inputInfo.GetNumElements());
+        return;
+    }
+
     Activation(*MakeDecoder<float>(inputInfo, m_Data.m_Inputs[0]->Map()),
                *MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map()),
                inputInfo,
@@ -7,6 +7,7 @@
 
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
+#include "QSymm16Kernels.hpp"
 
 namespace armnn
 {
@@ -14,8 +15,13 @@ namespace armnn
 class RefActivationWorkload : public BaseWorkload<ActivationQueueDescriptor>
 {
 public:
-    using BaseWorkload<ActivationQueueDescriptor>::BaseWorkload;
+    explicit RefActivationWorkload(const ActivationQueueDescriptor& descriptor, const WorkloadInfo& info);
+
     virtual void Execute() const override;
+
+private:
+    /// The table of outputs, when the input and output are QuantisedSymm16.
+    std::unique_ptr<QSymm16ActivationTable> m_QSymm16Table;
 };
 
 } //namespace armnn
@@ -6,6 +6,7 @@
 #include "RefConvolution2dWorkload.hpp"
 
 #include "ConvImpl.hpp"
+#include "FusedActivation.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
@@ -22,6 +23,14 @@ RefConvolution2dWorkload::RefConvolution2dWorkload(
     m_FilterShape = rFilterInfo.GetShape();
     m_FilterDecoder = MakeDecoder<float>(rFilterInfo, m_Weight.get()->Map(true));
 
+    // Pruned filters are kept in block-CSR form, so that their zero blocks are skipped.
+    if (m_Weight->GetConstTensor<void>() != nullptr)
+    {
+        const unsigned int outputChannels = m_FilterShape[0];
+        const unsigned int filterSize = rFilterInfo.GetNumElements() / outputChannels;
+        m_SparseFilter = MakeBlockCsrMatrixIfSparse(*m_FilterDecoder, outputChannels, filterSize, filterSize, 1);
+    }
+
     if (descriptor.m_Parameters.m_BiasEnabled)
     {
         m_Bias = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias));
@@ -38,15 +47,45 @@ void RefConvolution2dWorkload::PostAllocationConfigure()
 
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
     m_OutputShape = outputInfo.GetShape();
-    m_OutputEncoder = MakeEncoder<float>(outputInfo);
+    m_OutputEncoder = MakeFusedActivationEncoder(MakeEncoder<float>(outputInfo), m_Data);
+
+    // QuantisedSymm16 tensors are convolved in integer arithmetic when the filter allows it.
+    const unsigned int outputChannels = m_FilterShape[0];
+    const unsigned int filterSize = m_Weight->GetTensorInfo().GetNumElements() / outputChannels;
+    m_QSymm16Filter = MakeQSymm16MatrixMultiplier(inputInfo, outputInfo, *m_Weight, outputChannels, filterSize,
+                                                  filterSize, 1, 0, m_Bias.get(), m_Data.m_FusedActivation);
+    if (m_QSymm16Filter)
+    {
+        m_SparseFilter.reset();
+    }
 }
 
 void RefConvolution2dWorkload::Execute() const {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConvolution2dWorkload_Execute");
 
+    if (m_QSymm16Filter)
+    {
+        ConvolveQSymm16(m_InputShape, GetInputTensorData<int16_t>(0, m_Data), m_OutputShape,
+                        GetOutputTensorData<int16_t>(0, m_Data), m_FilterShape, *m_QSymm16Filter,
+                        m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                        m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                        m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY);
+        return;
+    }
+
     m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
     m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
 
+    if (m_SparseFilter)
+    {
+        ConvolveSparse(m_InputShape, *m_InputDecoder, m_OutputShape, *m_OutputEncoder, m_FilterShape,
+                       *m_SparseFilter, m_BiasDecoder.get(),
+                       m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                       m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                       m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY);
+        return;
+    }
+
     Convolve(m_InputShape, *m_InputDecoder, m_OutputShape, *m_OutputEncoder, m_FilterShape,
              *m_FilterDecoder, m_Data.m_Parameters.m_BiasEnabled, m_BiasDecoder.get(),
              m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
@@ -7,8 +7,10 @@
 
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
+#include "BlockCsrMatrix.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "QSymm16Kernels.hpp"
 
 namespace armnn
 {
@@ -32,6 +34,12 @@ private:
     std::unique_ptr<Decoder<float>> m_FilterDecoder;
     std::unique_ptr<Decoder<float>> m_BiasDecoder;
 
+    /// The filter in block-CSR form, when it is sparse enough to be multiplied that way.
+    std::unique_ptr<BlockCsrMatrix> m_SparseFilter;
+
+    /// The filter prepared for integer arithmetic, when the input and output are QuantisedSymm16.
+    std::unique_ptr<QSymm16MatrixMultiplier> m_QSymm16Filter;
+
     TensorShape m_InputShape;
     TensorShape m_OutputShape;
     TensorShape m_FilterShape;
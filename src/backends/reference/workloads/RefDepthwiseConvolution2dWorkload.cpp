@@ -9,6 +9,7 @@
 #include "RefWorkloadUtils.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "FusedActivation.hpp"
 #include "Profiling.hpp"
 #include <ResolveType.hpp>
 
@@ -40,7 +41,7 @@ void RefDepthwiseConvolution2dWorkload::PostAllocationConfigure()
 
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
     m_OutputShape = outputInfo.GetShape();
-    m_OutputEncoder = MakeEncoder<float>(outputInfo);
+    m_OutputEncoder = MakeFusedActivationEncoder(MakeEncoder<float>(outputInfo), m_Data);
 }
 
 void RefDepthwiseConvolution2dWorkload::Execute() const
@@ -8,6 +8,7 @@
 #include "Decoders.hpp"
 #include "ElementwiseFunction.hpp"
 #include "Encoders.hpp"
+#include "FusedActivation.hpp"
 #include "Profiling.hpp"
 #include "RefWorkloadUtils.hpp"
 #include "StringMapping.hpp"
@@ -17,6 +18,48 @@
 namespace armnn
 {
 
+namespace
+{
+
+/// Returns, in operation, the integer kernel operation matching a functor, if there is one.
+template <typename Functor>
+bool GetQSymm16ElementwiseOperation(const Functor&, QSymm16ElementwiseOperation&)
+{
+    return false;
+}
+
+bool GetQSymm16ElementwiseOperation(const std::plus<float>&, QSymm16ElementwiseOperation& operation)
+{
+    operation = QSymm16ElementwiseOperation::Addition;
+    return true;
+}
+
+bool GetQSymm16ElementwiseOperation(const std::minus<float>&, QSymm16ElementwiseOperation& operation)
+{
+    operation = QSymm16ElementwiseOperation::Subtraction;
+    return true;
+}
+
+bool GetQSymm16ElementwiseOperation(const std::multiplies<float>&, QSymm16ElementwiseOperation& operation)
+{
+    operation = QSymm16ElementwiseOperation::Multiplication;
+    return true;
+}
+
+bool GetQSymm16ElementwiseOperation(const armnn::maximum<float>&, QSymm16ElementwiseOperation& operation)
+{
+    operation = QSymm16ElementwiseOperation::Maximum;
+    return true;
+}
+
+bool GetQSymm16ElementwiseOperation(const armnn::minimum<float>&, QSymm16ElementwiseOperation& operation)
+{
+    operation = QSymm16ElementwiseOperation::Minimum;
+    return true;
+}
+
+} // anonymous namespace
+
 template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
 RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::RefElementwiseWorkload(
     const ParentDescriptor& desc,
@@ -34,7 +77,19 @@ void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::PostAllocat
 
     m_Input0 = MakeDecoder<InType>(inputInfo0);
     m_Input1 = MakeDecoder<InType>(inputInfo1);
-    m_Output = MakeEncoder<OutType>(outputInfo);
+    m_Output = MakeFusedActivationEncoder(MakeEncoder<OutType>(outputInfo), m_Data);
+
+    // QuantisedSymm16 tensors are combined in integer arithmetic when the operation has an integer kernel.
+    QSymm16ElementwiseOperation operation;
+    int16_t outputMin;
+    int16_t outputMax;
+    if (GetQSymm16ElementwiseOperation(Functor(), operation) &&
+        QSymm16Elementwise::IsSupported(operation, inputInfo0, inputInfo1, outputInfo) &&
+        GetQSymm16OutputBounds(m_Data.m_FusedActivation, outputInfo, outputMin, outputMax))
+    {
+        m_QSymm16Kernel = std::make_unique<QSymm16Elementwise>(operation, inputInfo0, inputInfo1, outputInfo,
+                                                               outputMin, outputMax);
+    }
 }
 
 template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
@@ -49,6 +104,17 @@ void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::Execute() c
     const TensorShape& inShape1 = inputInfo1.GetShape();
     const TensorShape& outShape = outputInfo.GetShape();
 
+    if (m_QSymm16Kernel)
+    {
+        m_QSymm16Kernel->Execute(inShape0,
+                                 inShape1,
+                                 outShape,
+                                 GetInputTensorData<int16_t>(0, m_Data),
+                                 GetInputTensorData<int16_t>(1, m_Data),
+                                 GetOutputTensorData<int16_t>(0, m_Data));
+        return;
+    }
+
     m_Input0->Reset(m_Data.m_Inputs[0]->Map());
     m_Input1->Reset(m_Data.m_Inputs[1]->Map());
     m_Output->Reset(m_Data.m_Outputs[0]->Map());
@@ -12,6 +12,7 @@
 #include "ElementwiseFunction.hpp"
 #include "Maximum.hpp"
 #include "Minimum.hpp"
+#include "QSymm16Kernels.hpp"
 #include "StringMapping.hpp"
 
 namespace armnn
@@ -33,6 +34,9 @@ private:
     std::unique_ptr<Decoder<InType>> m_Input0;
     std::unique_ptr<Decoder<InType>> m_Input1;
     std::unique_ptr<Encoder<OutType>> m_Output;
+
+    /// The integer kernel, when the operation runs on QuantisedSymm16 tensors.
+    std::unique_ptr<QSymm16Elementwise> m_QSymm16Kernel;
 };
 
 using RefAdditionWorkload =
@@ -6,6 +6,7 @@
 #include "RefFullyConnectedWorkload.hpp"
 
 #include "FullyConnected.hpp"
+#include "FusedActivation.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
@@ -21,6 +22,17 @@ RefFullyConnectedWorkload::RefFullyConnectedWorkload(
     m_WeightShape = rWeightInfo.GetShape();
     m_WeightDecoder = MakeDecoder<float>(rWeightInfo, m_Weight->Map(true));
 
+    // Pruned weights are kept in block-CSR form, so that their zero blocks are skipped.
+    if (m_Weight->GetConstTensor<void>() != nullptr)
+    {
+        const bool transposeWeights = descriptor.m_Parameters.m_TransposeWeightMatrix;
+        const unsigned int numInputs = m_WeightShape[transposeWeights ? 1 : 0];
+        const unsigned int numOutputs = m_WeightShape[transposeWeights ? 0 : 1];
+        m_SparseWeights = MakeBlockCsrMatrixIfSparse(*m_WeightDecoder, numOutputs, numInputs,
+                                                     transposeWeights ? numInputs : 1,
+                                                     transposeWeights ? 1 : numOutputs);
+    }
+
     if (descriptor.m_Parameters.m_BiasEnabled)
     {
         m_Bias = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias));
@@ -38,22 +50,57 @@ void RefFullyConnectedWorkload::PostAllocationConfigure()
 
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
     m_OutputShape = outputInfo.GetShape();
-    m_OutputEncoder = MakeEncoder<float>(outputInfo);
+    m_OutputEncoder = MakeFusedActivationEncoder(MakeEncoder<float>(outputInfo), m_Data);
 
     m_NumActivations = 1; // Total number of activations in the input.
     for (unsigned int i = 1; i < inputInfo.GetNumDimensions(); i++)
     {
         m_NumActivations *= inputInfo.GetShape()[i];
     }
+
+    // QuantisedSymm16 tensors are multiplied in integer arithmetic when the weights allow it.
+    const bool transposeWeights = m_Data.m_Parameters.m_TransposeWeightMatrix;
+    const unsigned int numInputs = m_WeightShape[transposeWeights ? 1 : 0];
+    const unsigned int numOutputs = m_WeightShape[transposeWeights ? 0 : 1];
+    m_QSymm16Weights = MakeQSymm16MatrixMultiplier(inputInfo, outputInfo, *m_Weight, numOutputs, numInputs,
+                                                   transposeWeights ? numInputs : 1,
+                                                   transposeWeights ? 1 : numOutputs,
+                                                   transposeWeights ? 0 : 1,
+                                                   m_Bias.get(), m_Data.m_FusedActivation);
+    if (m_QSymm16Weights)
+    {
+        m_SparseWeights.reset();
+    }
 }
 
 void RefFullyConnectedWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFullyConnectedWorkload_Execute");
 
+    if (m_QSymm16Weights)
+    {
+        FullyConnectedQSymm16(m_InputShape,
+                              GetInputTensorData<int16_t>(0, m_Data),
+                              m_OutputShape,
+                              GetOutputTensorData<int16_t>(0, m_Data),
+                              *m_QSymm16Weights);
+        return;
+    }
+
     m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
     m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
 
+    if (m_SparseWeights)
+    {
+        FullyConnectedSparse(m_InputShape,
+                             *m_InputDecoder,
+                             m_OutputShape,
+                             *m_OutputEncoder,
+                             *m_SparseWeights,
+                             m_BiasDecoder.get());
+        return;
+    }
+
     FullyConnected(m_InputShape,
                    *m_InputDecoder,
                    m_OutputShape,
@@ -8,8 +8,10 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 #include "BaseIterator.hpp"
+#include "BlockCsrMatrix.hpp"
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "QSymm16Kernels.hpp"
 
 
 namespace armnn
@@ -34,6 +36,12 @@ private:
     std::unique_ptr<Decoder<float>> m_WeightDecoder;
     std::unique_ptr<Decoder<float>> m_BiasDecoder;
 
+    /// The weights in block-CSR form, when they are sparse enough to be multiplied that way.
+    std::unique_ptr<BlockCsrMatrix> m_SparseWeights;
+
+    /// The weights prepared for integer arithmetic, when the input and output are QuantisedSymm16.
+    std::unique_ptr<QSymm16MatrixMultiplier> m_QSymm16Weights;
+
     TensorShape m_InputShape;
     TensorShape m_OutputShape;
     TensorShape m_WeightShape;
@@ -21,11 +21,17 @@ void RefGatherWorkload::Execute() const
     const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
+    const int32_t* indicesData = GetInputTensorData<int32_t>(1, m_Data);
+
+    if (inputInfo0.IsTypeSpaceMatch(outputInfo))
+    {
+        Gather(inputInfo0, inputInfo1, outputInfo, m_Data.m_Inputs[0]->Map(), indicesData, m_Data.m_Outputs[0]->Map());
+        return;
+    }
+
     std::unique_ptr<Decoder<float>> decoderPtr = MakeDecoder<float>(inputInfo0, m_Data.m_Inputs[0]->Map());
     Decoder<float>& decoder = *decoderPtr;
 
-    const int32_t* indicesData = GetInputTensorData<int32_t>(1, m_Data);
-
     std::unique_ptr<Encoder<float>> encoderPtr = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
     Encoder<float>& encoder = *encoderPtr;
 
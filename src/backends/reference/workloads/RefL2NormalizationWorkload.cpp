@@ -14,7 +14,9 @@
 
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 using namespace armnnUtils;
 
@@ -38,63 +40,93 @@ RefL2NormalizationWorkload::RefL2NormalizationWorkload(
         DataLayoutIndexed dataLayout(m_Data.m_Parameters.m_DataLayout);
 
         const TensorShape& shape = inputInfo.GetShape();
-        unsigned int paddedShapeArray[4];
         const int idxShift = 4 - boost::numeric_cast<int>(shape.GetNumDimensions());
 
         const unsigned int batches = (idxShift == 0) ? shape[0] : 1;
-        paddedShapeArray[0] = batches;
 
         const int channelsIdx = boost::numeric_cast<int>(dataLayout.GetChannelsIndex());
         const unsigned int channels = (channelsIdx - idxShift >= 0)
                                       ? shape[boost::numeric_cast<unsigned int>(channelsIdx - idxShift)]
                                       : 1;
-        paddedShapeArray[channelsIdx] = channels;
 
         const int heightIdx = boost::numeric_cast<int>(dataLayout.GetHeightIndex());
         const unsigned int height = (heightIdx - idxShift >= 0)
                                     ? shape[boost::numeric_cast<unsigned int>(heightIdx - idxShift)]
                                     : 1;
-        paddedShapeArray[heightIdx] = height;
 
         const int widthIdx = boost::numeric_cast<int>(dataLayout.GetWidthIndex());
         const unsigned int width = (widthIdx - idxShift >= 0)
                                    ? shape[boost::numeric_cast<unsigned int>(widthIdx - idxShift)]
                                    : 1;
-        paddedShapeArray[widthIdx] = width;
 
-        const TensorShape& paddedShape = TensorShape(4, paddedShapeArray);
+        const unsigned int planeSize = height * width;
+        const unsigned int numElements = batches * channels * planeSize;
 
+        std::vector<float> inputBuffer(numElements);
+        std::vector<float> outputBuffer(numElements);
+        const float* input = inputDecoder->DecodeChunk(inputBuffer.data(), numElements);
+        float* output = outputEncoder->GetChunkBuffer(outputBuffer.data());
+
+        // The sum of squares over the channels of each pixel: for NCHW it is accumulated one channel plane at a
+        // time for all pixels of the batch, for NHWC one pixel at a time over its contiguous channels.
+        const float eps = m_Data.m_Parameters.m_Eps;
+        std::vector<float> scales(planeSize);
         for (unsigned int n = 0; n < batches; ++n)
         {
-            for (unsigned int c = 0; c < channels; ++c)
+            const float* batchInput = input + n * channels * planeSize;
+            float* batchOutput = output + n * channels * planeSize;
+
+            if (dataLayout.GetDataLayout() == DataLayout::NCHW)
             {
-                for (unsigned int h = 0; h < height; ++h)
+                std::fill(scales.begin(), scales.end(), 0.0f);
+                for (unsigned int d = 0; d < channels; ++d)
                 {
-                    for (unsigned int w = 0; w < width; ++w)
+                    const float* plane = batchInput + d * planeSize;
+                    for (unsigned int p = 0; p < planeSize; ++p)
                     {
-                        float reduction = 0.0;
-                        for (unsigned int d = 0; d < channels; ++d)
-                        {
-                            unsigned int inputIndex = dataLayout.GetIndex(paddedShape, n, d, h, w);
-
-                            (*inputDecoder)[inputIndex];
-                            const float value = inputDecoder->Get();
-                            reduction += value * value;
-                        }
-
-                        unsigned int index = dataLayout.GetIndex(paddedShape, n, c, h, w);
+                        scales[p] += plane[p] * plane[p];
+                    }
+                }
+                for (unsigned int p = 0; p < planeSize; ++p)
+                {
+                    const float maximum = scales[p] < eps ? eps : scales[p];
+                    scales[p] = 1.0f / sqrtf(maximum);
+                }
+                for (unsigned int c = 0; c < channels; ++c)
+                {
+                    const float* plane = batchInput + c * planeSize;
+                    float* outputPlane = batchOutput + c * planeSize;
+                    for (unsigned int p = 0; p < planeSize; ++p)
+                    {
+                        outputPlane[p] = plane[p] * scales[p];
+                    }
+                }
+            }
+            else
+            {
+                for (unsigned int p = 0; p < planeSize; ++p)
+                {
+                    const float* pixel = batchInput + p * channels;
+                    float* outputPixel = batchOutput + p * channels;
 
-                        float maximum = reduction < m_Data.m_Parameters.m_Eps ? m_Data.m_Parameters.m_Eps : reduction;
+                    float reduction = 0.0f;
+                    for (unsigned int d = 0; d < channels; ++d)
+                    {
+                        reduction += pixel[d] * pixel[d];
+                    }
 
-                        const float scale = 1.0f / sqrtf(maximum);
+                    const float maximum = reduction < eps ? eps : reduction;
+                    const float scale = 1.0f / sqrtf(maximum);
 
-                        (*inputDecoder)[index];
-                        (*outputEncoder)[index];
-                        outputEncoder->Set(inputDecoder->Get() * scale);
+                    for (unsigned int c = 0; c < channels; ++c)
+                    {
+                        outputPixel[c] = pixel[c] * scale;
                     }
                 }
             }
         }
+
+        outputEncoder->EncodeChunk(output, numElements);
     }
 
 } //namespace armnn
@@ -10,374 +10,313 @@
 #include "LstmUtils.hpp"
 #include "RefWorkloadUtils.hpp"
 
+#include <algorithm>
+
 namespace armnn
 {
 
-RefLstmWorkload::RefLstmWorkload(const LstmQueueDescriptor &descriptor, const WorkloadInfo &info)
-    : BaseWorkload<LstmQueueDescriptor>(descriptor, info)
-    , m_InputToInputWeightsTensor     (AssignScopedCpuTensorHandle(descriptor.m_InputToInputWeights))
-    , m_InputToForgetWeightsTensor    (AssignScopedCpuTensorHandle(descriptor.m_InputToForgetWeights))
-    , m_InputToCellWeightsTensor      (AssignScopedCpuTensorHandle(descriptor.m_InputToCellWeights))
-    , m_InputToOutputWeightsTensor    (AssignScopedCpuTensorHandle(descriptor.m_InputToOutputWeights))
-    , m_RecurrentToInputWeightsTensor (AssignScopedCpuTensorHandle(descriptor.m_RecurrentToInputWeights))
-    , m_RecurrentToForgetWeightsTensor(AssignScopedCpuTensorHandle(descriptor.m_RecurrentToForgetWeights))
-    , m_RecurrentToCellWeightsTensor  (AssignScopedCpuTensorHandle(descriptor.m_RecurrentToCellWeights))
-    , m_RecurrentToOutputWeightsTensor(AssignScopedCpuTensorHandle(descriptor.m_RecurrentToOutputWeights))
-    , m_CellToInputWeightsTensor      (AssignScopedCpuTensorHandle(descriptor.m_CellToInputWeights))
-    , m_CellToForgetWeightsTensor     (AssignScopedCpuTensorHandle(descriptor.m_CellToForgetWeights))
-    , m_CellToOutputWeightsTensor     (AssignScopedCpuTensorHandle(descriptor.m_CellToOutputWeights))
-    , m_InputGateBiasTensor           (AssignScopedCpuTensorHandle(descriptor.m_InputGateBias))
-    , m_ForgetGateBiasTensor          (AssignScopedCpuTensorHandle(descriptor.m_ForgetGateBias))
-    , m_CellBiasTensor                (AssignScopedCpuTensorHandle(descriptor.m_CellBias))
-    , m_OutputGateBiasTensor          (AssignScopedCpuTensorHandle(descriptor.m_OutputGateBias))
-    , m_ProjectionWeightsTensor       (AssignScopedCpuTensorHandle(descriptor.m_ProjectionWeights))
-    , m_ProjectionBiasTensor          (AssignScopedCpuTensorHandle(descriptor.m_ProjectionBias))
-    , m_InputLayerNormWeights         (AssignScopedCpuTensorHandle(descriptor.m_InputLayerNormWeights))
-    , m_ForgetLayerNormWeights        (AssignScopedCpuTensorHandle(descriptor.m_ForgetLayerNormWeights))
-    , m_CellLayerNormWeights          (AssignScopedCpuTensorHandle(descriptor.m_CellLayerNormWeights))
-    , m_OutputLayerNormWeights        (AssignScopedCpuTensorHandle(descriptor.m_OutputLayerNormWeights))
-{}
-
-void RefLstmWorkload::Execute() const
+namespace
 {
-    // This is a porting of the LSTM::Eval() method in the Android code base
-    // Refer to: android/frameworks/ml/nn/common/operations/LSTM.cpp
 
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+std::vector<float> DecodeTensor(const ConstCpuTensorHandle* tensor)
+{
+    const unsigned int numElements = tensor->GetTensorInfo().GetNumElements();
+    std::vector<float> values(numElements);
 
-    const TensorShape& inputShape = inputInfo.GetShape();
-    const DataType& outputType = outputInfo.GetDataType();
+    std::unique_ptr<Decoder<float>> decoder =
+        MakeDecoder<float>(tensor->GetTensorInfo(), tensor->GetConstTensor<void>());
+    const float* decoded = decoder->DecodeChunk(values.data(), numElements);
+    if (decoded != values.data())
+    {
+        std::copy(decoded, decoded + numElements, values.begin());
+    }
+    return values;
+}
 
-    std::unique_ptr<Encoder<float>> outputStateOut = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[1]->Map());
-    std::unique_ptr<Encoder<float>> cellStateOut   = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[2]->Map());
-    std::unique_ptr<Encoder<float>> output         = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[3]->Map());
+// Decodes a [rows x cols] weight matrix and stores it, from row rowOffset onwards, in the column-major packed
+// matrix with packedRows rows.
+void PackWeights(const ConstCpuTensorHandle* weights,
+                 unsigned int rowOffset,
+                 unsigned int packedRows,
+                 std::vector<float>& packed)
+{
+    const unsigned int rows = weights->GetShape()[0];
+    const unsigned int cols = weights->GetShape()[1];
+    const std::vector<float> values = DecodeTensor(weights);
 
-    std::unique_ptr<Decoder<float>> cellStateOutDecoder = MakeDecoder<float>(outputInfo, m_Data.m_Outputs[2]->Map());
-    std::unique_ptr<Decoder<float>> outputDecoder       = MakeDecoder<float>(outputInfo, m_Data.m_Outputs[3]->Map());
+    for (unsigned int r = 0; r < rows; ++r)
+    {
+        for (unsigned int c = 0; c < cols; ++c)
+        {
+            packed[c * packedRows + rowOffset + r] = values[r * cols + c];
+        }
+    }
+}
 
-    std::unique_ptr<Decoder<float>> inputData     = MakeDecoder<float>(inputInfo, m_Data.m_Inputs[0]->Map());
-    std::unique_ptr<Decoder<float>> outputStateIn = MakeDecoder<float>(inputInfo, m_Data.m_Inputs[1]->Map());
-    std::unique_ptr<Decoder<float>> cellStateIn   = MakeDecoder<float>(inputInfo, m_Data.m_Inputs[2]->Map());
+void PackVector(const ConstCpuTensorHandle* vector, unsigned int offset, std::vector<float>& packed)
+{
+    const std::vector<float> values = DecodeTensor(vector);
+    std::copy(values.begin(), values.end(), packed.begin() + offset);
+}
 
-    const uint32_t nBatch = inputShape[0];
-    const uint32_t nInput = inputShape[1];
+} // anonymous namespace
 
-    const uint32_t nCell   = m_InputToOutputWeightsTensor->GetShape()[0];
-    const uint32_t nOutput = m_RecurrentToOutputWeightsTensor->GetShape()[1];
+RefLstmWorkload::RefLstmWorkload(const LstmQueueDescriptor &descriptor, const WorkloadInfo &info)
+    : BaseWorkload<LstmQueueDescriptor>(descriptor, info)
+{
+    const LstmDescriptor& parameters = descriptor.m_Parameters;
+    const TensorShape& inputShape = info.m_InputTensorInfos[0].GetShape();
 
-    const bool useCifg      = m_Data.m_Parameters.m_CifgEnabled;
-    const bool usePeephole  = m_Data.m_Parameters.m_PeepholeEnabled;
-    const bool useLayerNorm = m_Data.m_Parameters.m_LayerNormEnabled;
+    m_NumBatches = inputShape[0];
+    m_NumInputs  = inputShape[1];
+    m_NumCells   = descriptor.m_InputToOutputWeights->GetShape()[0];
+    m_NumOutputs = descriptor.m_RecurrentToOutputWeights->GetShape()[1];
+    m_NumGates   = parameters.m_CifgEnabled ? 3 : 4;
 
-    // Index the scratch buffers pointers to the global scratch buffer.
-    std::unique_ptr<Encoder<float>> inputGateScratch  = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
-    std::unique_ptr<Encoder<float>> cellScratch       = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
-    std::unique_ptr<Encoder<float>> forgetGateScratch = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
-    std::unique_ptr<Encoder<float>> outputGateScratch = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
+    m_ForgetGateOffset = parameters.m_CifgEnabled ? 0 : m_NumCells;
+    m_CellGateOffset   = m_ForgetGateOffset + m_NumCells;
+    m_OutputGateOffset = m_CellGateOffset + m_NumCells;
 
-    std::unique_ptr<Decoder<float>> inputGateScratchDecoder =
-        MakeDecoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
-    std::unique_ptr<Decoder<float>> cellScratchDecoder =
-        MakeDecoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
-    std::unique_ptr<Decoder<float>> forgetGateScratchDecoder =
-        MakeDecoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
-    std::unique_ptr<Decoder<float>> outputGateScratchDecoder =
-        MakeDecoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
+    const unsigned int gateSize = m_NumGates * m_NumCells;
 
-    if (useCifg)
-    {
-        *cellScratch       += (0 * nCell * nBatch);
-        *forgetGateScratch += (1 * nCell * nBatch);
-        *outputGateScratch += (2 * nCell * nBatch);
+    m_InputWeights.resize(gateSize * m_NumInputs);
+    m_RecurrentWeights.resize(gateSize * m_NumOutputs);
+    m_GateBias.resize(gateSize);
 
-        *cellScratchDecoder       += (0 * nCell * nBatch);
-        *forgetGateScratchDecoder += (1 * nCell * nBatch);
-        *outputGateScratchDecoder += (2 * nCell * nBatch);
-    }
-    else
+    if (!parameters.m_CifgEnabled)
     {
-        *inputGateScratch  += (0 * nCell * nBatch);
-        *cellScratch       += (1 * nCell * nBatch);
-        *forgetGateScratch += (2 * nCell * nBatch);
-        *outputGateScratch += (3 * nCell * nBatch);
-
-        *inputGateScratchDecoder  += (0 * nCell * nBatch);
-        *cellScratchDecoder       += (1 * nCell * nBatch);
-        *forgetGateScratchDecoder += (2 * nCell * nBatch);
-        *outputGateScratchDecoder += (3 * nCell * nBatch);
+        PackWeights(descriptor.m_InputToInputWeights, 0, gateSize, m_InputWeights);
+        PackWeights(descriptor.m_RecurrentToInputWeights, 0, gateSize, m_RecurrentWeights);
+        PackVector(descriptor.m_InputGateBias, 0, m_GateBias);
     }
+    PackWeights(descriptor.m_InputToForgetWeights, m_ForgetGateOffset, gateSize, m_InputWeights);
+    PackWeights(descriptor.m_InputToCellWeights, m_CellGateOffset, gateSize, m_InputWeights);
+    PackWeights(descriptor.m_InputToOutputWeights, m_OutputGateOffset, gateSize, m_InputWeights);
 
-    std::unique_ptr<Decoder<float>> inputToInputWeightsTensor;
-    std::unique_ptr<Decoder<float>> inputToForgetWeightsTensor = MakeDecoder<float>(
-        m_InputToForgetWeightsTensor->GetTensorInfo(), m_InputToForgetWeightsTensor->GetTensor<void>());
-    std::unique_ptr<Decoder<float>> inputToCellWeightsTensor = MakeDecoder<float>(
-        m_InputToCellWeightsTensor->GetTensorInfo(), m_InputToCellWeightsTensor->GetTensor<void>());
-    std::unique_ptr<Decoder<float>> inputToOutputWeightsTensor = MakeDecoder<float>(
-        m_InputToOutputWeightsTensor->GetTensorInfo(), m_InputToOutputWeightsTensor->GetTensor<void>());
-
-    std::unique_ptr<Decoder<float>> recurrentToInputWeightsTensor;
-    std::unique_ptr<Decoder<float>> recurrentToForgetWeightsTensor = MakeDecoder<float>(
-        m_RecurrentToForgetWeightsTensor->GetTensorInfo(), m_RecurrentToForgetWeightsTensor->GetTensor<void>());
-    std::unique_ptr<Decoder<float>> recurrentToCellWeightsTensor = MakeDecoder<float>(
-        m_RecurrentToCellWeightsTensor->GetTensorInfo(), m_RecurrentToCellWeightsTensor->GetTensor<void>());
-    std::unique_ptr<Decoder<float>> recurrentToOutputWeightsTensor = MakeDecoder<float>(
-        m_RecurrentToOutputWeightsTensor->GetTensorInfo(), m_RecurrentToOutputWeightsTensor->GetTensor<void>());
-
-    std::unique_ptr<Decoder<float>> inputGateBiasTensor;
-    std::unique_ptr<Decoder<float>> forgetGateBiasTensor = MakeDecoder<float>(
-        m_ForgetGateBiasTensor->GetTensorInfo(), m_ForgetGateBiasTensor->GetTensor<void>());
-    std::unique_ptr<Decoder<float>> cellBiasTensor = MakeDecoder<float>(
-        m_CellBiasTensor->GetTensorInfo(), m_CellBiasTensor->GetTensor<void>());
-    std::unique_ptr<Decoder<float>> outputGateBiasTensor = MakeDecoder<float>(
-        m_OutputGateBiasTensor->GetTensorInfo(), m_OutputGateBiasTensor->GetTensor<void>());
-
-    std::unique_ptr<Decoder<float>> cellToInputWeightsTensor;
-    std::unique_ptr<Decoder<float>> cellToForgetWeightsTensor;
-    std::unique_ptr<Decoder<float>> cellToOutputWeightsTensor;
-
-    std::unique_ptr<Decoder<float>> projectionWeightsTensor;
-    std::unique_ptr<Decoder<float>> projectionBiasTensor;
-
-    std::unique_ptr<Decoder<float>> inputLayerNormWeights;
-    std::unique_ptr<Decoder<float>> forgetLayerNormWeights;
-    std::unique_ptr<Decoder<float>> cellLayerNormWeights;
-    std::unique_ptr<Decoder<float>> outputLayerNormWeights;
-
-    if (useLayerNorm)
-    {
-        if (!useCifg)
-        {
-            inputLayerNormWeights = MakeDecoder<float>(
-                    m_InputLayerNormWeights->GetTensorInfo(), m_InputLayerNormWeights->GetTensor<void>());
-        }
-        forgetLayerNormWeights = MakeDecoder<float>(
-                m_ForgetLayerNormWeights->GetTensorInfo(), m_ForgetLayerNormWeights->GetTensor<void>());
-        cellLayerNormWeights = MakeDecoder<float>(
-                m_CellLayerNormWeights->GetTensorInfo(), m_CellLayerNormWeights->GetTensor<void>());
-        outputLayerNormWeights = MakeDecoder<float>(
-                m_OutputLayerNormWeights->GetTensorInfo(), m_OutputLayerNormWeights->GetTensor<void>());
-    }
-
-    if (!useCifg)
-    {
-        inputToInputWeightsTensor = MakeDecoder<float>(
-            m_InputToInputWeightsTensor->GetTensorInfo(), m_InputToInputWeightsTensor->GetTensor<void>());
-        inputGateBiasTensor = MakeDecoder<float>(
-            m_InputGateBiasTensor->GetTensorInfo(), m_InputGateBiasTensor->GetTensor<void>());
-        recurrentToInputWeightsTensor = MakeDecoder<float>(
-            m_RecurrentToInputWeightsTensor->GetTensorInfo(), m_RecurrentToInputWeightsTensor->GetTensor<void>());
-    }
-
-    if (usePeephole)
-    {
-        cellToForgetWeightsTensor = MakeDecoder<float>(
-            m_CellToForgetWeightsTensor->GetTensorInfo(), m_CellToForgetWeightsTensor->GetTensor<void>());
-        cellToOutputWeightsTensor = MakeDecoder<float>(
-            m_CellToOutputWeightsTensor->GetTensorInfo(), m_CellToOutputWeightsTensor->GetTensor<void>());
-    }
+    PackWeights(descriptor.m_RecurrentToForgetWeights, m_ForgetGateOffset, gateSize, m_RecurrentWeights);
+    PackWeights(descriptor.m_RecurrentToCellWeights, m_CellGateOffset, gateSize, m_RecurrentWeights);
+    PackWeights(descriptor.m_RecurrentToOutputWeights, m_OutputGateOffset, gateSize, m_RecurrentWeights);
 
-    if (!useCifg && usePeephole)
-    {
-        cellToInputWeightsTensor = MakeDecoder<float>(
-            m_CellToInputWeightsTensor->GetTensorInfo(), m_CellToInputWeightsTensor->GetTensor<void>());
-    }
+    PackVector(descriptor.m_ForgetGateBias, m_ForgetGateOffset, m_GateBias);
+    PackVector(descriptor.m_CellBias, m_CellGateOffset, m_GateBias);
+    PackVector(descriptor.m_OutputGateBias, m_OutputGateOffset, m_GateBias);
 
-    if (m_Data.m_Parameters.m_ProjectionEnabled)
+    if (parameters.m_PeepholeEnabled)
     {
-        projectionWeightsTensor = MakeDecoder<float>(
-            m_ProjectionWeightsTensor->GetTensorInfo(), m_ProjectionWeightsTensor->GetTensor<void>());
-        if (m_ProjectionBiasTensor)
+        m_CellToGateWeights.resize(gateSize);
+        if (!parameters.m_CifgEnabled)
         {
-            projectionBiasTensor = MakeDecoder<float>(
-                m_ProjectionBiasTensor->GetTensorInfo(), m_ProjectionBiasTensor->GetTensor<void>());
+            PackVector(descriptor.m_CellToInputWeights, 0, m_CellToGateWeights);
         }
+        PackVector(descriptor.m_CellToForgetWeights, m_ForgetGateOffset, m_CellToGateWeights);
+        PackVector(descriptor.m_CellToOutputWeights, m_OutputGateOffset, m_CellToGateWeights);
     }
 
-    if (!useLayerNorm)
+    if (parameters.m_LayerNormEnabled)
     {
-        // Initialize scratch buffers with bias.
-        if (!useCifg)
+        m_LayerNormWeights.resize(gateSize);
+        if (!parameters.m_CifgEnabled)
         {
-            VectorBatchVectorAssign(*inputGateBiasTensor,
-                                    nCell, nBatch, *inputGateScratch);
+            PackVector(descriptor.m_InputLayerNormWeights, 0, m_LayerNormWeights);
         }
-        VectorBatchVectorAssign(*forgetGateBiasTensor,
-                                nCell, nBatch, *forgetGateScratch);
-        VectorBatchVectorAssign(*cellBiasTensor,
-                                nCell, nBatch, *cellScratch);
-        VectorBatchVectorAssign(*outputGateBiasTensor,
-                                nCell, nBatch, *outputGateScratch);
+        PackVector(descriptor.m_ForgetLayerNormWeights, m_ForgetGateOffset, m_LayerNormWeights);
+        PackVector(descriptor.m_CellLayerNormWeights, m_CellGateOffset, m_LayerNormWeights);
+        PackVector(descriptor.m_OutputLayerNormWeights, m_OutputGateOffset, m_LayerNormWeights);
     }
-    else
+
+    if (parameters.m_ProjectionEnabled)
     {
-        // Initialize scratch buffers with zeroes.
-        if (!useCifg)
+        m_ProjectionWeights.resize(m_NumOutputs * m_NumCells);
+        PackWeights(descriptor.m_ProjectionWeights, 0, m_NumOutputs, m_ProjectionWeights);
+        if (descriptor.m_ProjectionBias)
         {
-            ZeroVector(*inputGateScratch, nCell * nBatch);
+            m_ProjectionBias = DecodeTensor(descriptor.m_ProjectionBias);
         }
-        ZeroVector(*forgetGateScratch, nCell * nBatch);
-        ZeroVector(*cellScratch      , nCell * nBatch);
-        ZeroVector(*outputGateScratch, nCell * nBatch);
     }
 
-    // For each batch and cell: compute input_weight * input.
-    if (!useCifg)
+    m_InputDecoder         = MakeDecoder<float>(info.m_InputTensorInfos[0]);
+    m_OutputStateInDecoder = MakeDecoder<float>(info.m_InputTensorInfos[1]);
+    m_CellStateInDecoder   = MakeDecoder<float>(info.m_InputTensorInfos[2]);
+
+    m_ScratchBufferEncoder  = MakeEncoder<float>(info.m_OutputTensorInfos[0]);
+    m_ScratchBufferDecoder  = MakeDecoder<float>(info.m_OutputTensorInfos[0]);
+    m_OutputStateOutEncoder = MakeEncoder<float>(info.m_OutputTensorInfos[1]);
+    m_CellStateOutEncoder   = MakeEncoder<float>(info.m_OutputTensorInfos[2]);
+    m_OutputEncoder         = MakeEncoder<float>(info.m_OutputTensorInfos[3]);
+
+    m_InputBuffer.resize(m_NumBatches * m_NumInputs);
+    m_OutputStateInBuffer.resize(m_NumBatches * m_NumOutputs);
+    m_CellStateInBuffer.resize(m_NumBatches * m_NumCells);
+    m_GateBuffer.resize(m_NumBatches * gateSize);
+    m_HiddenBuffer.resize(m_NumBatches * m_NumCells);
+    m_CellStateOutBuffer.resize(m_NumBatches * m_NumCells);
+    m_OutputBuffer.resize(m_NumBatches * m_NumOutputs);
+}
+
+void RefLstmWorkload::Execute() const
+{
+    // This is a porting of the LSTM::Eval() method in the Android code base
+    // Refer to: android/frameworks/ml/nn/common/operations/LSTM.cpp
+
+    const uint32_t nBatch  = m_NumBatches;
+    const uint32_t nInput  = m_NumInputs;
+    const uint32_t nCell   = m_NumCells;
+    const uint32_t nOutput = m_NumOutputs;
+
+    const uint32_t gateSize = m_NumGates * nCell;
+
+    const bool useCifg       = m_Data.m_Parameters.m_CifgEnabled;
+    const bool usePeephole   = m_Data.m_Parameters.m_PeepholeEnabled;
+    const bool useLayerNorm  = m_Data.m_Parameters.m_LayerNormEnabled;
+    const bool useProjection = m_Data.m_Parameters.m_ProjectionEnabled;
+
+    m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
+    m_OutputStateInDecoder->Reset(m_Data.m_Inputs[1]->Map());
+    m_CellStateInDecoder->Reset(m_Data.m_Inputs[2]->Map());
+
+    m_ScratchBufferEncoder->Reset(m_Data.m_Outputs[0]->Map());
+    m_ScratchBufferDecoder->Reset(m_Data.m_Outputs[0]->Map());
+    m_OutputStateOutEncoder->Reset(m_Data.m_Outputs[1]->Map());
+    m_CellStateOutEncoder->Reset(m_Data.m_Outputs[2]->Map());
+    m_OutputEncoder->Reset(m_Data.m_Outputs[3]->Map());
+
+    const float* inputData     = m_InputDecoder->DecodeChunk(m_InputBuffer.data(), nBatch * nInput);
+    const float* outputStateIn = m_OutputStateInDecoder->DecodeChunk(m_OutputStateInBuffer.data(), nBatch * nOutput);
+    const float* cellStateIn   = m_CellStateInDecoder->DecodeChunk(m_CellStateInBuffer.data(), nBatch * nCell);
+
+    float* cellStateOut = m_CellStateOutEncoder->GetChunkBuffer(m_CellStateOutBuffer.data());
+    float* output       = m_OutputEncoder->GetChunkBuffer(m_OutputBuffer.data());
+    float* gates        = m_GateBuffer.data();
+
+    // Without projection the hidden state is the output. Otherwise it is stored, in the scratch buffer's data type,
+    // in the output gate section of the scratch buffer.
+    const uint32_t hiddenOffset = (m_NumGates - 1) * nBatch * nCell;
+    (*m_ScratchBufferEncoder)[hiddenOffset];
+    (*m_ScratchBufferDecoder)[hiddenOffset];
+    float* hidden = useProjection ? m_ScratchBufferEncoder->GetChunkBuffer(m_HiddenBuffer.data()) : output;
+
+    if (!useLayerNorm)
     {
-        MatrixBatchVectorMultiplyAccumulate(*inputToInputWeightsTensor,
-                                            nCell, nInput, *inputData, nBatch, *inputGateScratch);
+        // Initialize the gates with bias.
+        VectorBatchVectorAssign(m_GateBias.data(), gateSize, nBatch, gates);
     }
-    MatrixBatchVectorMultiplyAccumulate(*inputToForgetWeightsTensor,
-                                        nCell, nInput, *inputData, nBatch, *forgetGateScratch);
-    MatrixBatchVectorMultiplyAccumulate(*inputToCellWeightsTensor,
-                                        nCell, nInput, *inputData, nBatch, *cellScratch);
-    MatrixBatchVectorMultiplyAccumulate(*inputToOutputWeightsTensor,
-                                        nCell, nInput, *inputData, nBatch, *outputGateScratch);
-
-    // For each batch and cell: compute recurrent_weight * output_state.
-    if (!useCifg)
+    else
     {
-        MatrixBatchVectorMultiplyAccumulate(*recurrentToInputWeightsTensor,
-                                            nCell, nOutput, *outputStateIn, nBatch, *inputGateScratch);
+        // Initialize the gates with zeroes, the bias is added after the normalization.
+        std::fill(gates, gates + nBatch * gateSize, 0.0f);
     }
-    MatrixBatchVectorMultiplyAccumulate(*recurrentToForgetWeightsTensor,
-                                        nCell, nOutput, *outputStateIn, nBatch, *forgetGateScratch);
-    MatrixBatchVectorMultiplyAccumulate(*recurrentToCellWeightsTensor,
-                                        nCell, nOutput, *outputStateIn, nBatch, *cellScratch);
-    MatrixBatchVectorMultiplyAccumulate(*recurrentToOutputWeightsTensor,
-                                        nCell, nOutput, *outputStateIn, nBatch, *outputGateScratch);
-
-    // For each batch and cell: update input gate.
-    if (!useCifg)
+
+    // For each batch and gate: compute input_weight * input and recurrent_weight * output_state.
+    PackedMatrixBatchVectorMultiplyAccumulate(m_InputWeights.data(), gateSize, nInput, inputData, nBatch, gates);
+    PackedMatrixBatchVectorMultiplyAccumulate(
+        m_RecurrentWeights.data(), gateSize, nOutput, outputStateIn, nBatch, gates);
+
+    ActivationFunction armnnActivationFunc = ActivationFunction::Sigmoid;
+    float a = 0;
+    float b = 0;
+    SetActivationParameters(m_Data.m_Parameters.m_ActivationFunc, armnnActivationFunc, a, b);
+
+    // Adds the peephole connection (when cellState is given) and applies the layer normalization to one gate.
+    auto updateGate = [&](float* gateValues, uint32_t gateOffset, const float* cellState)
     {
-        if (usePeephole)
+        if (cellState)
         {
-            VectorBatchVectorCwiseProductAccumulate(*cellToInputWeightsTensor,
-                                                    nCell, *cellStateIn, nBatch, *inputGateScratch);
+            VectorVectorCwiseProductAccumulate(m_CellToGateWeights.data() + gateOffset, cellState, nCell, gateValues);
         }
         if (useLayerNorm)
         {
-            MeanStddevNormalization(*inputGateScratchDecoder,
-                                    *inputGateScratch, nCell, nBatch, m_LayerNormEpsilon);
-            VectorBatchVectorCwiseProduct(*inputLayerNormWeights,
-                                          nCell, *inputGateScratchDecoder, nBatch, *inputGateScratch);
-            VectorBatchVectorAdd(*inputGateBiasTensor,
-                                 nCell, *inputGateScratchDecoder, nBatch, *inputGateScratch);
+            MeanStddevNormalization(gateValues, gateValues, nCell, 1, m_LayerNormEpsilon);
+            VectorVectorCwiseProduct(m_LayerNormWeights.data() + gateOffset, gateValues, nCell, gateValues);
+            VectorBatchVectorAdd(m_GateBias.data() + gateOffset, nCell, gateValues, 1, gateValues);
         }
-        Activation(*inputGateScratchDecoder, *inputGateScratch,
-                   TensorInfo({nCell, nBatch}, outputType),
-                   ActivationFunction::Sigmoid, 0, 0);
-    }
+    };
 
-    // For each batch and cell: update forget gate.
-    if (usePeephole)
+    for (uint32_t batch = 0; batch < nBatch; ++batch)
     {
-        VectorBatchVectorCwiseProductAccumulate(*cellToForgetWeightsTensor, nCell,
-                                                *cellStateIn, nBatch, *forgetGateScratch);
-    }
-    if (useLayerNorm)
-    {
-        MeanStddevNormalization(*forgetGateScratchDecoder,
-                                *forgetGateScratch, nCell, nBatch, m_LayerNormEpsilon);
-        VectorBatchVectorCwiseProduct(*forgetLayerNormWeights,
-                                      nCell, *forgetGateScratchDecoder, nBatch, *forgetGateScratch);
-        VectorBatchVectorAdd(*forgetGateBiasTensor,
-                             nCell, *forgetGateScratchDecoder, nBatch, *forgetGateScratch);
-    }
-    Activation(*forgetGateScratchDecoder, *forgetGateScratch,
-               TensorInfo({nCell, nBatch}, outputType),
-               ActivationFunction::Sigmoid, 0, 0);
+        float* batchGates = gates + batch * gateSize;
+        float* inputGate  = batchGates;
+        float* forgetGate = batchGates + m_ForgetGateOffset;
+        float* cellGate   = batchGates + m_CellGateOffset;
+        float* outputGate = batchGates + m_OutputGateOffset;
 
-    // For each batch and cell: update the cell.
-    if (useLayerNorm)
-    {
-        MeanStddevNormalization(*cellScratchDecoder,
-                                *cellScratch, nCell, nBatch, m_LayerNormEpsilon);
-        VectorBatchVectorCwiseProduct(*cellLayerNormWeights,
-                                      nCell, *cellScratchDecoder, nBatch, *cellScratch);
-        VectorBatchVectorAdd(*cellBiasTensor,
-                             nCell, *cellScratchDecoder, nBatch, *cellScratch);
-    }
+        const float* batchCellStateIn = cellStateIn + batch * nCell;
+        float* batchCellStateOut      = cellStateOut + batch * nCell;
+        const float* peepholeState    = usePeephole ? batchCellStateIn : nullptr;
 
-    VectorVectorCwiseProduct(*forgetGateScratchDecoder, *cellStateIn, nBatch * nCell, *cellStateOut);
+        // Update the input gate.
+        if (!useCifg)
+        {
+            updateGate(inputGate, 0, peepholeState);
+            Activation(inputGate, inputGate, nCell, ActivationFunction::Sigmoid, 0, 0);
+        }
 
-    ActivationFunction armnnActivationFunc = ActivationFunction::Sigmoid;
-    float a = 0;
-    float b = 0;
-    SetActivationParameters(m_Data.m_Parameters.m_ActivationFunc, armnnActivationFunc, a, b);
+        // Update the forget gate.
+        updateGate(forgetGate, m_ForgetGateOffset, peepholeState);
+        Activation(forgetGate, forgetGate, nCell, ActivationFunction::Sigmoid, 0, 0);
 
-    if (m_Data.m_Parameters.m_ActivationFunc > 0)
-    {
-        Activation(*cellScratchDecoder, *cellScratch,
-                   TensorInfo({nCell, nBatch}, outputType),
-                   armnnActivationFunc, a, b);
-    }
-    if (useCifg)
-    {
-        Sub1Vector(*forgetGateScratchDecoder, nBatch * nCell, *forgetGateScratch);
-        VectorVectorCwiseProductAccumulate(
-            *cellScratchDecoder, *forgetGateScratchDecoder, nBatch * nCell, *cellStateOut);
-    }
-    else
-    {
-        VectorVectorCwiseProductAccumulate(
-            *cellScratchDecoder, *inputGateScratchDecoder, nBatch * nCell, *cellStateOut);
-    }
-    if (m_Data.m_Parameters.m_ClippingThresCell > 0.0)
-    {
-        ClipVector(*cellStateOutDecoder, nBatch * nCell, m_Data.m_Parameters.m_ClippingThresCell, *cellStateOut);
-    }
+        // Update the cell.
+        updateGate(cellGate, m_CellGateOffset, nullptr);
+        VectorVectorCwiseProduct(forgetGate, batchCellStateIn, nCell, batchCellStateOut);
+        if (m_Data.m_Parameters.m_ActivationFunc > 0)
+        {
+            Activation(cellGate, cellGate, nCell, armnnActivationFunc, a, b);
+        }
+        if (useCifg)
+        {
+            Sub1Vector(forgetGate, nCell, forgetGate);
+            VectorVectorCwiseProductAccumulate(cellGate, forgetGate, nCell, batchCellStateOut);
+        }
+        else
+        {
+            VectorVectorCwiseProductAccumulate(cellGate, inputGate, nCell, batchCellStateOut);
+        }
+        if (m_Data.m_Parameters.m_ClippingThresCell > 0.0)
+        {
+            ClipVector(batchCellStateOut, nCell, m_Data.m_Parameters.m_ClippingThresCell, batchCellStateOut);
+        }
 
-    // For each batch and cell: update the output gate.
-    if (usePeephole)
-    {
-        VectorBatchVectorCwiseProductAccumulate(*cellToOutputWeightsTensor,
-                                                nCell, *cellStateOutDecoder, nBatch, *outputGateScratch);
-    }
-    if (useLayerNorm)
-    {
-        MeanStddevNormalization(*outputGateScratchDecoder,
-                                *outputGateScratch, nCell, nBatch, m_LayerNormEpsilon);
-        VectorBatchVectorCwiseProduct(*outputLayerNormWeights,
-                                      nCell, *outputGateScratchDecoder, nBatch, *outputGateScratch);
-        VectorBatchVectorAdd(*outputGateBiasTensor,
-                             nCell, *outputGateScratchDecoder, nBatch, *outputGateScratch);
-    }
-    Activation(*outputGateScratchDecoder, *outputGateScratch,
-               TensorInfo({nCell, nBatch}, outputType),
-               ActivationFunction::Sigmoid, 0, 0);
+        // Update the output gate.
+        updateGate(outputGate, m_OutputGateOffset, usePeephole ? batchCellStateOut : nullptr);
+        Activation(outputGate, outputGate, nCell, ActivationFunction::Sigmoid, 0, 0);
 
-    if (m_Data.m_Parameters.m_ActivationFunc > 0)
-    {
-        Activation(*cellStateOutDecoder, *cellScratch,
-                   TensorInfo({nCell, nBatch}, outputType),
-                   armnnActivationFunc, a, b);
+        // The cell gate values are no longer needed: reuse them for the activated cell state.
+        if (m_Data.m_Parameters.m_ActivationFunc > 0)
+        {
+            Activation(batchCellStateOut, cellGate, nCell, armnnActivationFunc, a, b);
+        }
+        else
+        {
+            std::copy(batchCellStateOut, batchCellStateOut + nCell, cellGate);
+        }
+        VectorVectorCwiseProduct(outputGate, cellGate, nCell, hidden + batch * nCell);
     }
 
-    VectorVectorCwiseProduct(*outputGateScratchDecoder, *cellScratchDecoder, nBatch * nCell, *outputGateScratch);
-
     // For each batch: update the projection and output_state.
-    if (m_Data.m_Parameters.m_ProjectionEnabled)
+    if (useProjection)
     {
-        if (m_ProjectionBiasTensor)
+        m_ScratchBufferEncoder->EncodeChunk(hidden, nBatch * nCell);
+        const float* hiddenState = m_ScratchBufferDecoder->DecodeChunk(m_HiddenBuffer.data(), nBatch * nCell);
+
+        if (!m_ProjectionBias.empty())
+        {
+            VectorBatchVectorAssign(m_ProjectionBias.data(), nOutput, nBatch, output);
+        }
+        else
         {
-            VectorBatchVectorAssign(*projectionBiasTensor,
-                                    nOutput, nBatch, *output);
+            std::fill(output, output + nBatch * nOutput, 0.0f);
         }
-        MatrixBatchVectorMultiplyAccumulate(*projectionWeightsTensor,
-                                            nOutput, nCell, *outputGateScratchDecoder, nBatch, *output);
+        PackedMatrixBatchVectorMultiplyAccumulate(
+            m_ProjectionWeights.data(), nOutput, nCell, hiddenState, nBatch, output);
 
         if (m_Data.m_Parameters.m_ClippingThresProj > 0.0)
         {
-            ClipVector(*outputDecoder, nBatch * nOutput, m_Data.m_Parameters.m_ClippingThresProj, *output);
+            ClipVector(output, nBatch * nOutput, m_Data.m_Parameters.m_ClippingThresProj, output);
         }
     }
-    else
-    {
-        CopyVector(*outputGateScratchDecoder, nBatch * nOutput, *output);
-    }
 
-    CopyVector(*outputDecoder, nBatch * nOutput, *outputStateOut);
+    m_CellStateOutEncoder->EncodeChunk(cellStateOut, nBatch * nCell);
+    m_OutputEncoder->EncodeChunk(output, nBatch * nOutput);
+    m_OutputStateOutEncoder->EncodeChunk(output, nBatch * nOutput);
 }
 
 } //namespace armnn
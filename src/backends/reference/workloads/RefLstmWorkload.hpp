@@ -10,6 +10,10 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
+#include "BaseIterator.hpp"
+
+#include <vector>
+
 namespace armnn
 {
 
@@ -21,27 +25,47 @@ public:
     virtual void Execute() const override;
 
 private:
-    std::unique_ptr<ScopedCpuTensorHandle> m_InputToInputWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_InputToForgetWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_InputToCellWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_InputToOutputWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_RecurrentToInputWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_RecurrentToForgetWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_RecurrentToCellWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_RecurrentToOutputWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_CellToInputWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_CellToForgetWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_CellToOutputWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_InputGateBiasTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_ForgetGateBiasTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_CellBiasTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_OutputGateBiasTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_ProjectionWeightsTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_ProjectionBiasTensor;
-    std::unique_ptr<ScopedCpuTensorHandle> m_InputLayerNormWeights;
-    std::unique_ptr<ScopedCpuTensorHandle> m_ForgetLayerNormWeights;
-    std::unique_ptr<ScopedCpuTensorHandle> m_CellLayerNormWeights;
-    std::unique_ptr<ScopedCpuTensorHandle> m_OutputLayerNormWeights;
+    unsigned int m_NumBatches;
+    unsigned int m_NumInputs;
+    unsigned int m_NumCells;
+    unsigned int m_NumOutputs;
+    unsigned int m_NumGates;
+
+    // Offsets of the forget, cell and output gates within the gate values of one batch. The input gate, when
+    // present, is always first.
+    unsigned int m_ForgetGateOffset;
+    unsigned int m_CellGateOffset;
+    unsigned int m_OutputGateOffset;
+
+    // The gate weights are decoded once and packed gate after gate (input, forget, cell, output; the input gate is
+    // left out when CIFG is enabled) so that each step runs one multiply for the input and one for the recurrent
+    // weights. The packed matrices are stored column-major: see PackedMatrixBatchVectorMultiplyAccumulate.
+    std::vector<float> m_InputWeights;
+    std::vector<float> m_RecurrentWeights;
+    std::vector<float> m_GateBias;
+    std::vector<float> m_CellToGateWeights;
+    std::vector<float> m_LayerNormWeights;
+    std::vector<float> m_ProjectionWeights;
+    std::vector<float> m_ProjectionBias;
+
+    std::unique_ptr<Decoder<float>> m_InputDecoder;
+    std::unique_ptr<Decoder<float>> m_OutputStateInDecoder;
+    std::unique_ptr<Decoder<float>> m_CellStateInDecoder;
+
+    std::unique_ptr<Encoder<float>> m_ScratchBufferEncoder;
+    std::unique_ptr<Decoder<float>> m_ScratchBufferDecoder;
+    std::unique_ptr<Encoder<float>> m_OutputStateOutEncoder;
+    std::unique_ptr<Encoder<float>> m_CellStateOutEncoder;
+    std::unique_ptr<Encoder<float>> m_OutputEncoder;
+
+    // Scratch space, allocated once so that Execute() does not allocate.
+    mutable std::vector<float> m_InputBuffer;
+    mutable std::vector<float> m_OutputStateInBuffer;
+    mutable std::vector<float> m_CellStateInBuffer;
+    mutable std::vector<float> m_GateBuffer;
+    mutable std::vector<float> m_HiddenBuffer;
+    mutable std::vector<float> m_CellStateOutBuffer;
+    mutable std::vector<float> m_OutputBuffer;
 
     float m_LayerNormEpsilon = static_cast<float>(1e-8);
 };
@@ -15,7 +15,9 @@
 #include <Profiling.hpp>
 
 #include <boost/log/trivial.hpp>
-#include <boost/numeric/conversion/cast.hpp>
+
+#include <cmath>
+#include <vector>
 
 using namespace armnn;
 using namespace armnnUtils;
@@ -23,9 +25,51 @@ using namespace armnnUtils;
 namespace
 {
 
+// Computes, for count interleaved sequences of size elements, the sum of each element's neighbours within radius
+// (itself included, clipped to the sequence). Element i of sequence s is at values[i * elementStride + s *
+// sequenceStride], and so is its sum in sums. The window slides one element at a time, adding the element that
+// enters it and subtracting the one that leaves it, so the cost does not depend on the radius. The running sums
+// are kept in double so that the subtractions do not accumulate rounding errors.
+void SlidingWindowSum(const float* values,
+                      float* sums,
+                      unsigned int size,
+                      unsigned int elementStride,
+                      unsigned int count,
+                      unsigned int sequenceStride,
+                      unsigned int radius,
+                      std::vector<double>& window)
+{
+    window.assign(count, 0.0);
+    for (unsigned int i = 0; i <= radius && i < size; ++i)
+    {
+        for (unsigned int s = 0; s < count; ++s)
+        {
+            window[s] += values[i * elementStride + s * sequenceStride];
+        }
+    }
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        const bool entering = i + radius + 1 < size;
+        const bool leaving = i >= radius;
+        for (unsigned int s = 0; s < count; ++s)
+        {
+            sums[i * elementStride + s * sequenceStride] = static_cast<float>(window[s]);
+            if (entering)
+            {
+                window[s] += values[(i + radius + 1) * elementStride + s * sequenceStride];
+            }
+            if (leaving)
+            {
+                window[s] -= values[(i - radius) * elementStride + s * sequenceStride];
+            }
+        }
+    }
+}
+
 // Helper function to compute "Within" normalization using Krichevsky 2012: Local Brightness Normalization.
-void NormalizeWithinUingLbr(Decoder<float>&    inputData,
-                            Encoder<float>&    outputData,
+void NormalizeWithinUingLbr(const float*       inputData,
+                            float*             outputData,
                             const TensorShape& tensorShape,
                             uint32_t           norm_size,
                             float              alpha,
@@ -36,62 +80,39 @@ void NormalizeWithinUingLbr(Decoder<float>&    inputData,
     const unsigned int depth = tensorShape[1];
     const unsigned int rows = tensorShape[2];
     const unsigned int cols = tensorShape[3];
+    const unsigned int planeSize = rows * cols;
 
-    int radius = boost::numeric_cast<int>(norm_size / 2u); /* Strong Assumption on rounding Mode */
+    const unsigned int radius = norm_size / 2u; /* Strong Assumption on rounding Mode */
 
-    for (unsigned int n = 0; n < batchSize; n++)
+    std::vector<float> squares(planeSize);
+    std::vector<float> rowSums(planeSize);
+    std::vector<float> accumulated(planeSize);
+    std::vector<double> window;
+
+    for (unsigned int plane = 0; plane < batchSize * depth; plane++)
     {
-        for (unsigned int c = 0; c < depth; c++)
+        const float* input = inputData + plane * planeSize;
+        float* output = outputData + plane * planeSize;
+
+        for (unsigned int i = 0; i < planeSize; i++)
         {
-            for (unsigned int h = 0; h < rows; h++)
-            {
-                for (unsigned int w = 0; w < cols; w++)
-                {
-                    float accumulated_scale = 0.0;
-                    for (int y = -radius; y <= radius; y++)
-                    {
-                        for (int x = -radius; x <= radius; x++)
-                        {
-                            int i = boost::numeric_cast<int>(w) + x;
-                            int j = boost::numeric_cast<int>(h) + y;
-
-                            if ((i < 0) || (i >= boost::numeric_cast<int>(cols)))
-                            {
-                                continue;
-                            }
-
-                            if ((j < 0) || (j >= boost::numeric_cast<int>(rows)))
-                            {
-                                continue;
-                            }
-
-                            unsigned int inputIndex = n * cols * rows * depth +
-                                                      c * cols * rows +
-                                                      boost::numeric_cast<unsigned int>(j) * cols +
-                                                      boost::numeric_cast<unsigned int>(i);
-                            inputData[inputIndex];
-                            float inval = inputData.Get();
-
-                            accumulated_scale += inval*inval;
-                        }
-                    }
-
-                    unsigned int index = n * cols * rows * depth +
-                                         c * cols * rows +
-                                         h * cols +
-                                         w;
-                    inputData[index];
-                    outputData[index];
-                    outputData.Set(inputData.Get() / (powf((kappa + (accumulated_scale * alpha)), beta)));
-                }
-            }
+            squares[i] = input[i] * input[i];
+        }
+
+        // The (2r+1)^2 neighbourhood sum is separable: sums along each row, then sums of those along each column.
+        SlidingWindowSum(squares.data(), rowSums.data(), cols, 1, rows, cols, radius, window);
+        SlidingWindowSum(rowSums.data(), accumulated.data(), rows, cols, cols, 1, radius, window);
+
+        for (unsigned int i = 0; i < planeSize; i++)
+        {
+            output[i] = input[i] / (powf((kappa + (accumulated[i] * alpha)), beta));
         }
     }
 }
 
 // Helper function to compute "Across" normalization using Krichevsky 2012: Local Brightness Normalization.
-void NormalizeAcrossUingLbr(Decoder<float>&    inputData,
-                            Encoder<float>&    outputData,
+void NormalizeAcrossUingLbr(const float*       inputData,
+                            float*             outputData,
                             const TensorShape& tensorShape,
                             uint32_t           norm_size,
                             float              alpha,
@@ -105,49 +126,38 @@ void NormalizeAcrossUingLbr(Decoder<float>&    inputData,
     const unsigned int depth     = tensorShape[dataLayoutIndexed.GetChannelsIndex()];
     const unsigned int rows      = tensorShape[dataLayoutIndexed.GetHeightIndex()];
     const unsigned int cols      = tensorShape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int planeSize = rows * cols;
+    const unsigned int batchElements = planeSize * depth;
+
+    const unsigned int radius = norm_size / 2u; /* Strong Assumption on rounding Mode */
 
-    int radius = boost::numeric_cast<int>(norm_size / 2u); /* Strong Assumption on rounding Mode */
+    // NCHW holds the channels of a pixel planeSize apart, NHWC holds them next to each other.
+    const bool isNchw = dataLayout == DataLayout::NCHW;
+    const unsigned int channelStride = isNchw ? planeSize : 1;
+    const unsigned int pixelStride   = isNchw ? 1 : depth;
+
+    std::vector<float> squares(batchElements);
+    std::vector<float> accumulated(batchElements);
+    std::vector<double> window;
 
     for (unsigned int n = 0; n < batchSize; n++)
     {
-        for (unsigned int c = 0; c < depth; c++)
+        const float* input = inputData + n * batchElements;
+        float* output = outputData + n * batchElements;
+
+        for (unsigned int i = 0; i < batchElements; i++)
         {
-            for (unsigned int h = 0; h < rows; h++)
-            {
-                for (unsigned int w = 0; w < cols; w++)
-                {
-                    float accumulated_scale = 0.0;
-                    for (int z = -radius; z <= radius; z++)
-                    {
-                        int k = boost::numeric_cast<int>(c) + z;
-
-                        if ((k < 0) || (k >= boost::numeric_cast<int>(depth)))
-                        {
-                            continue;
-                        }
-
-                        unsigned inputIndex = dataLayoutIndexed.GetIndex(tensorShape,
-                                                                         n,
-                                                                         boost::numeric_cast<unsigned int>(k),
-                                                                         h,
-                                                                         w);
-
-                        inputData[inputIndex];
-                        float inval = inputData.Get();
-
-                        accumulated_scale += inval * inval;
-                    }
-
-                    float scale = kappa + (accumulated_scale * alpha);
-                    scale = powf(scale, -beta);
-
-                    unsigned index = dataLayoutIndexed.GetIndex(tensorShape, n, c, h, w);
-
-                    inputData[index];
-                    outputData[index];
-                    outputData.Set(scale * inputData.Get());
-                }
-            }
+            squares[i] = input[i] * input[i];
+        }
+
+        SlidingWindowSum(squares.data(), accumulated.data(), depth, channelStride, planeSize, pixelStride,
+                         radius, window);
+
+        for (unsigned int i = 0; i < batchElements; i++)
+        {
+            float scale = kappa + (accumulated[i] * alpha);
+            scale = powf(scale, -beta);
+            output[i] = scale * input[i];
         }
     }
 }
@@ -171,12 +181,18 @@ void RefNormalizationWorkload::Execute() const
     auto inputDecoder  = MakeDecoder<float>(inputInfo, m_Data.m_Inputs[0]->Map());
     auto outputEncoder = MakeEncoder<float>(inputInfo, m_Data.m_Outputs[0]->Map());
 
+    const unsigned int numElements = inputInfo.GetNumElements();
+    std::vector<float> inputBuffer(numElements);
+    std::vector<float> outputBuffer(numElements);
+    const float* input = inputDecoder->DecodeChunk(inputBuffer.data(), numElements);
+    float* output = outputEncoder->GetChunkBuffer(outputBuffer.data());
+
     if (NormalizationAlgorithmMethod::LocalBrightness == m_Data.m_Parameters.m_NormMethodType)
     {
         if (NormalizationAlgorithmChannel::Within == m_Data.m_Parameters.m_NormChannelType)
         {
-            NormalizeWithinUingLbr(*inputDecoder,
-                                   *outputEncoder,
+            NormalizeWithinUingLbr(input,
+                                   output,
                                    inputInfo.GetShape(),
                                    m_Data.m_Parameters.m_NormSize,
                                    m_Data.m_Parameters.m_Alpha,
@@ -185,8 +201,8 @@ void RefNormalizationWorkload::Execute() const
         }
         else if (NormalizationAlgorithmChannel::Across == m_Data.m_Parameters.m_NormChannelType)
         {
-            NormalizeAcrossUingLbr(*inputDecoder,
-                                   *outputEncoder,
+            NormalizeAcrossUingLbr(input,
+                                   output,
                                    inputInfo.GetShape(),
                                    m_Data.m_Parameters.m_NormSize,
                                    m_Data.m_Parameters.m_Alpha,
@@ -199,6 +215,7 @@ void RefNormalizationWorkload::Execute() const
             BOOST_LOG_TRIVIAL(warning) << "Illegal NORMALIZATION mode in normalization_f32";
             return;
         }
+        outputEncoder->EncodeChunk(output, numElements);
     }
     else
     {
@@ -7,6 +7,8 @@
 
 #include <armnn/TypesUtils.hpp>
 
+#include <QuantizedConverter.hpp>
+
 
 namespace armnn
 {
@@ -17,12 +19,8 @@ namespace
 template<typename T>
 void QuantizeImpl(const void *input, void *output, size_t numValues, float scale, int offset)
 {
-    auto in = static_cast<const float *>(input);
-    auto out = static_cast<T *>(output);
-    for (size_t i = 0; i < numValues; i++, in++, out++)
-    {
-        *out = armnn::Quantize<T>(*in, scale, offset);
-    }
+    armnnUtils::QuantizedConverter::Quantize(static_cast<const float*>(input), numValues, static_cast<T*>(output),
+                                             scale, offset);
 }
 
 } //namespace
@@ -17,6 +17,13 @@
 namespace armnn
 {
 
+void RefResizeWorkload::PostAllocationConfigure()
+{
+    m_Tables = ComputeResizeTables(GetTensorInfo(m_Data.m_Inputs[0]),
+                                   GetTensorInfo(m_Data.m_Outputs[0]),
+                                   m_Data.m_Parameters.m_DataLayout);
+}
+
 void RefResizeWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefResizeWorkload_Execute");
@@ -29,7 +36,8 @@ void RefResizeWorkload::Execute() const
     std::unique_ptr<Encoder<float>> encoderPtr = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
     Encoder<float> &encoder = *encoderPtr;
 
-    Resize(decoder, inputInfo, encoder, outputInfo, m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_Method);
+    Resize(decoder, inputInfo, encoder, outputInfo, m_Tables,
+           m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_Method);
 }
 
 } //namespace armnn
@@ -8,6 +8,8 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
+#include "Resize.hpp"
+
 namespace armnn
 {
 
@@ -15,7 +17,13 @@ class RefResizeWorkload : public BaseWorkload<ResizeQueueDescriptor>
 {
 public:
     using BaseWorkload<ResizeQueueDescriptor>::BaseWorkload;
+
+    void PostAllocationConfigure() override;
+
     virtual void Execute() const override;
+
+private:
+    ResizeTables m_Tables;
 };
 
 } //namespace armnn
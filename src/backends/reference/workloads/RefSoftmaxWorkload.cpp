@@ -17,10 +17,29 @@
 namespace armnn
 {
 
+RefSoftmaxWorkload::RefSoftmaxWorkload(const SoftmaxQueueDescriptor& descriptor, const WorkloadInfo& info)
+    : BaseWorkload<SoftmaxQueueDescriptor>(descriptor, info)
+{
+    // QuantisedSymm16 values are exponentiated through a table, their sums accumulated in integers.
+    const TensorInfo& inputInfo = info.m_InputTensorInfos[0];
+    const TensorInfo& outputInfo = info.m_OutputTensorInfos[0];
+    if (QSymm16Softmax::IsSupported(inputInfo, outputInfo, descriptor.m_Parameters.m_Beta))
+    {
+        m_QSymm16Kernel = std::make_unique<QSymm16Softmax>(inputInfo, outputInfo, descriptor.m_Parameters.m_Beta,
+                                                           descriptor.m_Parameters.m_Axis);
+    }
+}
+
 void RefSoftmaxWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSoftmaxWorkload_Execute");
 
+    if (m_QSymm16Kernel)
+    {
+        m_QSymm16Kernel->Execute(GetInputTensorData<int16_t>(0, m_Data), GetOutputTensorData<int16_t>(0, m_Data));
+        return;
+    }
+
     const TensorInfo &inputTensorInfo = GetTensorInfo(m_Data.m_Inputs[0]);
 
     std::unique_ptr<Decoder<float>> decoderPtr = MakeDecoder<float>(inputTensorInfo, m_Data.m_Inputs[0]->Map());
@@ -7,6 +7,7 @@
 
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
+#include "QSymm16Kernels.hpp"
 
 namespace armnn
 {
@@ -14,8 +15,13 @@ namespace armnn
 class RefSoftmaxWorkload : public BaseWorkload<SoftmaxQueueDescriptor>
 {
 public:
-    using BaseWorkload<SoftmaxQueueDescriptor>::BaseWorkload;
+    explicit RefSoftmaxWorkload(const SoftmaxQueueDescriptor& descriptor, const WorkloadInfo& info);
+
     virtual void Execute() const override;
+
+private:
+    /// The integer kernel, when the input and output are QuantisedSymm16.
+    std::unique_ptr<QSymm16Softmax> m_QSymm16Kernel;
 };
 
 } //namespace armnn
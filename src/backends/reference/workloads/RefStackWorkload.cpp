@@ -22,23 +22,20 @@ void RefStackWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefStackWorkload_Execute");
 
-    // Can perform a simple concatenation when axis == 0
-    if (!m_Data.m_Parameters.m_Axis)
+    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+
+    // Without any requantization the inputs are interleaved into the output a block at a time.
+    bool inputsMatchOutputType = true;
+    std::vector<const void*> inputs;
+    for (const ITensorHandle* input : m_Data.m_Inputs)
+    {
+        inputsMatchOutputType &= GetTensorInfo(input).IsTypeSpaceMatch(outputInfo);
+        inputs.push_back(input->Map());
+    }
+
+    if (inputsMatchOutputType)
     {
-        float* output = GetOutputTensorData<float>(0, m_Data);
-        BOOST_ASSERT(output != nullptr);
-
-        unsigned int numInputs = m_Data.m_Parameters.m_NumInputs;
-        unsigned int inputLength = GetTensorInfo(m_Data.m_Inputs[0]).GetNumElements();
-
-        for (unsigned int inputIdx=0; inputIdx<numInputs; ++inputIdx)
-        {
-            const float* input = GetInputTensorData<float>(inputIdx, m_Data);
-            for (unsigned int elmt=0; elmt<inputLength; ++elmt)
-            {
-                output[(inputIdx * inputLength) + elmt] = input[elmt];
-            }
-        }
+        Stack(m_Data, inputs, m_Data.m_Outputs[0]->Map());
         return;
     }
 
@@ -48,8 +45,7 @@ void RefStackWorkload::Execute() const
         inputDecoders.push_back(MakeDecoder<float>(GetTensorInfo(m_Data.m_Inputs[i]),
                                                    m_Data.m_Inputs[i]->Map()));
     }
-    std::unique_ptr<Encoder<float>> outputEncoder = MakeEncoder<float>(GetTensorInfo(m_Data.m_Outputs[0]),
-                                                                       m_Data.m_Outputs[0]->Map());
+    std::unique_ptr<Encoder<float>> outputEncoder = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
 
     Stack(m_Data, inputDecoders, *outputEncoder);
 }
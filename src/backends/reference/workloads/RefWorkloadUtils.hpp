@@ -13,6 +13,8 @@
 #include <reference/RefTensorHandle.hpp>
 
 #include <Half.hpp>
+#include <QuantizedConverter.hpp>
+
 #include <boost/polymorphic_cast.hpp>
 
 namespace armnn
@@ -76,28 +78,22 @@ template<typename T>
 std::vector<float> Dequantize(const T* quant, const TensorInfo& info)
 {
     std::vector<float> ret(info.GetNumElements());
-    for (size_t i = 0; i < info.GetNumElements(); i++)
-    {
-        ret[i] = armnn::Dequantize(quant[i], info.GetQuantizationScale(), info.GetQuantizationOffset());
-    }
+    armnnUtils::QuantizedConverter::Dequantize(quant, ret.size(), ret.data(),
+                                               info.GetQuantizationScale(), info.GetQuantizationOffset());
     return ret;
 }
 
 template<typename T>
 inline void Dequantize(const T* inputData, float* outputData, const TensorInfo& info)
 {
-    for (unsigned int i = 0; i < info.GetNumElements(); i++)
-    {
-        outputData[i] = Dequantize<T>(inputData[i], info.GetQuantizationScale(), info.GetQuantizationOffset());
-    }
+    armnnUtils::QuantizedConverter::Dequantize(inputData, info.GetNumElements(), outputData,
+                                               info.GetQuantizationScale(), info.GetQuantizationOffset());
 }
 
 inline void Quantize(uint8_t* quant, const float* dequant, const TensorInfo& info)
 {
-    for (size_t i = 0; i < info.GetNumElements(); i++)
-    {
-        quant[i] = armnn::Quantize<uint8_t>(dequant[i], info.GetQuantizationScale(), info.GetQuantizationOffset());
-    }
+    armnnUtils::QuantizedConverter::Quantize(dequant, info.GetNumElements(), quant,
+                                             info.GetQuantizationScale(), info.GetQuantizationOffset());
 }
 
 } //namespace armnn
@@ -4,8 +4,9 @@
 //
 
 #include "Resize.hpp"
+#include "ThreadPool.hpp"
 
-#include "TensorBufferArrayView.hpp"
+#include <TensorUtils.hpp>
 
 #include <boost/numeric/conversion/cast.hpp>
 
@@ -25,141 +26,166 @@ inline float Lerp(float a, float b, float w)
     return w * b + (1.f - w) * a;
 }
 
-inline double EuclideanDistance(float Xa, float Ya, const unsigned int Xb, const unsigned int Yb)
+ResizeAxisTable ComputeAxisTable(unsigned int inputSize, unsigned int outputSize)
 {
-    return std::sqrt(pow(Xa - boost::numeric_cast<float>(Xb), 2) + pow(Ya - boost::numeric_cast<float>(Yb), 2));
+    // How much to scale pixel coordinates in the output image, to get the corresponding pixel coordinates
+    // in the input image.
+    const float scale = boost::numeric_cast<float>(inputSize) / boost::numeric_cast<float>(outputSize);
+
+    ResizeAxisTable table;
+    table.m_Lower.resize(outputSize);
+    table.m_Upper.resize(outputSize);
+    table.m_Weights.resize(outputSize);
+
+    for (unsigned int i = 0; i < outputSize; ++i)
+    {
+        // Corresponding real-valued coordinate in input image.
+        const float inputCoord = boost::numeric_cast<float>(i) * scale;
+
+        // Discrete coordinate of the top-left texel (in the 2x2 texel area used for interpolation).
+        const float floorCoord = floorf(inputCoord);
+        const unsigned int lower = boost::numeric_cast<unsigned int>(floorCoord);
+
+        table.m_Lower[i]   = lower;
+        table.m_Upper[i]   = std::min(lower + 1, inputSize - 1u);
+        table.m_Weights[i] = inputCoord - floorCoord;
+    }
+    return table;
+}
+
+/// Resizes one batch. The data is viewed as numPlanes planes of [height][width][numInner] values: NCHW has one
+/// plane per channel and numInner = 1, NHWC has a single plane with numInner = channels, so that for NHWC the
+/// interpolation runs contiguously across channels. Only the output rows [rowBegin, rowEnd) of each plane are
+/// computed.
+void ResizeBatch(const float*        input,
+                 float*              output,
+                 unsigned int        numPlanes,
+                 unsigned int        numInner,
+                 unsigned int        inputHeight,
+                 unsigned int        inputWidth,
+                 const ResizeTables& tables,
+                 unsigned int        rowBegin,
+                 unsigned int        rowEnd,
+                 ResizeMethod        resizeMethod)
+{
+    const unsigned int outputHeight = boost::numeric_cast<unsigned int>(tables.m_Rows.m_Lower.size());
+    const unsigned int outputWidth  = boost::numeric_cast<unsigned int>(tables.m_Columns.m_Lower.size());
+
+    for (unsigned int plane = 0; plane < numPlanes; ++plane)
+    {
+        const float* inputPlane = input + plane * inputHeight * inputWidth * numInner;
+        float* outputPlane      = output + plane * outputHeight * outputWidth * numInner;
+
+        for (unsigned int y = rowBegin; y < rowEnd; ++y)
+        {
+            const float* row0 = inputPlane + tables.m_Rows.m_Lower[y] * inputWidth * numInner;
+            const float* row1 = inputPlane + tables.m_Rows.m_Upper[y] * inputWidth * numInner;
+            const float yw    = tables.m_Rows.m_Weights[y];
+
+            for (unsigned int x = 0; x < outputWidth; ++x)
+            {
+                const unsigned int x0 = tables.m_Columns.m_Lower[x] * numInner;
+                float* result = outputPlane + (y * outputWidth + x) * numInner;
+
+                if (resizeMethod == ResizeMethod::NearestNeighbor)
+                {
+                    // The top-left corner of the output texel is projected into the input image, so the
+                    // nearest input texel is always the top-left one of the interpolation area.
+                    std::copy(row0 + x0, row0 + x0 + numInner, result);
+                    continue;
+                }
+
+                const unsigned int x1 = tables.m_Columns.m_Upper[x] * numInner;
+                const float xw        = tables.m_Columns.m_Weights[x];
+
+                for (unsigned int i = 0; i < numInner; ++i)
+                {
+                    const float ly0 = Lerp(row0[x0 + i], row0[x1 + i], xw); // lerp along row y0.
+                    const float ly1 = Lerp(row1[x0 + i], row1[x1 + i], xw); // lerp along row y1.
+                    result[i] = Lerp(ly0, ly1, yw);
+                }
+            }
+        }
+    }
 }
 
 }// anonymous namespace
 
-void Resize(Decoder<float>&   in,
-            const TensorInfo& inputInfo,
-            Encoder<float>&   out,
-            const TensorInfo& outputInfo,
-            DataLayoutIndexed dataLayout,
-            armnn::ResizeMethod resizeMethod)
+ResizeTables ComputeResizeTables(const TensorInfo& inputInfo,
+                                 const TensorInfo& outputInfo,
+                                 DataLayoutIndexed dataLayout)
 {
     // We follow the definition of TensorFlow and AndroidNN: the top-left corner of a texel in the output
     // image is projected into the input image to figure out the interpolants and weights. Note that this
     // will yield different results than if projecting the centre of output texels.
+    ResizeTables tables;
+    tables.m_Rows    = ComputeAxisTable(inputInfo.GetShape()[dataLayout.GetHeightIndex()],
+                                        outputInfo.GetShape()[dataLayout.GetHeightIndex()]);
+    tables.m_Columns = ComputeAxisTable(inputInfo.GetShape()[dataLayout.GetWidthIndex()],
+                                        outputInfo.GetShape()[dataLayout.GetWidthIndex()]);
+    return tables;
+}
+
+void Resize(Decoder<float>&     in,
+            const TensorInfo&   inputInfo,
+            Encoder<float>&     out,
+            const TensorInfo&   outputInfo,
+            const ResizeTables& tables,
+            DataLayoutIndexed   dataLayout,
+            armnn::ResizeMethod resizeMethod)
+{
+    if (resizeMethod != ResizeMethod::Bilinear && resizeMethod != ResizeMethod::NearestNeighbor)
+    {
+        throw armnn::InvalidArgumentException("Unknown resize method: " +
+                                              std::to_string(static_cast<int>(resizeMethod)));
+    }
 
-    const unsigned int batchSize = inputInfo.GetShape()[0];
-    const unsigned int channelCount = inputInfo.GetShape()[dataLayout.GetChannelsIndex()];
+    const TensorShape& inputShape  = inputInfo.GetShape();
+    const TensorShape& outputShape = outputInfo.GetShape();
 
-    const unsigned int inputHeight = inputInfo.GetShape()[dataLayout.GetHeightIndex()];
-    const unsigned int inputWidth = inputInfo.GetShape()[dataLayout.GetWidthIndex()];
-    const unsigned int outputHeight = outputInfo.GetShape()[dataLayout.GetHeightIndex()];
-    const unsigned int outputWidth = outputInfo.GetShape()[dataLayout.GetWidthIndex()];
+    const unsigned int batchSize    = inputShape[0];
+    const unsigned int channelCount = inputShape[dataLayout.GetChannelsIndex()];
+    const unsigned int inputHeight  = inputShape[dataLayout.GetHeightIndex()];
+    const unsigned int inputWidth   = inputShape[dataLayout.GetWidthIndex()];
 
-    // How much to scale pixel coordinates in the output image, to get the corresponding pixel coordinates
-    // in the input image.
-    const float scaleY = boost::numeric_cast<float>(inputHeight) / boost::numeric_cast<float>(outputHeight);
-    const float scaleX = boost::numeric_cast<float>(inputWidth) / boost::numeric_cast<float>(outputWidth);
+    const bool isNhwc = dataLayout.GetDataLayout() == DataLayout::NHWC;
+    const unsigned int numPlanes = isNhwc ? 1u : channelCount;
+    const unsigned int numInner  = isNhwc ? channelCount : 1u;
 
-    TensorShape inputShape =  inputInfo.GetShape();
-    TensorShape outputShape =  outputInfo.GetShape();
+    // Each batch is decoded and encoded in one go, so the interpolation works on plain float buffers.
+    const unsigned int inputBatchSize  = GetNumElementsBetween(inputShape, 1, inputShape.GetNumDimensions());
+    const unsigned int outputBatchSize = GetNumElementsBetween(outputShape, 1, outputShape.GetNumDimensions());
+
+    std::vector<float> inputBuffer(inputBatchSize);
+    std::vector<float> outputBuffer(outputBatchSize);
 
     for (unsigned int n = 0; n < batchSize; ++n)
     {
-        for (unsigned int c = 0; c < channelCount; ++c)
-        {
-            for (unsigned int y = 0; y < outputHeight; ++y)
-            {
-                // Corresponding real-valued height coordinate in input image.
-                const float iy = boost::numeric_cast<float>(y) * scaleY;
+        in[n * inputBatchSize];
+        out[n * outputBatchSize];
 
-                // Discrete height coordinate of top-left texel (in the 2x2 texel area used for interpolation).
-                const float fiy = floorf(iy);
-                const unsigned int y0 = boost::numeric_cast<unsigned int>(fiy);
+        const float* inputValues = in.DecodeChunk(inputBuffer.data(), inputBatchSize);
+        float* outputValues      = out.GetChunkBuffer(outputBuffer.data());
 
-                // Interpolation weight (range [0,1]).
-                const float yw = iy - fiy;
+        ParallelFor(0, outputShape[dataLayout.GetHeightIndex()], [&](unsigned int rowBegin, unsigned int rowEnd)
+        {
+            ResizeBatch(inputValues, outputValues, numPlanes, numInner, inputHeight, inputWidth, tables,
+                        rowBegin, rowEnd, resizeMethod);
+        });
 
-                for (unsigned int x = 0; x < outputWidth; ++x)
-                {
-                    // Real-valued and discrete width coordinates in input image.
-                    const float ix = boost::numeric_cast<float>(x) * scaleX;
-                    const float fix = floorf(ix);
-                    const unsigned int x0 = boost::numeric_cast<unsigned int>(fix);
-
-                    // Interpolation weight (range [0,1]).
-                    const float xw = ix - fix;
-
-                    // Discrete width/height coordinates of texels below and to the right of (x0, y0).
-                    const unsigned int x1 = std::min(x0 + 1, inputWidth - 1u);
-                    const unsigned int y1 = std::min(y0 + 1, inputHeight - 1u);
-
-                    float interpolatedValue;
-                    switch (resizeMethod)
-                    {
-                        case armnn::ResizeMethod::Bilinear:
-                        {
-                            in[dataLayout.GetIndex(inputShape, n, c, y0, x0)];
-                            float input1 = in.Get();
-                            in[dataLayout.GetIndex(inputShape, n, c, y0, x1)];
-                            float input2 = in.Get();
-                            in[dataLayout.GetIndex(inputShape, n, c, y1, x0)];
-                            float input3 = in.Get();
-                            in[dataLayout.GetIndex(inputShape, n, c, y1, x1)];
-                            float input4 = in.Get();
-
-                            const float ly0 = Lerp(input1, input2, xw); // lerp along row y0.
-                            const float ly1 = Lerp(input3, input4, xw); // lerp along row y1.
-                            interpolatedValue = Lerp(ly0, ly1, yw);
-                            break;
-                        }
-                        case armnn::ResizeMethod::NearestNeighbor:
-                        {
-                            // calculate euclidean distance to the 4 neighbours
-                            auto distance00 = EuclideanDistance(fix, fiy, x0, y0);
-                            auto distance01 = EuclideanDistance(fix, fiy, x0, y1);
-                            auto distance10 = EuclideanDistance(fix, fiy, x1, y0);
-                            auto distance11 = EuclideanDistance(fix, fiy, x1, y1);
-
-                            auto minimum = std::min( { distance00, distance01, distance10, distance11 } );
-
-                            unsigned int xNearest = 0;
-                            unsigned int yNearest = 0;
-
-                            if (minimum == distance00)
-                            {
-                               xNearest = x0;
-                               yNearest = y0;
-                            }
-                            else if (minimum == distance01)
-                            {
-                                xNearest = x0;
-                                yNearest = y1;
-                            }
-                            else if (minimum == distance10)
-                            {
-                                xNearest = x1;
-                                yNearest = y0;
-                            }
-                            else if (minimum == distance11)
-                            {
-                                xNearest = x1;
-                                yNearest = y1;
-                            }
-                            else
-                            {
-                                throw armnn::InvalidArgumentException("Resize Nearest Neighbor failure");
-                            }
-
-                            in[dataLayout.GetIndex(inputShape, n, c, yNearest, xNearest)];
-                            interpolatedValue = in.Get();
-                            break;
-                        }
-                        default:
-                            throw armnn::InvalidArgumentException("Unknown resize method: " +
-                                                                  std::to_string(static_cast<int>(resizeMethod)));
-                    }
-                    out[dataLayout.GetIndex(outputShape, n, c, y, x)];
-                    out.Set(interpolatedValue);
-                }
-            }
-        }
+        out.EncodeChunk(outputValues, outputBatchSize);
     }
 }
 
+void Resize(Decoder<float>&     in,
+            const TensorInfo&   inputInfo,
+            Encoder<float>&     out,
+            const TensorInfo&   outputInfo,
+            DataLayoutIndexed   dataLayout,
+            armnn::ResizeMethod resizeMethod)
+{
+    Resize(in, inputInfo, out, outputInfo, ComputeResizeTables(inputInfo, outputInfo, dataLayout),
+           dataLayout, resizeMethod);
+}
+
 } //namespace armnn
@@ -10,9 +10,38 @@
 
 #include <DataLayoutIndexed.hpp>
 
+#include <vector>
+
 namespace armnn
 {
 
+/// Source texels and interpolation weights along one spatial dimension of a resize, for each output coordinate.
+struct ResizeAxisTable
+{
+    std::vector<unsigned int> m_Lower;   ///< Input texel at or before the projected output coordinate.
+    std::vector<unsigned int> m_Upper;   ///< Next input texel, clamped to the input size.
+    std::vector<float>        m_Weights; ///< Interpolation weight of the upper texel (range [0,1]).
+};
+
+/// Resize interpolation tables. They only depend on the tensor shapes, so workloads compute them once.
+struct ResizeTables
+{
+    ResizeAxisTable m_Rows;
+    ResizeAxisTable m_Columns;
+};
+
+ResizeTables ComputeResizeTables(const TensorInfo&             inputInfo,
+                                 const TensorInfo&             outputInfo,
+                                 armnnUtils::DataLayoutIndexed dataLayout);
+
+void Resize(Decoder<float>&               in,
+            const TensorInfo&             inputInfo,
+            Encoder<float>&               out,
+            const TensorInfo&             outputInfo,
+            const ResizeTables&           tables,
+            armnnUtils::DataLayoutIndexed dataLayout,
+            ResizeMethod                  resizeMethod);
+
 void Resize(Decoder<float>&               in,
             const TensorInfo&             inputInfo,
             Encoder<float>&               out,
@@ -4,15 +4,201 @@
 //
 
 #include "Softmax.hpp"
+#include "ThreadPool.hpp"
 
 #include <TensorUtils.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
 #include <vector>
 
 namespace armnn
 {
 
+void FastExp(float* values, unsigned int numElements)
+{
+    constexpr float log2e = 1.44269504088896341f;
+    constexpr float ln2Hi = 0.693359375f;
+    constexpr float ln2Lo = -2.12194440e-4f;
+
+    // Past -88 the exponent computed below reaches the denormal range and its bit pattern encodes 0.
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        values[i] = std::min(std::max(values[i], -88.0f), 88.0f);
+    }
+
+    for (unsigned int i = 0; i < numElements; ++i)
+    {
+        // e^x = 2^n * e^r with |r| <= ln(2)/2. n is rounded half away from zero through a truncating conversion,
+        // which unlike std::round maps to a single vector instruction.
+        const float x     = values[i];
+        const float nf    = x * log2e;
+        const int32_t n   = static_cast<int32_t>(nf + std::copysign(0.5f, nf));
+        const float fn    = static_cast<float>(n);
+        const float r     = (x - fn * ln2Hi) - fn * ln2Lo;
+
+        float p = 1.9875691500e-4f;
+        p = p * r + 1.3981999507e-3f;
+        p = p * r + 8.3334519073e-3f;
+        p = p * r + 4.1665795894e-2f;
+        p = p * r + 1.6666665459e-1f;
+        p = p * r + 5.0000001201e-1f;
+        const float er = p * r * r + r + 1.0f;
+
+        const int32_t scaleBits = (n + 127) << 23;
+        float scale;
+        std::memcpy(&scale, &scaleBits, sizeof(scale));
+
+        values[i] = er * scale;
+    }
+}
+
+inline float FastExp(float x)
+{
+    FastExp(&x, 1);
+    return x;
+}
+
+namespace
+{
+
+/// Number of elements covered by each partial maximum in SoftmaxContiguous.
+constexpr unsigned int g_SoftmaxBlockSize = 64;
+
+/// Softmax over a contiguous row. The input is read in a single pass that keeps an online
+/// maximum and sum: each block is exponentiated against its own maximum and folded into the running sum, which
+/// is rescaled whenever the running maximum grows. A second, write-only pass rescales each block by its
+/// correction factor, so every input element goes through exactly one exponential.
+void SoftmaxContiguous(const float* in,
+                       float* out,
+                       unsigned int axisSize,
+                       float beta,
+                       std::vector<float>& blockMaxValues)
+{
+    const unsigned int numBlocks = (axisSize + g_SoftmaxBlockSize - 1) / g_SoftmaxBlockSize;
+    blockMaxValues.resize(numBlocks);
+
+    float maxValue = std::numeric_limits<float>::lowest();
+    float sum      = 0.0f;
+
+    for (unsigned int block = 0; block < numBlocks; ++block)
+    {
+        const unsigned int begin = block * g_SoftmaxBlockSize;
+        const unsigned int end   = std::min(begin + g_SoftmaxBlockSize, axisSize);
+
+        float blockMax = std::numeric_limits<float>::lowest();
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            blockMax = std::max(blockMax, in[i]);
+        }
+
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            out[i] = (in[i] - blockMax) * beta;
+        }
+        FastExp(out + begin, end - begin);
+
+        float blockSum = 0.0f;
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            blockSum += out[i];
+        }
+
+        if (block == 0)
+        {
+            maxValue = blockMax;
+            sum      = blockSum;
+        }
+        else if (blockMax > maxValue)
+        {
+            sum      = sum * FastExp((maxValue - blockMax) * beta) + blockSum;
+            maxValue = blockMax;
+        }
+        else
+        {
+            sum += blockSum * FastExp((blockMax - maxValue) * beta);
+        }
+        blockMaxValues[block] = blockMax;
+    }
+
+    const float invSum = 1.0f / sum;
+    for (unsigned int block = 0; block < numBlocks; ++block)
+    {
+        const unsigned int begin = block * g_SoftmaxBlockSize;
+        const unsigned int end   = std::min(begin + g_SoftmaxBlockSize, axisSize);
+        const float factor = FastExp((blockMaxValues[block] - maxValue) * beta) * invSum;
+
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            out[i] *= factor;
+        }
+    }
+}
+
+/// Softmax over a strided axis. Whole rows of innerSize contiguous elements are processed at a
+/// time, so the inner loops run over contiguous memory even though the axis itself is strided.
+void SoftmaxStrided(const float* in,
+                    float* out,
+                    unsigned int axisSize,
+                    unsigned int innerSize,
+                    float beta,
+                    std::vector<float>& maxValues,
+                    std::vector<float>& sums)
+{
+    maxValues.assign(innerSize, std::numeric_limits<float>::lowest());
+    sums.assign(innerSize, 0.0f);
+
+    // Find max
+    for (unsigned int iter = 0; iter < axisSize; ++iter)
+    {
+        const float* inputRow = in + iter * innerSize;
+        for (unsigned int inner = 0; inner < innerSize; ++inner)
+        {
+            maxValues[inner] = std::max(maxValues[inner], inputRow[inner]);
+        }
+    }
+
+    // Compute exponentials and their sum
+    for (unsigned int iter = 0; iter < axisSize; ++iter)
+    {
+        const float* inputRow = in + iter * innerSize;
+        float* outputRow      = out + iter * innerSize;
+        for (unsigned int inner = 0; inner < innerSize; ++inner)
+        {
+            outputRow[inner] = (inputRow[inner] - maxValues[inner]) * beta;
+        }
+    }
+    FastExp(out, axisSize * innerSize);
+    for (unsigned int iter = 0; iter < axisSize; ++iter)
+    {
+        const float* outputRow = out + iter * innerSize;
+        for (unsigned int inner = 0; inner < innerSize; ++inner)
+        {
+            sums[inner] += outputRow[inner];
+        }
+    }
+
+    // Compute result
+    for (unsigned int inner = 0; inner < innerSize; ++inner)
+    {
+        sums[inner] = 1.0f / sums[inner];
+    }
+    for (unsigned int iter = 0; iter < axisSize; ++iter)
+    {
+        float* outputRow = out + iter * innerSize;
+        for (unsigned int inner = 0; inner < innerSize; ++inner)
+        {
+            outputRow[inner] *= sums[inner];
+        }
+    }
+}
+
+} // anonymous namespace
+
 /// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
 void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTensorInfo, float beta, int axis)
 {
@@ -32,41 +218,42 @@ void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTen
                                                                       uAxis + 1,
                                                                       inputShape.GetNumDimensions());
 
-    for (unsigned int outer = 0; outer < outerSize; ++outer)
+    const unsigned int sliceSize  = axisSize * innerSize;
+    if (sliceSize == 0)
     {
-        unsigned int inputBeginIdx  = outer * axisSize * innerSize;
-        unsigned int inputEndIdx    = inputBeginIdx + axisSize * innerSize;
-        unsigned int outputBeginIdx = outer * axisSize * innerSize;
+        return;
+    }
+
+    ParallelFor(0, outerSize, [&](unsigned int begin, unsigned int end)
+    {
+        std::unique_ptr<Decoder<float>> inputDecoder  = in.Clone();
+        std::unique_ptr<Encoder<float>> outputEncoder = out.Clone();
 
-        for (unsigned int inner = 0; inner < innerSize; ++inner, ++inputBeginIdx, ++inputEndIdx, ++outputBeginIdx)
+        std::vector<float> inputBuffer(sliceSize);
+        std::vector<float> outputBuffer(sliceSize);
+        std::vector<float> maxValues;
+        std::vector<float> sums;
+
+        for (unsigned int outer = begin; outer < end; ++outer)
         {
-            // Find max
-            float maxValue = std::numeric_limits<float>::lowest();
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize)
-            {
-                in[iter];
-                maxValue = std::max(maxValue, in.Get());
-            }
+            (*inputDecoder)[outer * sliceSize];
+            (*outputEncoder)[outer * sliceSize];
+
+            const float* inputValues = inputDecoder->DecodeChunk(inputBuffer.data(), sliceSize);
+            float* outputValues      = outputEncoder->GetChunkBuffer(outputBuffer.data());
 
-            // Compute sum
-            float sum = 0.0f;
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize)
+            if (innerSize == 1)
             {
-                in[iter];
-                sum += std::exp((in.Get() - maxValue) * beta);
+                SoftmaxContiguous(inputValues, outputValues, axisSize, beta, maxValues);
             }
-
-            // Compute result
-            unsigned int outputIter = outputBeginIdx;
-            out[outputIter];
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize, outputIter += innerSize)
+            else
             {
-                out[outputIter];
-                in[iter];
-                out.Set(std::exp((in.Get() - maxValue) * beta) / sum);
+                SoftmaxStrided(inputValues, outputValues, axisSize, innerSize, beta, maxValues, sums);
             }
+
+            outputEncoder->EncodeChunk(outputValues, sliceSize);
         }
-    }
+    });
 }
 
 } //namespace armnn
@@ -14,4 +14,9 @@ namespace armnn
 /// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
 void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTensorInfo, float beta, int axis = -1);
 
+/// Replaces each value x with e^x, using Cody-Waite range reduction and the Cephes expf polynomial. The clamp and
+/// the polynomial are kept in separate branch-free loops without library calls so that both vectorize. The relative
+/// error is below 1e-6; results below about 1e-38 flush to zero and inputs above 88 saturate instead of overflowing.
+void FastExp(float* values, unsigned int numElements);
+
 } //namespace armnn
@@ -15,14 +15,47 @@
 
 #include "Decoders.hpp"
 #include "Encoders.hpp"
+#include "ViewCopy.hpp"
 
 namespace armnn
 {
 
+namespace
+{
+
+bool OutputsMatchInputType(const SplitterQueueDescriptor& data, const TensorInfo& inputInfo)
+{
+    for (const ITensorHandle* output : data.m_Outputs)
+    {
+        if (!GetTensorInfo(output).IsTypeSpaceMatch(inputInfo))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
 void Split(const SplitterQueueDescriptor& data)
 {
     const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
 
+    // Without any requantization, copies each view of the input out to its output a contiguous run at a time.
+    if (OutputsMatchInputType(data, inputInfo))
+    {
+        const void* input = data.m_Inputs[0]->Map();
+        const unsigned int elementSize = GetDataTypeSize(inputInfo.GetDataType());
+
+        for (unsigned int viewIdx = 0; viewIdx < data.m_ViewOrigins.size(); ++viewIdx)
+        {
+            const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[viewIdx]);
+            CopyFromView(input, data.m_Outputs[viewIdx]->Map(), outputInfo.GetShape(), inputInfo.GetShape(),
+                         data.m_ViewOrigins[viewIdx].m_Origin, elementSize);
+        }
+        return;
+    }
+
     std::unique_ptr<Decoder<float>> decoderPtr =
         MakeDecoder<float>(inputInfo, data.m_Inputs[0]->Map());
     Decoder<float>& decoder = *decoderPtr;
@@ -6,6 +6,8 @@
 #include "Stack.hpp"
 #include "RefWorkloadUtils.hpp"
 
+#include <cstring>
+
 namespace armnn
 {
 
@@ -112,4 +114,36 @@ void Stack(const StackQueueDescriptor& data,
     }
 }
 
+void Stack(const StackQueueDescriptor& data,
+           const std::vector<const void*>& inputs,
+           void* output)
+{
+    const TensorInfo& outputInfo = GetTensorInfo(data.m_Outputs[0]);
+    const TensorInfo& inputInfo = GetTensorInfo(data.m_Inputs[0]);
+    const TensorShape& inputDims = inputInfo.GetShape();
+
+    const unsigned int axis = data.m_Parameters.m_Axis;
+
+    // The dimensions of the inputs from the axis on form one contiguous block. The output holds, for each index
+    // of the dimensions before the axis, that block from every input in turn.
+    unsigned int numBlocks = 1;
+    for (unsigned int i = 0; i < axis; ++i)
+    {
+        numBlocks *= inputDims[i];
+    }
+    const size_t blockSize = (inputInfo.GetNumElements() / numBlocks) * GetDataTypeSize(outputInfo.GetDataType());
+
+    const size_t numInputs = inputs.size();
+    unsigned char* outputBytes = static_cast<unsigned char*>(output);
+    for (unsigned int block = 0; block < numBlocks; ++block)
+    {
+        for (size_t i = 0; i < numInputs; ++i)
+        {
+            std::memcpy(outputBytes + (block * numInputs + i) * blockSize,
+                        static_cast<const unsigned char*>(inputs[i]) + block * blockSize,
+                        blockSize);
+        }
+    }
+}
+
 } // namespace armnn
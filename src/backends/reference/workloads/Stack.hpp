@@ -17,4 +17,9 @@ void Stack (const StackQueueDescriptor&                   data,
             std::vector<std::unique_ptr<Decoder<float>>>& inputs,
             Encoder<float>&                               output);
 
+/// Stacks whole blocks with memcpy. The inputs and the output must have the same data type and quantization.
+void Stack (const StackQueueDescriptor& data,
+            const std::vector<const void*>& inputs,
+            void* output);
+
 } // namespace armnn
@@ -10,6 +10,7 @@
 #include <boost/assert.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
+#include <algorithm>
 #include <cstring>
 
 namespace armnn
@@ -117,6 +118,14 @@ void StridedSlice(const TensorInfo& inputInfo,
 
     const int step = boost::numeric_cast<int>(dataTypeSize);
 
+    const int dim1 = boost::numeric_cast<int>(inputShape[1]);
+    const int dim2 = boost::numeric_cast<int>(inputShape[2]);
+    const int dim3 = boost::numeric_cast<int>(inputShape[3]);
+
+    // With a unit stride on the innermost dimension, each row of the output is a contiguous run of the input.
+    const bool contiguousRows = paddedParams.m_Stride[3] == 1;
+    const int rowLength = std::max(stop3 - start3, 0);
+
     for (int in0 = start0;
          !LoopCondition(in0, stop0, paddedParams.m_Stride[0]);
          in0 += paddedParams.m_Stride[0])
@@ -129,14 +138,18 @@ void StridedSlice(const TensorInfo& inputInfo,
                  !LoopCondition(in2, stop2, paddedParams.m_Stride[2]);
                  in2 += paddedParams.m_Stride[2])
             {
+                if (contiguousRows)
+                {
+                    const int inputOffset = (((in0 * dim1 + in1) * dim2 + in2) * dim3 + start3) * step;
+                    ::memcpy(output, input + inputOffset, boost::numeric_cast<size_t>(rowLength * step));
+                    output += rowLength * step;
+                    continue;
+                }
+
                 for (int in3 = start3;
                      !LoopCondition(in3, stop3, paddedParams.m_Stride[3]);
                      in3 += paddedParams.m_Stride[3])
                 {
-                    int dim1 = boost::numeric_cast<int>(inputShape[1]);
-                    int dim2 = boost::numeric_cast<int>(inputShape[2]);
-                    int dim3 = boost::numeric_cast<int>(inputShape[3]);
-
                     int inputOffset = (((in0 * dim1 + in1) * dim2 + in2) * dim3 + in3) * step;
                     ::memcpy(output, input + inputOffset, dataTypeSize);
                     output += step;
@@ -0,0 +1,204 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Set while a thread runs a ParallelFor task, so that nested ParallelFor calls run inline.
+thread_local bool t_InParallelFor = false;
+
+} // anonymous namespace
+
+ThreadPool& ThreadPool::GetInstance()
+{
+    static ThreadPool instance;
+    return instance;
+}
+
+ThreadPool::~ThreadPool()
+{
+    StopWorkers();
+}
+
+void ThreadPool::SetNumThreads(unsigned int numThreads)
+{
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    std::lock_guard<std::mutex> dispatchLock(m_DispatchMutex);
+    if (m_Workers.size() + 1 == numThreads)
+    {
+        return;
+    }
+
+    StopWorkers();
+    StartWorkers(numThreads - 1);
+}
+
+unsigned int ThreadPool::GetNumThreads() const
+{
+    std::lock_guard<std::mutex> dispatchLock(m_DispatchMutex);
+    return static_cast<unsigned int>(m_Workers.size()) + 1;
+}
+
+void ThreadPool::ParallelFor(unsigned int begin,
+                             unsigned int end,
+                             const RangeFunction& func,
+                             unsigned int minGrain)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+
+    // The calling thread may already own the dispatch mutex when the call is nested, so check that first.
+    std::unique_lock<std::mutex> dispatchLock(m_DispatchMutex, std::defer_lock);
+    if (t_InParallelFor || !dispatchLock.try_lock())
+    {
+        func(begin, end);
+        return;
+    }
+
+    const unsigned int numTasks = std::min(static_cast<unsigned int>(m_Workers.size()) + 1,
+                                           (end - begin) / std::max(minGrain, 1u));
+    if (numTasks <= 1)
+    {
+        dispatchLock.unlock();
+        func(begin, end);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> jobLock(m_JobMutex);
+        m_Function       = &func;
+        m_Begin          = begin;
+        m_End            = end;
+        m_NumTasks       = numTasks;
+        m_NextTask       = 0;
+        m_TasksRemaining = numTasks;
+        m_Exception      = nullptr;
+        ++m_JobId;
+    }
+    m_JobAvailable.notify_all();
+
+    // The calling thread takes tasks as well, so the job completes even if no worker picks it up.
+    RunTasks();
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> jobLock(m_JobMutex);
+        m_JobDone.wait(jobLock, [this] { return m_TasksRemaining == 0; });
+        m_Function = nullptr;
+        std::swap(exception, m_Exception);
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+void ThreadPool::StartWorkers(unsigned int numWorkers)
+{
+    m_Stop = false;
+    for (unsigned int i = 0; i < numWorkers; ++i)
+    {
+        m_Workers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+void ThreadPool::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> jobLock(m_JobMutex);
+        m_Stop = true;
+    }
+    m_JobAvailable.notify_all();
+
+    for (std::thread& worker : m_Workers)
+    {
+        worker.join();
+    }
+    m_Workers.clear();
+}
+
+void ThreadPool::WorkerLoop()
+{
+    std::unique_lock<std::mutex> jobLock(m_JobMutex);
+    unsigned long lastJobId = m_JobId;
+
+    while (true)
+    {
+        m_JobAvailable.wait(jobLock, [&] { return m_Stop || m_JobId != lastJobId; });
+        if (m_Stop)
+        {
+            return;
+        }
+        lastJobId = m_JobId;
+
+        jobLock.unlock();
+        RunTasks();
+        jobLock.lock();
+    }
+}
+
+void ThreadPool::RunTasks()
+{
+    t_InParallelFor = true;
+
+    while (true)
+    {
+        const RangeFunction* func = nullptr;
+        unsigned int taskBegin = 0;
+        unsigned int taskEnd = 0;
+        {
+            std::lock_guard<std::mutex> jobLock(m_JobMutex);
+            if (m_Function == nullptr || m_NextTask == m_NumTasks)
+            {
+                break;
+            }
+
+            // Task i covers [begin + range * i / numTasks, begin + range * (i + 1) / numTasks).
+            const uint64_t range = m_End - m_Begin;
+            const unsigned int task = m_NextTask++;
+            func      = m_Function;
+            taskBegin = m_Begin + static_cast<unsigned int>(range * task / m_NumTasks);
+            taskEnd   = m_Begin + static_cast<unsigned int>(range * (task + 1) / m_NumTasks);
+        }
+
+        try
+        {
+            (*func)(taskBegin, taskEnd);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> jobLock(m_JobMutex);
+            if (!m_Exception)
+            {
+                m_Exception = std::current_exception();
+            }
+        }
+
+        std::lock_guard<std::mutex> jobLock(m_JobMutex);
+        if (--m_TasksRemaining == 0)
+        {
+            m_JobDone.notify_all();
+        }
+    }
+
+    t_InParallelFor = false;
+}
+
+} //namespace armnn
@@ -0,0 +1,82 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+/// Pool of worker threads shared by the reference workloads, used to split the outer loops of a kernel.
+/// The pool starts with a single thread, i.e. everything runs on the calling thread, until SetNumThreads()
+/// is called; runtimes do so when IRuntime::CreationOptions::m_CpuRefNumThreads is set.
+class ThreadPool
+{
+public:
+    using RangeFunction = std::function<void(unsigned int begin, unsigned int end)>;
+
+    static ThreadPool& GetInstance();
+
+    ~ThreadPool();
+
+    /// Sets the number of threads work is split across, including the calling thread.
+    /// 0 uses one thread per hardware thread.
+    void SetNumThreads(unsigned int numThreads);
+
+    unsigned int GetNumThreads() const;
+
+    /// Calls func on disjoint sub-ranges covering [begin, end), in parallel, and returns once all of them
+    /// are done. Each sub-range holds at least minGrain indices. Runs func(begin, end) on the calling thread
+    /// when the range is too small to split, when called from within another ParallelFor, or when the pool
+    /// is busy with a ParallelFor issued by another thread. Exceptions thrown by func are rethrown here.
+    void ParallelFor(unsigned int begin, unsigned int end, const RangeFunction& func, unsigned int minGrain = 1);
+
+private:
+    ThreadPool() = default;
+
+    void StartWorkers(unsigned int numWorkers);
+    void StopWorkers();
+    void WorkerLoop();
+    void RunTasks();
+
+    std::vector<std::thread> m_Workers;
+
+    /// Serializes ParallelFor calls (and changes to the number of threads) issued by different threads.
+    mutable std::mutex m_DispatchMutex;
+
+    /// Protects the state of the current job below.
+    std::mutex m_JobMutex;
+    std::condition_variable m_JobAvailable;
+    std::condition_variable m_JobDone;
+
+    const RangeFunction* m_Function = nullptr;
+    unsigned int m_Begin = 0;
+    unsigned int m_End = 0;
+    unsigned int m_NumTasks = 0;
+    unsigned int m_NextTask = 0;
+    unsigned int m_TasksRemaining = 0;
+    unsigned long m_JobId = 0;
+    bool m_Stop = false;
+    std::exception_ptr m_Exception;
+};
+
+/// Splits [begin, end) across the reference backend's thread pool: see ThreadPool::ParallelFor.
+/// The kernels use it for outer loops whose iterations write disjoint parts of the output. Decoders and encoders
+/// keep a position, so func must work on its own Clone() of them rather than on shared ones.
+inline void ParallelFor(unsigned int begin,
+                        unsigned int end,
+                        const ThreadPool::RangeFunction& func,
+                        unsigned int minGrain = 1)
+{
+    ThreadPool::GetInstance().ParallelFor(begin, end, func, minGrain);
+}
+
+} //namespace armnn
@@ -5,13 +5,31 @@
 
 #include "TransposeConvolution2d.hpp"
 
+#include "Gemm.hpp"
+#include "ThreadPool.hpp"
+
 #include <DataLayoutIndexed.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace armnn
 {
 
 using namespace armnnUtils;
 
+namespace
+{
+
+/// Upper bound on the number of elements of the column matrix computed at a time.
+constexpr unsigned int g_MaxColumnsChunkSize = 1u << 16;
+
+} // anonymous namespace
+
+// The transpose convolution is computed as a matrix product followed by a scatter (col2im). For each input pixel,
+// the product of its channels with the weights gives its contribution to every output channel at every position of
+// the kernel window: columns[pixel][(yWeights * weightsWidth + xWeights) * outputDepth + dOutput]. These are then
+// accumulated into the output at the position the kernel window covers for that pixel.
 void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descriptor,
                                 const TensorShape& inputShape,
                                 Decoder<float>& inputDecoder,
@@ -29,102 +47,159 @@ void TransposeConvolution2dImpl(const TransposeConvolution2dDescriptor& descript
     const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
     const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
     const unsigned int widthIndex    = dataLayoutIndexed.GetWidthIndex();
+    const bool isNhwc = descriptor.m_DataLayout == DataLayout::NHWC;
 
-    unsigned int numBatches = inputShape[0];
+    const unsigned int numBatches = inputShape[0];
 
-    unsigned int inputWidth  = inputShape[widthIndex];
-    unsigned int inputHeight = inputShape[heightIndex];
-    unsigned int inputDepth  = inputShape[channelsIndex];
+    const unsigned int inputWidth  = inputShape[widthIndex];
+    const unsigned int inputHeight = inputShape[heightIndex];
+    const unsigned int inputDepth  = inputShape[channelsIndex];
 
-    unsigned int weightsHeight = weightsShape[heightIndex];
-    unsigned int weightsWidth  = weightsShape[widthIndex];
+    const unsigned int weightsHeight = weightsShape[heightIndex];
+    const unsigned int weightsWidth  = weightsShape[widthIndex];
 
-    unsigned int outputHeight = outputShape[heightIndex];
-    unsigned int outputWidth  = outputShape[widthIndex];
-    unsigned int outputDepth  = outputShape[channelsIndex];
+    const unsigned int outputHeight = outputShape[heightIndex];
+    const unsigned int outputWidth  = outputShape[widthIndex];
+    const unsigned int outputDepth  = outputShape[channelsIndex];
 
-    unsigned int paddingLeft = descriptor.m_PadLeft;
-    unsigned int paddingTop  = descriptor.m_PadTop;
+    const unsigned int paddingLeft = descriptor.m_PadLeft;
+    const unsigned int paddingTop  = descriptor.m_PadTop;
 
-    unsigned int strideX = descriptor.m_StrideX;
-    unsigned int strideY = descriptor.m_StrideY;
+    const unsigned int strideX = descriptor.m_StrideX;
+    const unsigned int strideY = descriptor.m_StrideY;
 
-    std::vector<float> outputBuffer(outputShape.GetNumElements(), 0);
+    const unsigned int numPixels       = inputHeight * inputWidth;
+    const unsigned int numColumns      = weightsHeight * weightsWidth * outputDepth;
+    const unsigned int inputBatchSize  = numPixels * inputDepth;
+    const unsigned int outputPlaneSize = outputHeight * outputWidth;
+    const unsigned int outputBatchSize = outputPlaneSize * outputDepth;
 
-    for (unsigned int batch = 0u; batch < numBatches; ++batch)
+    // Packs the weights into the [inputDepth x numColumns] right-hand side of the product.
+    std::vector<float> weightsBuffer(weightsShape.GetNumElements());
+    weightsDecoder[0];
+    const float* weightsValues = weightsDecoder.DecodeChunk(weightsBuffer.data(), weightsShape.GetNumElements());
+
+    std::vector<float> packedWeights(inputDepth * numColumns);
+    for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
     {
-        for (unsigned int yInput = 0u; yInput < inputHeight; ++yInput)
+        for (unsigned int dInput = 0u; dInput < inputDepth; ++dInput)
         {
-            for (unsigned int xInput = 0u; xInput < inputWidth; ++xInput)
+            for (unsigned int yWeights = 0u; yWeights < weightsHeight; ++yWeights)
             {
-                unsigned int xOutputOrigin = xInput * strideX - paddingLeft;
-                unsigned int yOutputOrigin = yInput * strideY - paddingTop;
-
-                for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
+                for (unsigned int xWeights = 0u; xWeights < weightsWidth; ++xWeights)
                 {
-                    for (unsigned int yWeights = 0u; yWeights < weightsHeight; ++yWeights)
-                    {
-                        for (unsigned int xWeights = 0u; xWeights < weightsWidth; ++xWeights)
-                        {
-                            unsigned int yOutput = yOutputOrigin + yWeights;
-                            unsigned int xOutput = xOutputOrigin + xWeights;
-
-                            if (yOutput < outputHeight && xOutput< outputWidth)
-                            {
-                                for (unsigned int dInput = 0u; dInput < inputDepth; dInput++)
-                                {
-                                    const unsigned int inputIndex =
-                                        dataLayoutIndexed.GetIndex(inputShape, batch, dInput, yInput, xInput);
-                                    inputDecoder[inputIndex];
-
-                                    const unsigned int weightsIndex =
-                                        dataLayoutIndexed.GetIndex(weightsShape, dOutput, dInput, yWeights, xWeights);
-                                    weightsDecoder[weightsIndex];
-
-                                    const unsigned int outputIndex =
-                                        dataLayoutIndexed.GetIndex(outputShape, batch, dOutput, yOutput, xOutput);
-                                    outputEncoder[outputIndex];
-
-                                    float output = outputBuffer[outputIndex];
-                                    output += inputDecoder.Get() * weightsDecoder.Get();
-                                    outputBuffer[outputIndex] = output;
-                                }
-                            }
-                        }
-                    }
+                    const unsigned int weightsIndex =
+                        dataLayoutIndexed.GetIndex(weightsShape, dOutput, dInput, yWeights, xWeights);
+                    const unsigned int column = (yWeights * weightsWidth + xWeights) * outputDepth + dOutput;
+                    packedWeights[dInput * numColumns + column] = weightsValues[weightsIndex];
                 }
             }
         }
     }
 
-    // Apply bias (if enabled)
+    std::vector<float> biases(outputDepth, 0.0f);
     if (descriptor.m_BiasEnabled)
     {
-        outputEncoder[0];
-        Decoder<float>& rBiasesDecoder = *biasesDecoder;
+        (*biasesDecoder)[0];
+        const float* biasesValues = biasesDecoder->DecodeChunk(biases.data(), outputDepth);
+        if (biasesValues != biases.data())
+        {
+            std::copy(biasesValues, biasesValues + outputDepth, biases.begin());
+        }
+    }
+
+    const unsigned int pixelsPerChunk = std::max(1u, std::min(numPixels, g_MaxColumnsChunkSize / numColumns));
 
-        for (unsigned int batch = 0u; batch < numBatches; ++batch)
+    std::vector<float> inputBuffer(inputBatchSize);
+    std::vector<float> inputMatrix(isNhwc ? 0u : inputBatchSize);
+    std::vector<float> columns(pixelsPerChunk * numColumns);
+    std::vector<float> accumulator(isNhwc ? 0u : outputBatchSize);
+    std::vector<float> outputBuffer(outputBatchSize);
+
+    for (unsigned int batch = 0u; batch < numBatches; ++batch)
+    {
+        inputDecoder[batch * inputBatchSize];
+        outputEncoder[batch * outputBatchSize];
+
+        // The left-hand side of the product has one row of channels per pixel, i.e. NHWC order.
+        const float* inputValues = inputDecoder.DecodeChunk(inputBuffer.data(), inputBatchSize);
+        if (!isNhwc)
         {
-            for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
+            for (unsigned int dInput = 0u; dInput < inputDepth; ++dInput)
+            {
+                for (unsigned int pixel = 0u; pixel < numPixels; ++pixel)
+                {
+                    inputMatrix[pixel * inputDepth + dInput] = inputValues[dInput * numPixels + pixel];
+                }
+            }
+            inputValues = inputMatrix.data();
+        }
+
+        // The contributions are accumulated in NHWC order, straight into the output for NHWC.
+        float* outputValues = outputEncoder.GetChunkBuffer(outputBuffer.data());
+        float* accumulated = isNhwc ? outputValues : accumulator.data();
+        std::fill(accumulated, accumulated + outputBatchSize, 0.0f);
+
+        for (unsigned int firstPixel = 0u; firstPixel < numPixels; firstPixel += pixelsPerChunk)
+        {
+            const unsigned int chunkPixels = std::min(pixelsPerChunk, numPixels - firstPixel);
+            std::fill(columns.begin(), columns.begin() + chunkPixels * numColumns, 0.0f);
+
+            ParallelFor(0, chunkPixels, [&](unsigned int rowBegin, unsigned int rowEnd)
+            {
+                Gemm(rowEnd - rowBegin, numColumns, inputDepth,
+                     inputValues + (firstPixel + rowBegin) * inputDepth, inputDepth,
+                     packedWeights.data(), numColumns,
+                     columns.data() + rowBegin * numColumns, numColumns);
+            }, 4);
+
+            for (unsigned int row = 0u; row < chunkPixels; ++row)
             {
-                rBiasesDecoder[dOutput];
-                for (unsigned int yOutput = 0u; yOutput < outputHeight; ++yOutput)
+                const unsigned int yInput = (firstPixel + row) / inputWidth;
+                const unsigned int xInput = (firstPixel + row) % inputWidth;
+
+                const unsigned int xOutputOrigin = xInput * strideX - paddingLeft;
+                const unsigned int yOutputOrigin = yInput * strideY - paddingTop;
+
+                for (unsigned int yWeights = 0u; yWeights < weightsHeight; ++yWeights)
                 {
-                    for (unsigned int xOutput = 0u; xOutput < outputWidth; ++xOutput)
+                    const unsigned int yOutput = yOutputOrigin + yWeights;
+                    if (yOutput >= outputHeight)
+                    {
+                        continue;
+                    }
+
+                    for (unsigned int xWeights = 0u; xWeights < weightsWidth; ++xWeights)
                     {
-                        const unsigned int outputIndex =
-                            dataLayoutIndexed.GetIndex(outputShape, batch, dOutput, yOutput, xOutput);
-                        outputBuffer[outputIndex] += rBiasesDecoder.Get();
+                        const unsigned int xOutput = xOutputOrigin + xWeights;
+                        if (xOutput >= outputWidth)
+                        {
+                            continue;
+                        }
+
+                        const float* column = columns.data() + row * numColumns +
+                                              (yWeights * weightsWidth + xWeights) * outputDepth;
+                        float* output = accumulated + (yOutput * outputWidth + xOutput) * outputDepth;
+                        for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
+                        {
+                            output[dOutput] += column[dOutput];
+                        }
                     }
                 }
             }
         }
-    }
-    outputEncoder[0];
-    for (float output : outputBuffer)
-    {
-        outputEncoder.Set(output);
-        ++outputEncoder;
+
+        // Apply bias (if enabled), converting to NCHW on the way if needed.
+        for (unsigned int position = 0u; position < outputPlaneSize; ++position)
+        {
+            for (unsigned int dOutput = 0u; dOutput < outputDepth; ++dOutput)
+            {
+                const float value = accumulated[position * outputDepth + dOutput] + biases[dOutput];
+                outputValues[isNhwc ? position * outputDepth + dOutput : dOutput * outputPlaneSize + position] = value;
+            }
+        }
+
+        outputEncoder.EncodeChunk(outputValues, outputBatchSize);
     }
 }
 
@@ -0,0 +1,126 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ViewCopy.hpp"
+
+#include <boost/assert.hpp>
+
+#include <cstring>
+
+namespace armnn
+{
+
+namespace
+{
+
+/// Calls func(viewOffset, fullOffset, numElements) for every run of elements that is contiguous in both the view
+/// and the full tensor. Offsets are in elements.
+template<typename Func>
+void ForEachViewRun(const TensorShape& viewShape,
+                    const TensorShape& fullShape,
+                    const std::vector<unsigned int>& viewOrigin,
+                    Func func)
+{
+    const unsigned int numDims = viewShape.GetNumDimensions();
+    BOOST_ASSERT(fullShape.GetNumDimensions() == numDims);
+    BOOST_ASSERT(viewOrigin.size() == numDims);
+
+    if (viewShape.GetNumElements() == 0)
+    {
+        return;
+    }
+
+    std::vector<unsigned int> fullStrides(numDims);
+    unsigned int stride = 1;
+    for (unsigned int d = numDims; d-- > 0;)
+    {
+        BOOST_ASSERT(viewOrigin[d] + viewShape[d] <= fullShape[d]);
+        fullStrides[d] = stride;
+        stride *= fullShape[d];
+    }
+
+    // Trailing dimensions the view spans completely are contiguous in both tensors, so they merge into one run
+    // together with the first dimension the view does not span completely.
+    unsigned int runDim = numDims - 1;
+    unsigned int runLength = viewShape[runDim];
+    while (runDim > 0 && viewShape[runDim] == fullShape[runDim])
+    {
+        --runDim;
+        runLength *= viewShape[runDim];
+    }
+
+    unsigned int baseOffset = 0;
+    for (unsigned int d = 0; d < numDims; ++d)
+    {
+        baseOffset += viewOrigin[d] * fullStrides[d];
+    }
+
+    unsigned int numRuns = 1;
+    for (unsigned int d = 0; d < runDim; ++d)
+    {
+        numRuns *= viewShape[d];
+    }
+
+    // Walks the view indices of the dimensions outside the run, last dimension fastest.
+    std::vector<unsigned int> indices(runDim, 0);
+    unsigned int fullOffset = baseOffset;
+    for (unsigned int run = 0; run < numRuns; ++run)
+    {
+        func(run * runLength, fullOffset, runLength);
+
+        for (unsigned int d = runDim; d-- > 0;)
+        {
+            if (++indices[d] < viewShape[d])
+            {
+                fullOffset += fullStrides[d];
+                break;
+            }
+            indices[d] = 0;
+            fullOffset -= (viewShape[d] - 1) * fullStrides[d];
+        }
+    }
+}
+
+} // anonymous namespace
+
+void CopyIntoView(const void* viewData,
+                  void* fullData,
+                  const TensorShape& viewShape,
+                  const TensorShape& fullShape,
+                  const std::vector<unsigned int>& viewOrigin,
+                  unsigned int elementSize)
+{
+    const unsigned char* src = static_cast<const unsigned char*>(viewData);
+    unsigned char* dst = static_cast<unsigned char*>(fullData);
+
+    ForEachViewRun(viewShape, fullShape, viewOrigin,
+                   [&](unsigned int viewOffset, unsigned int fullOffset, unsigned int numElements)
+                   {
+                       std::memcpy(dst + fullOffset * elementSize,
+                                   src + viewOffset * elementSize,
+                                   numElements * elementSize);
+                   });
+}
+
+void CopyFromView(const void* fullData,
+                  void* viewData,
+                  const TensorShape& viewShape,
+                  const TensorShape& fullShape,
+                  const std::vector<unsigned int>& viewOrigin,
+                  unsigned int elementSize)
+{
+    const unsigned char* src = static_cast<const unsigned char*>(fullData);
+    unsigned char* dst = static_cast<unsigned char*>(viewData);
+
+    ForEachViewRun(viewShape, fullShape, viewOrigin,
+                   [&](unsigned int viewOffset, unsigned int fullOffset, unsigned int numElements)
+                   {
+                       std::memcpy(dst + viewOffset * elementSize,
+                                   src + fullOffset * elementSize,
+                                   numElements * elementSize);
+                   });
+}
+
+} //namespace armnn
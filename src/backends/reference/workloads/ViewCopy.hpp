@@ -0,0 +1,34 @@
+//
+// Copyright © 2019 Arm Ltd. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Copies a dense tensor of shape viewShape into the window starting at viewOrigin of a tensor of shape fullShape.
+/// Both tensors must hold the same data type with the same quantization: elements are copied as raw bytes, in the
+/// longest runs that are contiguous in both tensors.
+void CopyIntoView(const void* viewData,
+                  void* fullData,
+                  const TensorShape& viewShape,
+                  const TensorShape& fullShape,
+                  const std::vector<unsigned int>& viewOrigin,
+                  unsigned int elementSize);
+
+/// Copies the window starting at viewOrigin of a tensor of shape fullShape out into a dense tensor of shape viewShape.
+/// Same requirements as CopyIntoView.
+void CopyFromView(const void* fullData,
+                  void* viewData,
+                  const TensorShape& viewShape,
+                  const TensorShape& fullShape,
+                  const std::vector<unsigned int>& viewOrigin,
+                  unsigned int elementSize);
+
+} //namespace armnn